@@ -67,6 +67,11 @@ enum eve2at_messages_e {
 	eve2at_msg_save, // save request
 	eve2at_msg_keyboard, // keyboard request
 	eve2at_msg_keypad, // keypad request
+	eve2at_rsp_preview_ack, // response to at2eve_msg_choose_list_preview
+	eve2at_rsp_image_ack, // response to at2eve_msg_image_*, value is EVE_IMAGE_OK or error
+	eve2at_rsp_video_ack, // response to at2eve_msg_video_*, value is EVE_VIDEO_OK or error
+	eve2at_rsp_remote_ack, // response to at2eve_msg_remote_*, value is EVE_REMOTE_OK or error
+	eve2at_rsp_snapshot_ack, // response to at2eve_msg_snapshot_*, value is EVE_SNAPSHOT_OK or error
 };
 
 enum at_messages_e {
@@ -87,6 +92,21 @@ enum at_messages_e {
 	at2eve_msg_multiline_add,
 	at2eve_msg_multiline_colour,
 	at2eve_msg_multiline_show,
+	at2eve_msg_choose_list_preview, // response is eve2at_rsp_preview_ack
+	at2eve_msg_touch, // sent from EVE touch interrupt, no response
+	at2eve_msg_image_start, // response is eve2at_rsp_image_ack
+	at2eve_msg_image_data, // response is eve2at_rsp_image_ack
+	at2eve_msg_image_end, // value non-zero for complete or zero to abandon, response is eve2at_rsp_image_ack
+	at2eve_msg_video_start, // response is eve2at_rsp_video_ack
+	at2eve_msg_video_data, // response is eve2at_rsp_video_ack
+	at2eve_msg_video_end, // response is eve2at_rsp_video_ack
+	at2eve_msg_remote_start, // response is eve2at_rsp_remote_ack
+	at2eve_msg_remote_data, // response is eve2at_rsp_remote_ack
+	at2eve_msg_remote_frame, // value non-zero for complete or zero to abandon, response is eve2at_rsp_remote_ack
+	at2eve_msg_remote_end, // response is eve2at_rsp_remote_ack
+	at2eve_msg_snapshot_start, // response is eve2at_rsp_snapshot_ack
+	at2eve_msg_snapshot_data, // response is eve2at_rsp_snapshot_ack
+	at2eve_msg_snapshot_end, // response is eve2at_rsp_snapshot_ack
 };
 
 enum eve_options {
@@ -154,6 +174,43 @@ struct at2eve_msg_data_choose_s
 	uint32_t list_options;
 };
 
+struct at2eve_msg_data_media_s
+{
+	// Image or video data. Only valid until the response is received.
+	const uint8_t *data;
+	uint16_t length;
+	// Bytes of the upload after this data.
+	uint32_t left;
+};
+
+struct at2eve_msg_data_remote_s
+{
+	// Filled in by the EVE task. RAM_G for the remote display client
+	// and the size of the display.
+	uint32_t address;
+	uint32_t size;
+	uint16_t width;
+	uint16_t height;
+};
+
+struct at2eve_msg_data_snapshot_s
+{
+	// Filled in by the EVE task from at2eve_msg_snapshot_start.
+	uint16_t width;
+	uint16_t height;
+	// Buffer for at2eve_msg_snapshot_data and the length of the compressed
+	// pixels written to it by the EVE task, zero after the last block.
+	uint8_t *buffer;
+	uint16_t size;
+	uint16_t length;
+};
+
+struct at2eve_msg_data_video_end_s
+{
+	uint8_t complete; // non-zero for complete or zero to abandon
+	struct eve_ui_video_stats stats; // filled in by the EVE task
+};
+
 struct eve2at_rsp_choose_s
 {
 	uint32_t command;
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""Generate the eve_ui image asset manifest and compressed bitmaps.
+
+Reads the JPEG images used by eve_ui from the Images directory and writes
+lib/eve_ui/eve_ui_assets.h. The manifest holds the decoded size of each
+image and its offset in the RAM_G image area so that all images can be
+loaded by the co-processor in one pass without reading back properties.
+
+Each image is also converted to an RGB565 bitmap and compressed with zlib
+into lib/eve_ui/eve_ui_images_z.c. These are expanded by CMD_INFLATE
+instead of being decoded by CMD_LOADIMAGE. Requires Pillow.
+
+Run from the repository root after changing any image:
+
+    python3 Scripts/eve_assets.py
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+from PIL import Image
+
+# Order of images in RAM_G. Name, source file. The name is used for the
+# image variables in the C source: img_<name>_z_data and img_<name>_z_size.
+ASSETS = [
+    ("BRIDGETEK_LOGO", "Bridgetek Logo.jpg"),
+    ("SETTINGS", "settings.jpg"),
+    ("CANCEL", "cancel.jpg"),
+    ("SAVE", "tick.jpg"),
+    ("KEYPAD", "keypad.jpg"),
+    ("KEYBOARD", "keyboard.jpg"),
+    ("REFRESH", "refresh.jpg"),
+]
+
+# CMD_LOADIMAGE decodes JPEG images to RGB565.
+BYTES_PER_PIXEL = 2
+# Images are placed on 4 byte boundaries.
+ALIGN = 4
+
+HEADER = """/**
+    @file eve_ui_assets.h
+
+    @brief Image asset manifest.
+
+    Generated by Scripts/eve_assets.py from the Images directory.
+    Do not edit.
+**/
+/*
+ * ============================================================================
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ */
+
+#ifndef _EVE_UI_ASSETS_H
+#define _EVE_UI_ASSETS_H
+
+/**
+ @brief Decoded image sizes and offsets from the start of the image area.
+ */
+//@{
+"""
+
+FOOTER = """//@}
+
+#endif /* _EVE_UI_ASSETS_H */
+"""
+
+SOURCE_HEADER = """/**
+    @file eve_ui_images_z.c
+
+    @brief Compressed RGB565 images for CMD_INFLATE.
+
+    Generated by Scripts/eve_assets.py from the Images directory.
+    Do not edit.
+**/
+/*
+ * ============================================================================
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ */
+
+#include <stdint.h>
+
+#include "eve_ui.h"
+
+// JPEG images in eve_ui_images.c are used instead.
+#ifndef EVE_UI_ASSETS_JPEG
+"""
+
+SOURCE_FOOTER = """#endif // EVE_UI_ASSETS_JPEG
+"""
+
+
+def jpeg_size(path):
+    """Return (width, height) from the frame header of a baseline JPEG."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[0:2] != b"\xff\xd8":
+        raise ValueError("%s: not a JPEG file" % path)
+
+    i = 2
+    while i + 4 <= len(data):
+        if data[i] != 0xFF:
+            raise ValueError("%s: bad marker at 0x%x" % (path, i))
+        marker = data[i + 1]
+        length = struct.unpack(">H", data[i + 2:i + 4])[0]
+        if marker == 0xC0:
+            height, width = struct.unpack(">HH", data[i + 5:i + 9])
+            return width, height
+        if marker in (0xC1, 0xC2, 0xC3):
+            # The co-processor only decodes baseline JPEG images.
+            raise ValueError("%s: not a baseline JPEG" % path)
+        i += 2 + length
+
+    raise ValueError("%s: no frame header" % path)
+
+
+def rgb565_deflate(path):
+    """Return the image as zlib compressed little-endian RGB565 pixels."""
+    rgb = Image.open(path).convert("RGB").tobytes()
+    pixels = bytearray()
+    for i in range(0, len(rgb), 3):
+        r, g, b = rgb[i:i + 3]
+        value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        pixels += struct.pack("<H", value)
+    return zlib.compress(bytes(pixels), 9)
+
+
+def c_array(name, data):
+    """Format compressed data in the style of eve_ui_images.c."""
+    lines = []
+    size = "IMG_%s_Z_SIZE" % name.upper()
+    lines.append("#define %s (0x%X)\n\n" % (size, len(data)))
+    lines.append("const uint32_t img_%s_z_size = %s;\n" % (name, size))
+    lines.append("const uint8_t __flash__ img_%s_z[]; // forward declaration.\n" % name)
+    lines.append("const uint8_t __flash__ *img_%s_z_data = img_%s_z;\n\n" % (name, name))
+    lines.append("const uint8_t __flash__ img_%s_z[%s]  __attribute__((aligned(4))) =\n{\n"
+                 % (name, size))
+    for i in range(0, len(data), 16):
+        row = ", ".join("0x%02X" % b for b in data[i:i + 16])
+        lines.append("    /*%03X:*/ %s,\n" % (i, row))
+    lines.append("};\n\n")
+    return "".join(lines)
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    images = os.path.join(root, "Images")
+    output = os.path.join(root, "lib", "eve_ui", "eve_ui_assets.h")
+    source_output = os.path.join(root, "lib", "eve_ui", "eve_ui_images_z.c")
+
+    lines = [HEADER]
+    source_lines = [SOURCE_HEADER, "\n"]
+    offset = 0
+    for name, source in ASSETS:
+        width, height = jpeg_size(os.path.join(images, source))
+        source_lines.append("// %s\n" % source)
+        source_lines.append(c_array(name.lower(),
+                                    rgb565_deflate(os.path.join(images, source))))
+        lines.append("// %s\n" % source)
+        lines.append("#define EVE_ASSET_%s_WIDTH %d\n" % (name, width))
+        lines.append("#define EVE_ASSET_%s_HEIGHT %d\n" % (name, height))
+        lines.append("#define EVE_ASSET_%s_OFFSET 0x%05x\n" % (name, offset))
+        offset += width * height * BYTES_PER_PIXEL
+        offset = (offset + ALIGN - 1) & ~(ALIGN - 1)
+
+    lines.append("\n// Total size of the image area.\n")
+    lines.append("#define EVE_ASSET_IMAGES_SIZE 0x%05x\n" % offset)
+    lines.append(FOOTER)
+
+    source_lines.append(SOURCE_FOOTER)
+
+    with open(output, "w", newline="\n") as f:
+        f.write("".join(lines))
+
+    # C sources in eve_ui use DOS line endings.
+    with open(source_output, "w", newline="\r\n") as f:
+        f.write("".join(source_lines))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
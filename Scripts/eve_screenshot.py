@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Fetch a screenshot of the EVE display over TCP and save it.
+
+at_monitor listens on port 8080 of the ESP32. A client sends the line
+"SCREENSHOT" and receives "SCREENSHOT <width> <height> RGB565 RLE", or
+"ERROR <n>", followed by blocks of compressed pixels. Each block follows
+a 2 byte little-endian length and a zero length ends the screenshot.
+
+    python3 Scripts/eve_screenshot.py 192.168.1.20 screen.png
+
+Tapping the Bridgetek logo sends a screenshot in the same format on the
+FT9xx debug UART, between the "SCREENSHOT" line and "SCREENSHOT END".
+A capture of the UART can be decoded with --uart.
+
+    python3 Scripts/eve_screenshot.py --uart capture.bin screen.png
+
+The pixels are compressed in packets which do not cross the end of a line.
+A control byte from 0 to 127 is followed by 1 to 128 different pixels. A
+control byte from 128 to 255 is followed by one pixel repeated 2 to 129
+times. Pixels are little-endian RGB565.
+
+Images are saved with Pillow. A file name ending in .raw is saved as the
+RGB565 pixels without Pillow.
+"""
+
+import argparse
+import io
+import socket
+import struct
+import sys
+
+SERVER_PORT = 8080
+
+
+def read_exact(f, length):
+    """Return length bytes from a file or raise EOFError."""
+    data = b""
+    while len(data) < length:
+        more = f.read(length - len(data))
+        if not more:
+            raise EOFError("screenshot cut short")
+        data += more
+    return data
+
+
+def read_header(f):
+    """Return the width and height from the screenshot line."""
+    while True:
+        line = f.readline()
+        if not line:
+            raise EOFError("no screenshot found")
+        words = line.decode("ascii", "replace").split()
+        if words[:1] == ["ERROR"]:
+            raise RuntimeError(line.decode("ascii", "replace").strip())
+        if words[:1] == ["SCREENSHOT"] and words[3:] == ["RGB565", "RLE"]:
+            return int(words[1]), int(words[2])
+
+
+def read_blocks(f):
+    """Return the compressed pixels from the blocks up to a zero length."""
+    data = []
+    while True:
+        (length,) = struct.unpack("<H", read_exact(f, 2))
+        if length == 0:
+            return b"".join(data)
+        data.append(read_exact(f, length))
+
+
+def decompress(data, width, height):
+    """Return the RGB565 pixels from the compressed data."""
+    pixels = bytearray()
+    i = 0
+    while i < len(data):
+        control = data[i]
+        if control < 128:
+            count = (control + 1) * 2
+            pixels += data[i + 1:i + 1 + count]
+            i += 1 + count
+        else:
+            pixels += data[i + 1:i + 3] * (control - 126)
+            i += 3
+    if len(pixels) != width * height * 2:
+        raise ValueError("%d bytes of pixels for %dx%d" % (len(pixels), width, height))
+    return bytes(pixels)
+
+
+def save(path, pixels, width, height):
+    """Save the pixels as an image, or as raw RGB565 for a .raw file."""
+    if path.lower().endswith(".raw"):
+        with open(path, "wb") as f:
+            f.write(pixels)
+        return
+
+    from PIL import Image
+
+    rgb = bytearray()
+    for (pixel,) in struct.iter_unpack("<H", pixels):
+        r = (pixel >> 11) & 0x1f
+        g = (pixel >> 5) & 0x3f
+        b = pixel & 0x1f
+        rgb += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+    Image.frombytes("RGB", (width, height), bytes(rgb)).save(path)
+
+
+def fetch(host, port):
+    """Return the width, height and compressed pixels from the display."""
+    with socket.create_connection((host, port)) as s:
+        s.sendall(b"SCREENSHOT\n")
+        f = s.makefile("rb")
+        width, height = read_header(f)
+        return width, height, read_blocks(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("host", nargs="?", help="address of the display")
+    parser.add_argument("output", help="image file to save")
+    parser.add_argument("--port", type=int, default=SERVER_PORT)
+    parser.add_argument("--uart", metavar="CAPTURE", help="decode a debug UART capture")
+    args = parser.parse_args()
+
+    if args.uart:
+        with open(args.uart, "rb") as f:
+            f = io.BufferedReader(io.BytesIO(f.read()))
+            width, height = read_header(f)
+            data = read_blocks(f)
+    elif args.host:
+        width, height, data = fetch(args.host, args.port)
+    else:
+        parser.error("a host or --uart is needed")
+
+    save(args.output, decompress(data, width, height), width, height)
+    print("%s: %dx%d, %d bytes compressed" % (args.output, width, height, len(data)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
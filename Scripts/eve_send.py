@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Send images, video or display frames to the EVE display over TCP.
+
+at_monitor listens on port 8080 of the ESP32. A client sends the line
+"IMAGE <length>" or "VIDEO <length>" followed by the file and receives one
+result line, such as "IMAGE OK" or "VIDEO OK 250 frames 24.8 fps 0
+underruns". Images are JPEG or PNG files. Videos are AVI files with
+motion JPEG frames.
+
+    python3 Scripts/eve_send.py 192.168.1.20 photo.jpg
+    python3 Scripts/eve_send.py 192.168.1.20 clip.avi --rate 200000 --jitter 0.2
+
+--rate limits the bytes sent a second and --jitter adds random pauses of
+up to that many seconds to test playback through a slow network.
+
+With --display each file is sent as one frame of co-processor commands
+for the remote display. The files hold little-endian command words, such
+as a CMD_DLSTART to CMD_SWAP sequence, and are a multiple of 4 bytes.
+The display sends "ACK <frame>" when each one has been drawn. A frame
+which ends part way through a command, or holds a command with data of
+unknown length such as CMD_INFLATE, is refused with "ERROR -2" and the
+commands before it are drawn. Images can be written to a media FIFO with
+CMD_MEMWRITE and decoded by CMD_LOADIMAGE with OPT_MEDIAFIFO.
+
+    python3 Scripts/eve_send.py 192.168.1.20 --display frame1.bin frame2.bin
+
+An AVI file can be made from a list of baseline JPEG files of the same
+size, which will be played in order. Requires Pillow to read the sizes.
+
+    python3 Scripts/eve_send.py --make-avi clip.avi --fps 25 frame*.jpg
+"""
+
+import argparse
+import os
+import random
+import socket
+import struct
+import sys
+import time
+
+SERVER_PORT = 8080
+CHUNK = 1024
+
+# AVI main header flag: the file has an idx1 index.
+AVIF_HASINDEX = 0x10
+# Index entry flag: the frame is a key frame.
+AVIIF_KEYFRAME = 0x10
+
+
+def chunk(fourcc, data):
+    """Return a RIFF chunk padded to an even length."""
+    pad = b"\0" if len(data) & 1 else b""
+    return fourcc + struct.pack("<I", len(data)) + data + pad
+
+
+def riff_list(fourcc, form, data):
+    """Return a RIFF or LIST chunk of the given form type."""
+    return chunk(fourcc, form + data)
+
+
+def make_avi(frames, fps):
+    """Return an MJPEG AVI file from a list of JPEG files."""
+    from PIL import Image
+
+    width, height = Image.open(frames[0]).size
+    data = []
+    for path in frames:
+        with open(path, "rb") as f:
+            data.append(f.read())
+        if Image.open(path).size != (width, height):
+            raise ValueError("%s: frames must be the same size" % path)
+
+    biggest = max(len(d) for d in data)
+    avih = struct.pack("<10I4I", int(1000000 / fps), biggest * fps, 0,
+                       AVIF_HASINDEX, len(data), 0, 1, biggest,
+                       width, height, 0, 0, 0, 0)
+    strh = (b"vidsMJPG" + struct.pack("<IHHIIIIIIiI4h", 0, 0, 0, 0, 1, fps,
+                                      0, len(data), biggest, -1, 0,
+                                      0, 0, width, height))
+    strf = struct.pack("<IiiHH4sIiiII", 40, width, height, 1, 24, b"MJPG",
+                       width * height * 3, 0, 0, 0, 0)
+    hdrl = riff_list(b"LIST", b"hdrl", chunk(b"avih", avih)
+                     + riff_list(b"LIST", b"strl", chunk(b"strh", strh)
+                                 + chunk(b"strf", strf)))
+
+    movi = b""
+    index = b""
+    for d in data:
+        # Offsets are from the movi form type.
+        index += b"00dc" + struct.pack("<III", AVIIF_KEYFRAME, 4 + len(movi), len(d))
+        movi += chunk(b"00dc", d)
+
+    return riff_list(b"RIFF", b"AVI ", hdrl + riff_list(b"LIST", b"movi", movi)
+                     + chunk(b"idx1", index))
+
+
+def send(host, port, path, rate, jitter):
+    """Send a file and return the result line from the display."""
+    with open(path, "rb") as f:
+        data = f.read()
+    command = b"VIDEO" if path.lower().endswith(".avi") else b"IMAGE"
+
+    with socket.create_connection((host, port)) as s:
+        s.sendall(b"%s %d\n" % (command, len(data)))
+        start = time.time()
+        for i in range(0, len(data), CHUNK):
+            s.sendall(data[i:i + CHUNK])
+            if rate:
+                # Hold back to the requested average rate.
+                delay = (i + CHUNK) / rate - (time.time() - start)
+                if delay > 0:
+                    time.sleep(delay)
+            if jitter and random.random() < 0.05:
+                time.sleep(random.uniform(0, jitter))
+        sent = time.time() - start
+
+        reply = readline(s)
+
+    print("%d bytes sent in %.2f s" % (len(data), sent))
+    return reply
+
+
+def readline(s):
+    """Return one line received from the display."""
+    line = b""
+    while not line.endswith(b"\n"):
+        more = s.recv(1)
+        if not more:
+            break
+        line += more
+    return line.decode("ascii", "replace").strip()
+
+
+def display(host, port, paths):
+    """Send each file as a remote display frame and wait for the ack."""
+    with socket.create_connection((host, port)) as s:
+        s.sendall(b"DISPLAY\n")
+        print(readline(s))
+        for path in paths:
+            with open(path, "rb") as f:
+                data = f.read()
+            s.sendall(b"DISPLAY %d\n" % len(data) + data)
+            print("%s: %s" % (os.path.basename(path), readline(s)))
+        s.sendall(b"DISPLAY END\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("host", nargs="?", help="address of the display")
+    parser.add_argument("files", nargs="+", help="files to send or JPEG frames")
+    parser.add_argument("--port", type=int, default=SERVER_PORT)
+    parser.add_argument("--rate", type=float, default=0, help="bytes a second")
+    parser.add_argument("--jitter", type=float, default=0, help="longest pause in seconds")
+    parser.add_argument("--make-avi", metavar="AVI", help="write an AVI file from JPEG frames")
+    parser.add_argument("--fps", type=int, default=25)
+    parser.add_argument("--display", action="store_true",
+                        help="send the files as remote display frames")
+    args = parser.parse_intermixed_args()
+
+    if args.make_avi:
+        # The host argument is the first frame.
+        frames = ([args.host] if args.host else []) + args.files
+        with open(args.make_avi, "wb") as f:
+            f.write(make_avi(frames, args.fps))
+        print("%s: %d frames" % (args.make_avi, len(frames)))
+        return 0
+
+    if args.display:
+        display(args.host, args.port, args.files)
+        return 0
+
+    for path in args.files:
+        print("%s: %s" % (os.path.basename(path),
+                          send(args.host, args.port, path, args.rate, args.jitter)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,481 @@
+#!/usr/bin/env python3
+"""Decode an EVE SPI transaction trace.
+
+The EVE library records every chip select cycle when it is built with
+EVE_SPI_TRACE (add EVE_SPI_TRACE_DATA to record the bytes as well).
+eve_monitor prints the trace to the UART as "TRACE" lines. Capture the
+UART output to a file and run:
+
+    python3 Scripts/eve_trace.py uart.log
+
+The co-processor commands written to RAM_CMD are decoded into readable
+commands and display list instructions, followed by the number of SPI
+transactions and bytes used for each frame. A frame ends when REG_CMD_WRITE
+is updated after a CMD_SWAP. Without EVE_SPI_TRACE_DATA only the totals for
+each trace dump are shown.
+
+Traces recorded by the host simulator (lib/eve/eve_arch_host) are binary
+files of the same records. Decode them with --binary. Save the output of a
+known good run and pass it with --golden to report any change to the
+command stream or to the bytes sent for each frame.
+
+Names are read from the FT81x section of lib/eve/include/FT8xx.h.
+"""
+
+import argparse
+import difflib
+import io
+import os
+import re
+import struct
+import sys
+import zlib
+
+# Record types. See HAL.h.
+TRACE_READ = 0
+TRACE_WRITE = 1
+TRACE_HOST = 2
+TRACE_STREAM = 3
+
+TYPE_NAMES = {
+    TRACE_READ: "read",
+    TRACE_WRITE: "write",
+    TRACE_HOST: "host",
+    TRACE_STREAM: "stream",
+}
+
+# Bytes sent before the data in each chip select cycle: 3 address bytes
+# for a write, 3 address bytes and a dummy byte for a read, 3 bytes for a
+# host command.
+OVERHEAD = {
+    TRACE_READ: 4,
+    TRACE_WRITE: 3,
+    TRACE_HOST: 3,
+    TRACE_STREAM: 3,
+}
+
+FT_CMD_FIFO_SIZE = 4096
+
+# Co-processor commands. Number of 32 bit parameter words and whether the
+# parameters are followed by a zero terminated string.
+CMD_ARGS = {
+    "CMD_APPEND": (2, False),
+    "CMD_BGCOLOR": (1, False),
+    "CMD_BITMAP_TRANSFORM": (13, False),
+    "CMD_BUTTON": (3, True),
+    "CMD_CALIBRATE": (1, False),
+    "CMD_CLOCK": (4, False),
+    "CMD_COLDSTART": (0, False),
+    "CMD_CSKETCH": (5, False),
+    "CMD_DIAL": (3, False),
+    "CMD_DLSTART": (0, False),
+    "CMD_FGCOLOR": (1, False),
+    "CMD_GAUGE": (4, False),
+    "CMD_GETMATRIX": (6, False),
+    "CMD_GETPROPS": (3, False),
+    "CMD_GETPTR": (1, False),
+    "CMD_GRADCOLOR": (1, False),
+    "CMD_GRADIENT": (4, False),
+    "CMD_INFLATE": (1, False),
+    "CMD_INTERRUPT": (1, False),
+    "CMD_KEYS": (3, True),
+    "CMD_LOADIDENTITY": (0, False),
+    "CMD_LOADIMAGE": (2, False),
+    "CMD_LOGO": (0, False),
+    "CMD_MEDIAFIFO": (2, False),
+    "CMD_MEMCPY": (3, False),
+    "CMD_MEMCRC": (3, False),
+    "CMD_MEMSET": (3, False),
+    "CMD_MEMWRITE": (2, False),
+    "CMD_MEMZERO": (2, False),
+    "CMD_NUMBER": (3, False),
+    "CMD_PLAYVIDEO": (1, False),
+    "CMD_PROGRESS": (4, False),
+    "CMD_REGREAD": (2, False),
+    "CMD_ROMFONT": (2, False),
+    "CMD_ROTATE": (1, False),
+    "CMD_SCALE": (2, False),
+    "CMD_SCREENSAVER": (0, False),
+    "CMD_SCROLLBAR": (4, False),
+    "CMD_SETBASE": (1, False),
+    "CMD_SETBITMAP": (3, False),
+    "CMD_SETFONT": (2, False),
+    "CMD_SETFONT2": (3, False),
+    "CMD_SETMATRIX": (0, False),
+    "CMD_SETROTATE": (1, False),
+    "CMD_SETSCRATCH": (1, False),
+    "CMD_SKETCH": (4, False),
+    "CMD_SLIDER": (4, False),
+    "CMD_SNAPSHOT": (1, False),
+    "CMD_SNAPSHOT2": (4, False),
+    "CMD_SPINNER": (2, False),
+    "CMD_STOP": (0, False),
+    "CMD_SWAP": (0, False),
+    "CMD_SYNC": (0, False),
+    "CMD_TEXT": (2, True),
+    "CMD_TOGGLE": (3, True),
+    "CMD_TRACK": (3, False),
+    "CMD_TRANSLATE": (2, False),
+    "CMD_VIDEOFRAME": (2, False),
+    "CMD_VIDEOSTART": (0, False),
+}
+
+
+class Names(object):
+    """Constants and display list encodings from FT8xx.h."""
+
+    def __init__(self, path):
+        with open(path) as f:
+            text = f.read()
+
+        # The FT81x definitions follow the #else of the FT80x section.
+        start = text.find("\n#else")
+        if start < 0:
+            raise ValueError("%s: FT81x section not found" % path)
+        text = text[start:]
+
+        self.commands = {}
+        self.registers = {}
+        self.memory = {}
+        # Display list opcode (bits 31-24) to (name, [(field, mask, shift)]).
+        self.dl = {}
+
+        value = re.compile(r"^#define\s+((CMD|REG|RAM)_\w+)\s+(0x[0-9a-fA-F]+)\s*$")
+        macro = re.compile(r"^#define\s+(\w+)\(([\w,]*)\)\s+\(\((0x[0-9a-fA-F]+)\s*<<\s*(\d+)\)(.*)\)\s*$")
+        field = re.compile(r"\(\(\((\w+)\)\s*&\s*(\w+)\)\s*<<\s*(\d+)\)")
+
+        for line in text.splitlines():
+            m = value.match(line)
+            if m:
+                name, kind, number = m.group(1), m.group(2), int(m.group(3), 16)
+                if kind == "CMD":
+                    self.commands[number] = name
+                elif kind == "REG":
+                    self.registers[number] = name
+                elif name != "RAM_G_SIZE":
+                    self.memory[name] = number
+                continue
+
+            m = macro.match(line)
+            if m:
+                name = m.group(1)
+                opcode = int(m.group(3), 16)
+                shift = int(m.group(4))
+                fields = [(f[0], int(f[1].rstrip("UL"), 0), int(f[2]))
+                          for f in field.findall(m.group(5))]
+                # Some masks in the header are wider than the field, e.g.
+                # VERTEX2F. Limit each field to the bits below the next one.
+                top = 30 if shift == 30 else 24
+                for i, (arg, mask, at) in enumerate(fields):
+                    above = [f[2] for f in fields if f[2] > at] + [top]
+                    fields[i] = (arg, mask & ((1 << (min(above) - at)) - 1), at)
+                if shift == 30:
+                    # VERTEX2F and VERTEX2II use the top two bits.
+                    self.dl[("vertex", opcode)] = (name, fields)
+                elif shift == 24 and not name.endswith("_RGB") and opcode not in self.dl:
+                    self.dl[opcode] = (name, fields)
+                elif shift == 24 and name.endswith("_RGB"):
+                    # Prefer COLOR_RGB(r,g,b) over COLOR(c).
+                    self.dl[opcode] = (name, fields)
+
+    def region(self, address):
+        """Return a readable name for an EVE memory address."""
+        if address in self.registers:
+            return self.registers[address]
+        best = None
+        for name, base in self.memory.items():
+            if base <= address and (best is None or base > best[1]):
+                best = (name, base)
+        if best is None:
+            return "0x%06x" % address
+        if address == best[1]:
+            return best[0]
+        return "%s+0x%x" % (best[0], address - best[1])
+
+    def display_list(self, word):
+        """Decode a display list instruction."""
+        top = word >> 30
+        if top:
+            name, fields = self.dl.get(("vertex", top), ("VERTEX?", []))
+        else:
+            name, fields = self.dl.get(word >> 24, (None, []))
+            if name is None:
+                return "DL? 0x%08x" % word
+        args = []
+        for arg, mask, shift in fields:
+            value = (word >> shift) & mask
+            # Coordinates and translations are signed.
+            if arg in ("x", "y") and name.startswith(("VERTEX2F", "VERTEX_TRANSLATE")):
+                bits = mask.bit_length()
+                if value & (1 << (bits - 1)):
+                    value -= 1 << bits
+            args.append("%d" % value if value < 0x10000 else "0x%x" % value)
+        return "%s(%s)" % (name, ",".join(args))
+
+
+def parse_log(path):
+    """Return the trace dumps in a UART log as (data, lost) tuples."""
+    dumps = []
+    data = bytearray()
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            i = line.find("TRACE ")
+            if i < 0:
+                continue
+            line = line[i + 6:].strip()
+            if line.startswith("END"):
+                lost = int(line[3:].strip() or "0")
+                dumps.append((bytes(data), lost))
+                data = bytearray()
+            else:
+                data += bytes.fromhex(line)
+    if data:
+        dumps.append((bytes(data), 0))
+    return dumps
+
+
+def parse_records(data):
+    """Split a trace dump into (type, address, length, bytes) records."""
+    records = []
+    i = 0
+    while i + 12 <= len(data):
+        word0, length, recorded = struct.unpack_from("<III", data, i)
+        i += 12
+        records.append((word0 >> 24, word0 & 0xffffff, length, data[i:i + recorded]))
+        i += recorded
+        i = (i + 3) & ~3
+    return records
+
+
+class Decoder(object):
+    """Decode the co-processor command stream written to RAM_CMD."""
+
+    def __init__(self, names, out):
+        self.names = names
+        self.out = out
+        self.stream = bytearray()
+        self.swap = False
+        # Set when the data for the pending command was streamed separately.
+        self.streamed = False
+
+    def add(self, data):
+        """Add data written to RAM_CMD and decode complete commands."""
+        self.stream += data
+        while True:
+            used = self.decode()
+            if used == 0:
+                break
+            del self.stream[:used]
+
+    def stream_data(self, length):
+        """Data for a command was streamed in its own SPI transaction."""
+        self.streamed = True
+        self.add(b"")
+        self.streamed = False
+        self.out.write("    <%d bytes streamed>\n" % length)
+
+    def data_length(self, name, args, data):
+        """Return the length of the data following a command, or None if
+        the data is not complete."""
+        if self.streamed:
+            return 0
+        if name == "CMD_INFLATE":
+            z = zlib.decompressobj()
+            try:
+                z.decompress(data)
+            except zlib.error:
+                return len(data)
+            if not z.eof:
+                return None
+            return len(data) - len(z.unused_data)
+        if name == "CMD_LOADIMAGE":
+            if args[1] & 0x10:
+                # OPT_MEDIAFIFO
+                return 0
+            if data[:1] == b"\x89":
+                end = data.find(b"IEND")
+                return end + 8 if end >= 0 and len(data) >= end + 8 else None
+            end = data.find(b"\xff\xd9")
+            return end + 2 if end >= 0 else None
+        return 0
+
+    def decode(self):
+        """Decode one command. Returns bytes used or 0 if incomplete."""
+        s = self.stream
+        if len(s) < 4:
+            return 0
+        word = struct.unpack_from("<I", s, 0)[0]
+        name = self.names.commands.get(word)
+        if name is None:
+            self.out.write("    %s\n" % self.names.display_list(word))
+            return 4
+
+        count, string = CMD_ARGS.get(name, (0, False))
+        used = 4 + count * 4
+        if len(s) < used:
+            return 0
+        args = list(struct.unpack_from("<%dI" % count, s, 4))
+        text = ""
+        if string:
+            end = s.find(b"\0", used)
+            if end < 0:
+                return 0
+            text = bytes(s[used:end]).decode("latin-1")
+            used = (end + 1 + 3) & ~3
+            if len(s) < used:
+                return 0
+        if name == "CMD_MEMWRITE":
+            size = (args[1] + 3) & ~3
+            if len(s) < used + size:
+                return 0
+            used += size
+        data = self.data_length(name, args, bytes(s[used:]))
+        if data is None:
+            return 0
+        data = (data + 3) & ~3
+        if len(s) < used + data:
+            return 0
+        used += data
+
+        if name in ("CMD_TEXT", "CMD_BUTTON", "CMD_KEYS", "CMD_TOGGLE", "CMD_NUMBER"):
+            # Parameters are 16 bit values.
+            halves = []
+            for a in args:
+                halves += [a & 0xffff, a >> 16]
+            desc = ",".join("%d" % struct.unpack("<h", struct.pack("<H", h))[0] for h in halves)
+            if string:
+                desc += ',"%s"' % text
+        elif name == "CMD_MEMWRITE":
+            desc = "%s,%d" % (self.names.region(args[0]), args[1])
+        elif name in ("CMD_MEMCPY", "CMD_MEMSET", "CMD_MEMZERO", "CMD_APPEND",
+                      "CMD_INFLATE", "CMD_LOADIMAGE", "CMD_MEDIAFIFO"):
+            desc = ",".join([self.names.region(args[0])] + ["%d" % a for a in args[1:]])
+        else:
+            desc = ",".join("0x%x" % a if a > 0xffff else "%d" % a for a in args)
+        self.out.write("  %s(%s)\n" % (name, desc))
+        if data:
+            self.out.write("    <%d bytes data>\n" % data)
+        if name == "CMD_SWAP":
+            self.swap = True
+        return used
+
+
+class Stats(object):
+    """SPI transactions and bytes by record type."""
+
+    def __init__(self):
+        self.count = dict((t, 0) for t in TYPE_NAMES)
+        self.bytes = dict((t, 0) for t in TYPE_NAMES)
+
+    def add(self, kind, length):
+        self.count[kind] = self.count.get(kind, 0) + 1
+        self.bytes[kind] = self.bytes.get(kind, 0) + OVERHEAD.get(kind, 3) + length
+
+    def report(self, title, out):
+        total_count = sum(self.count.values())
+        total_bytes = sum(self.bytes.values())
+        parts = ["%s %d/%d" % (TYPE_NAMES[t], self.count[t], self.bytes[t])
+                 for t in sorted(TYPE_NAMES) if self.count[t]]
+        out.write("%s: %d transactions %d bytes (%s)\n"
+                  % (title, total_count, total_bytes, ", ".join(parts)))
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    parser = argparse.ArgumentParser(description="Decode an EVE SPI trace.")
+    parser.add_argument("log", help="UART log containing TRACE lines")
+    parser.add_argument("--binary", action="store_true",
+                        help="log is a binary trace from the host simulator")
+    parser.add_argument("--golden", help="compare the output with this file")
+    parser.add_argument("--header", default=os.path.join(root, "lib", "eve", "include", "FT8xx.h"),
+                        help="FT8xx.h to read names from")
+    parser.add_argument("--summary", action="store_true",
+                        help="only print per-frame byte counts")
+    args = parser.parse_args()
+
+    names = Names(args.header)
+    ram_cmd = names.memory["RAM_CMD"]
+    reg_cmd_write = [a for a, n in names.registers.items() if n == "REG_CMD_WRITE"][0]
+    out = io.StringIO() if args.golden else sys.stdout
+    quiet = open(os.devnull, "w") if args.summary else out
+
+    if args.binary:
+        with open(args.log, "rb") as f:
+            dumps = [(f.read(), 0)]
+    else:
+        dumps = parse_log(args.log)
+    if not dumps:
+        sys.stderr.write("%s: no trace found\n" % args.log)
+        return 1
+
+    decoder = Decoder(names, quiet)
+    frame = 0
+    frame_stats = Stats()
+    repeat_line = None
+    repeat = 0
+    for number, (data, lost) in enumerate(dumps):
+        dump_stats = Stats()
+        have_data = False
+        for kind, address, length, recorded in parse_records(data):
+            dump_stats.add(kind, length)
+            frame_stats.add(kind, length)
+            if recorded:
+                have_data = True
+
+            line = None
+            if kind == TRACE_WRITE and ram_cmd <= address < ram_cmd + FT_CMD_FIFO_SIZE:
+                pass
+            elif kind == TRACE_WRITE and address == reg_cmd_write and decoder.swap:
+                pass
+            elif kind in (TRACE_READ, TRACE_WRITE):
+                value = ""
+                if recorded and len(recorded) <= 4:
+                    value = " = 0x%x" % int.from_bytes(recorded, "little")
+                line = "%s %s %d%s" % (TYPE_NAMES[kind], names.region(address), length, value)
+
+            # Polling loops repeat the same access many times.
+            if line is not None and line == repeat_line:
+                repeat += 1
+                continue
+            if repeat:
+                quiet.write("  (repeated %d times)\n" % repeat)
+            repeat_line = line
+            repeat = 0
+
+            if kind == TRACE_HOST:
+                quiet.write("host 0x%02x 0x%02x\n" % (address & 0xff, (address >> 8) & 0xff))
+            elif kind == TRACE_STREAM:
+                decoder.stream_data(length)
+            elif line is not None:
+                quiet.write(line + "\n")
+            elif address != reg_cmd_write:
+                if recorded:
+                    decoder.add(recorded)
+            else:
+                # The co-processor starts the frame when the write pointer moves.
+                decoder.swap = False
+                frame_stats.report("frame %d" % frame, out)
+                frame += 1
+                frame_stats = Stats()
+
+        if not have_data:
+            dump_stats.report("dump %d" % number, out)
+        if lost:
+            out.write("dump %d: %d records lost, increase EVE_SPI_TRACE_SIZE\n" % (number, lost))
+    if repeat:
+        quiet.write("  (repeated %d times)\n" % repeat)
+
+    if args.golden:
+        with open(args.golden) as f:
+            expected = f.read().splitlines(True)
+        diff = list(difflib.unified_diff(expected, out.getvalue().splitlines(True),
+                                         args.golden, args.log))
+        sys.stdout.writelines(diff)
+        return 1 if diff else 0
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,121 @@
+/**
+  @file main.c
+  @brief Host simulator test driver
+  Runs eve_ui screens against the simulated FT81x in lib/eve/eve_arch_host.
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+// Built by Scripts/host/Makefile. Each touch script in this directory is
+// run with the trace enabled and the decoded trace compared with the
+// golden file of the same name. See the Makefile for the targets.
+
+// Guard against being used for incorrect CPU type.
+#ifndef __FT32__
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+#include "MCU.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Longest wait for a touch event in simulated milliseconds.
+ @details Matches EVE_TOUCH_WAIT_MS in Sources/eve_monitor.c.
+ */
+#define TOUCH_WAIT_MS 100
+
+/* LOCAL VARIABLES *****************************************************************/
+
+static volatile uint8_t touch_flag = 0;
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static void touch_notify(void)
+{
+	touch_flag = 1;
+}
+
+static void touch_wait(void)
+{
+	uint32_t ms;
+
+	// Simulated time moves on without SPI traffic until the touch script
+	// raises INT_N, as the firmware blocks on a semaphore.
+	for (ms = 0; (ms < TOUCH_WAIT_MS) && (!touch_flag); ms += 20)
+	{
+		MCU_Delay_20ms();
+	}
+	touch_flag = 0;
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int main(void)
+{
+	char buffer[32] = "";
+	char *list[] = {"alpha", "beta", "gamma"};
+	uint16_t result;
+
+	EVE_Init();
+	eve_ui_arch_flash_calib_init();
+	eve_ui_calibrate();
+	eve_ui_load_images();
+	eve_ui_splash("Ready.", 0);
+	eve_ui_touch_int_init(touch_notify, touch_wait);
+
+	// The touch script ends the program when it has no more events.
+	result = eve_ui_present_list("Pick", EVE_HEADER_LOGO, list, 3);
+	printf("choice %d\n", result);
+
+	result = eve_ui_keyboard_line_input("Type", EVE_HEADER_SAVE_BUTTON, buffer, sizeof(buffer));
+	printf("input %d '%s'\n", result, buffer);
+
+	return 0;
+}
+
+#endif /* __FT32__ */
@@ -0,0 +1,156 @@
+/**
+  @file spi_count.c
+  @brief SPI traffic for a keyboard screen
+  Draws a keyboard screen with the EVE library alone so that it can also
+  be built against older versions of the library for comparison.
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+// Built by Scripts/host/Makefile. Run with EVE_HOST_SCREENS set, the
+// simulator reports the SPI transactions and driver calls for each screen.
+// The screen is drawn in the same way as eve_ui_keyboard.c: one button
+// with its own colour and tag for each key. Only EVE library functions
+// which have not changed their arguments are used.
+
+// Guard against being used for incorrect CPU type.
+#ifndef __FT32__
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+/* CONSTANTS ***********************************************************************/
+
+#define KEY_WIDTH (EVE_DISP_WIDTH / 15)
+#define KEY_HEIGHT (EVE_DISP_HEIGHT / 10)
+#define KEY_FONT 27
+#define KEY_TAG_BASE 4
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static uint8_t draw_row(int16_t x, int16_t y, const char *keys, uint8_t tag, uint8_t highlight)
+{
+	char str[2] = {0, 0};
+	int i;
+
+	for (i = 0; keys[i]; i++, tag++)
+	{
+		EVE_CMD_FGCOLOR((tag == highlight) ? 0x0000ff : 0x404040);
+		EVE_TAG(tag);
+		str[0] = keys[i];
+		EVE_CMD_BUTTON(x + (i * KEY_WIDTH), y, KEY_WIDTH - 2, KEY_HEIGHT - 2,
+				KEY_FONT, OPT_FLAT, str);
+	}
+
+	return tag;
+}
+
+static void draw_screen(uint8_t highlight)
+{
+	static const char *function_keys[] = {"Esc", "F1", "F2", "F3", "F4", "F5", "F6",
+			"F7", "F8", "F9", "F10", "F11", "F12", "Del"};
+	uint8_t tag = KEY_TAG_BASE;
+	int i;
+
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_DLSTART();
+	EVE_CLEAR_COLOR_RGB(0, 0, 0);
+	EVE_CLEAR(1, 1, 1);
+	EVE_COLOR_RGB(255, 255, 255);
+	EVE_CMD_BGCOLOR(0x202020);
+
+	// Header bar and edit box.
+	EVE_TAG(0);
+	EVE_BEGIN(RECTS);
+	EVE_COLOR_RGB(0, 0, 128);
+	EVE_VERTEX2F(0, 0);
+	EVE_VERTEX2F(EVE_DISP_WIDTH * 16, KEY_HEIGHT * 16);
+	EVE_COLOR_RGB(64, 64, 64);
+	EVE_VERTEX2F(KEY_WIDTH * 16, KEY_HEIGHT * 2 * 16);
+	EVE_VERTEX2F((EVE_DISP_WIDTH - KEY_WIDTH) * 16, KEY_HEIGHT * 3 * 16);
+	EVE_END();
+	EVE_COLOR_RGB(255, 255, 255);
+	EVE_CMD_TEXT(KEY_WIDTH, KEY_HEIGHT / 2, KEY_FONT, OPT_CENTERY, "Enter text");
+	EVE_CMD_TEXT(KEY_WIDTH + 4, KEY_HEIGHT * 5 / 2, KEY_FONT, OPT_CENTERY, "hello");
+
+	for (i = 0; i < 14; i++, tag++)
+	{
+		EVE_CMD_FGCOLOR((tag == highlight) ? 0x0000ff : 0x202020);
+		EVE_TAG(tag);
+		EVE_CMD_BUTTON(i * KEY_WIDTH, KEY_HEIGHT * 4, KEY_WIDTH - 2, KEY_HEIGHT - 2,
+				KEY_FONT - 1, OPT_FLAT, function_keys[i]);
+	}
+	tag = draw_row(0, KEY_HEIGHT * 5, "`1234567890-=", tag, highlight);
+	tag = draw_row(KEY_WIDTH * 3 / 2, KEY_HEIGHT * 6, "qwertyuiop[]\\", tag, highlight);
+	tag = draw_row(KEY_WIDTH * 7 / 4, KEY_HEIGHT * 7, "asdfghjkl;'", tag, highlight);
+	tag = draw_row(KEY_WIDTH * 9 / 4, KEY_HEIGHT * 8, "zxcvbnm,./", tag, highlight);
+
+	EVE_CMD_FGCOLOR(0x202020);
+	EVE_TAG(tag);
+	EVE_CMD_BUTTON(KEY_WIDTH * 4, KEY_HEIGHT * 9, KEY_WIDTH * 7, KEY_HEIGHT - 2,
+			KEY_FONT, OPT_FLAT, "Space");
+
+	EVE_DISPLAY();
+	EVE_CMD_SWAP();
+	EVE_LIB_EndCoProList();
+	EVE_LIB_AwaitCoProEmpty();
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int main(void)
+{
+	EVE_Init();
+
+	// The keyboard, then a key press, then the key release.
+	draw_screen(0);
+	draw_screen(KEY_TAG_BASE + 20);
+	draw_screen(0);
+
+	return 0;
+}
+
+#endif /* __FT32__ */
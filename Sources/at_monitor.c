@@ -43,6 +43,7 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
@@ -56,6 +57,7 @@
 
 #include "uartrb.h"
 #include "at.h"
+#include "at_frame.h"
 
 #include "messages.h"
 
@@ -71,9 +73,18 @@
 #define STATE_NO_AP 1
 #define STATE_AP 2
 #define STATE_LISTEN 3
+#define STATE_RECONNECT 4
 
 #define ACTION_NONE 0
 #define ACTION_SETTINGS 1
+#define ACTION_RECONNECT 2
+
+/* Reconnect retry delay in milliseconds. This is doubled after each
+ * failed attempt up to the maximum. */
+#define RECONNECT_BACKOFF_MIN 100
+#define RECONNECT_BACKOFF_MAX 30000
+/* Time to wait for DHCP after reconnecting in milliseconds. */
+#define RECONNECT_DHCP_TIMEOUT 5000
 
 enum at_enable dhcp_enable;
 enum at_enable ap_connected;
@@ -102,6 +113,7 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig);
 static int8_t start_server(struct eve_setup_s *qconfig, int16_t port, int timeout);
 static int8_t stop_server(struct eve_setup_s *qconfig);
 static int8_t listen(struct eve_setup_s *qconfig);
+static int8_t reconnect(struct eve_setup_s *qconfig);
 
 /**
  * @brief Structure to receive IPD data from the AT commands.
@@ -117,6 +129,135 @@ static struct {
 } ipd[IPD_CONCURRENT_REQUESTS];
 //@}
 
+/**
+ * @brief Access points found by a Wi-Fi scan.
+ * @details Filled in by scan_callback as each access point is received
+ * 		from the AT firmware and kept ordered by RSSI, strongest first.
+ * 		The list is copied into a choose list message so that it can be
+ * 		shown on the display as it grows. Only one copy is sent at a time
+ * 		so the display task can read it while the scan continues.
+ */
+//@{
+#define SCAN_MAX_AP 10
+struct scan_s {
+	struct eve_setup_s *qconfig;
+	struct {
+		struct at2eve_msg_data_choose_s body;
+		char *list[SCAN_MAX_AP]; // Extra storage for array of buffer pointers.
+	} choose_msg;
+	int found;
+	int strength[SCAN_MAX_AP];
+	char ssid[SCAN_MAX_AP][AT_MAX_SSID];
+	char shown[SCAN_MAX_AP][AT_MAX_SSID];
+	int8_t preview_pending;
+};
+//@}
+
+/**
+ * @brief Access point last joined.
+ * @details Cached when an access point is joined from the settings screen
+ * 		so that the reconnect manager can rejoin by BSSID without a scan
+ * 		or a choice from the operator. The channel is for reporting only
+ * 		as the AT firmware does not accept it in AT+CWJAP.
+ * 		When the module has joined an access point by itself at power on
+ * 		the password is not known, so the access point saved in the
+ * 		module is rejoined instead.
+ */
+//@{
+static struct {
+	int8_t valid;
+	int8_t saved; // The password is not known
+	struct at_set_cwjap_s cwjap;
+	int channel;
+} reconnect_ap;
+//@}
+
+/**
+ * @brief Per-link message reassembly buffers.
+ * @details IPD data is split into newline terminated messages by at_frame
+ * 		so that a message is only shown once it is complete, however it was
+ * 		split into IPD packets. Messages longer than a buffer are discarded.
+ */
+//@{
+#define FRAME_BUFFER_SIZE 512
+static uint8_t frame_buffer[AT_LINK_ID_COUNT][FRAME_BUFFER_SIZE];
+//@}
+
+/**
+ * @brief Image and video upload from a client.
+ * @details A client sends the line "IMAGE <length>" followed by length bytes
+ * 		of a JPEG or PNG file, or "VIDEO <length>" followed by an MJPEG AVI
+ * 		file. The file is passed from the IPD buffers to the EVE task as it
+ * 		arrives and decoded from the media FIFO, so it is never held in full.
+ * 		The client is sent "IMAGE OK", "VIDEO OK" with playback statistics or
+ * 		"ERROR <n>" when the upload is finished. There is one upload at a time.
+ */
+//@{
+#define IMAGE_COMMAND "IMAGE "
+#define VIDEO_COMMAND "VIDEO "
+#define UPLOAD_IMAGE 0
+#define UPLOAD_VIDEO 1
+#define UPLOAD_DISPLAY 2
+static struct {
+	int8_t link_id; // -1 when there is no upload
+	uint8_t type;
+	uint8_t sent; // Data has been passed to the EVE task
+	uint32_t length;
+	uint32_t left;
+	int8_t err;
+	TickType_t start;
+} upload = {-1, 0, 0, 0, 0, 0, 0};
+//@}
+
+/**
+ * @brief Remote display client.
+ * @details A client sends "DISPLAY" to take over the screen and is sent
+ * 		"DISPLAY <address> <size> <width> <height>" with an area of RAM_G it
+ * 		may use. Each frame of co-processor commands is then sent as
+ * 		"DISPLAY <length>" followed by length bytes, a multiple of 4. The
+ * 		frame is written from the IPD buffers straight to RAM_CMD and the
+ * 		client is sent "ACK <frame>" when the co-processor has finished it
+ * 		or "ERROR <n>" if it faulted or did not end on a command boundary.
+ * 		"DISPLAY END" or closing the connection returns to the console.
+ */
+//@{
+#define DISPLAY_COMMAND "DISPLAY"
+#define DISPLAY_END_COMMAND "DISPLAY END"
+#define DISPLAY_FRAME_COMMAND "DISPLAY "
+#define DISPLAY_FRAME_MAX EVE_RAM_G_REMOTE_SIZE
+static struct {
+	int8_t link_id; // -1 when there is no remote display
+	uint32_t frames;
+} remote = {-1, 0};
+//@}
+
+/**
+ * @brief Screenshots for a client.
+ * @details A client sends "SCREENSHOT" and is sent the line
+ * 		"SCREENSHOT <width> <height> RGB565 RLE" or "ERROR <n>". Blocks of
+ * 		compressed pixels follow, each one after a 2 byte little-endian
+ * 		length, and a zero length ends the screenshot. The EVE task reads
+ * 		the screen from RAM_G and compresses it a block at a time as each
+ * 		one is sent.
+ */
+//@{
+#define SCREENSHOT_COMMAND "SCREENSHOT"
+#define SCREENSHOT_BLOCK 2048 // Largest AT+CIPSEND
+//@}
+
+/**
+ * @brief Messages to the EVE task for each type of upload.
+ */
+static const struct {
+	uint32_t data;
+	uint32_t end;
+	uint32_t ack;
+} upload_messages[] = {
+	{at2eve_msg_image_data, at2eve_msg_image_end, eve2at_rsp_image_ack}, // UPLOAD_IMAGE
+	{at2eve_msg_video_data, at2eve_msg_video_end, eve2at_rsp_video_ack}, // UPLOAD_VIDEO
+	{at2eve_msg_remote_data, at2eve_msg_remote_frame, eve2at_rsp_remote_ack}, // UPLOAD_DISPLAY
+};
+
 // Incoming connection
 struct at_cipstatus_s listen_cipstatus[AT_LINK_ID_COUNT];
 int8_t listen_connections[AT_LINK_ID_COUNT] = {0};
@@ -699,6 +840,9 @@ static int8_t disconnect_from_ap(struct eve_setup_s *qconfig)
 
 	console_add(qconfig, "Disconnecting from AP...");
 
+	// Do not rejoin an access point the operator has left.
+	reconnect_ap.valid = 0;
+
 	err = at_cwqap();
 	if (err != AT_OK)
 	{
@@ -710,6 +854,118 @@ static int8_t disconnect_from_ap(struct eve_setup_s *qconfig)
 	return AT_OK;
 }
 
+static void scan_list(struct scan_s *scan)
+{
+	char **entry = &scan->choose_msg.body.list;
+	int i;
+
+	for (i = 0; i < scan->found; i++)
+	{
+		strcpy(scan->shown[i], scan->ssid[i]);
+		entry[i] = scan->shown[i];
+	}
+	scan->choose_msg.body.count = scan->found;
+}
+
+static void scan_preview_wait(struct scan_s *scan, TickType_t ticks)
+{
+	struct eve2at_messages_s at_rsp;
+
+	if (scan->preview_pending)
+	{
+		if (ticks == 0)
+		{
+			if (xQueueReceive(scan->qconfig->at2eve_q, &at_rsp, 0) != pdTRUE)
+			{
+				return;
+			}
+		}
+		else
+		{
+			while (xQueueReceive(scan->qconfig->at2eve_q, &at_rsp, ticks) != pdTRUE)
+			{
+				tfp_printf(".");
+			}
+		}
+
+		if (at_rsp.command != eve2at_rsp_preview_ack)
+		{
+			tfp_printf("Sync error\r\n");
+		}
+		scan->preview_pending = 0;
+	}
+}
+
+static int8_t scan_callback(struct at_cwlap_s *cwlap, void *context)
+{
+	struct scan_s *scan = (struct scan_s *)context;
+	struct at2eve_messages_s eve_msg;
+	int i;
+
+	// Hidden access points cannot be chosen.
+	if (cwlap->ssid[0] == '\0')
+	{
+		return 0;
+	}
+
+	// Keep only the strongest access point found for an SSID.
+	for (i = 0; i < scan->found; i++)
+	{
+		if (strcmp(scan->ssid[i], cwlap->ssid) == 0)
+		{
+			if (scan->strength[i] >= cwlap->strength)
+			{
+				return 0;
+			}
+			scan->found--;
+			memmove(scan->ssid[i], scan->ssid[i + 1], (scan->found - i) * AT_MAX_SSID);
+			memmove(&scan->strength[i], &scan->strength[i + 1], (scan->found - i) * sizeof(int));
+			break;
+		}
+	}
+
+	// Insert in order of RSSI. The weakest access point is dropped when
+	// the list is full.
+	for (i = 0; i < scan->found; i++)
+	{
+		if (cwlap->strength > scan->strength[i])
+		{
+			break;
+		}
+	}
+	if (i >= SCAN_MAX_AP)
+	{
+		return 0;
+	}
+	if (scan->found == SCAN_MAX_AP)
+	{
+		scan->found--;
+	}
+	memmove(scan->ssid[i + 1], scan->ssid[i], (scan->found - i) * AT_MAX_SSID);
+	memmove(&scan->strength[i + 1], &scan->strength[i], (scan->found - i) * sizeof(int));
+	strcpy(scan->ssid[i], cwlap->ssid);
+	scan->strength[i] = cwlap->strength;
+	scan->found++;
+
+	// Show the list so far while the scan continues. This is called with
+	// the AT mutex held so it does not wait for the display. Access points
+	// found before the last list has been shown appear in the next one.
+	scan_preview_wait(scan, 0);
+	if (scan->preview_pending == 0)
+	{
+		scan_list(scan);
+
+		eve_msg.command = at2eve_msg_choose_list_preview;
+		eve_msg.dataptr = &scan->choose_msg;
+
+		xQueueSend(scan->qconfig->eve2at_q, &eve_msg, 0);
+		scan->preview_pending = 1;
+	}
+
+	// The whole scan is needed to find the strongest access points.
+	return 0;
+}
+
 static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 {
 	int8_t err;
@@ -717,7 +973,6 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 	struct at2eve_messages_s eve_msg;
 	struct eve2at_rsp_choose_s at_rsp;
 	char msg[128];
-	int8_t i;
 
 	console_start(qconfig, "Connecting to AP...", eve_option_logo);
 
@@ -761,24 +1016,40 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 	}
 	else if (err == AT_ERROR_QUERY)
 	{
-		struct {
-			struct at2eve_msg_data_choose_s body;
-			char *list[10]; // Extra storage for array of buffer pointers.
-		} choose_msg;
-
-		struct at_cwlap_s querycwlap[10];
-		int8_t querycwlap_count = 10;
+		struct scan_s scan;
 		char **entry;
 		int choice;
 
-		do
+		// Only the SSID is shown, strongest access points first. The
+		// module prints nothing until the scan ends when it sorts the
+		// results, so they are sorted here as they arrive.
+		err = at_set_cwlapopt(at_cwlap_sort_unordered,
+				at_cwlap_mask_ssid | at_cwlap_mask_strength);
+		if (err != AT_OK)
 		{
-			choice = 0;
+			sprintf(msg, "Failed to set access point list options %d", err);
+			console_add(qconfig, msg);
+		}
+
+		scan.qconfig = qconfig;
 
+		do
+		{
 			sprintf(msg, "Searching for Access Points...");
 			console_add(qconfig, msg);
 
-			err = at_cwlap(querycwlap, &querycwlap_count);
+			scan.choose_msg.body.toast = msg;
+			scan.choose_msg.body.options = eve_option_logo;
+			scan.choose_msg.body.count = 0;
+			scan.found = 0;
+			scan.preview_pending = 0;
+
+			err = at_cwlap_stream(scan_callback, &scan);
+
+			// The display may still be showing the last partial list.
+			scan_preview_wait(&scan, pdMS_TO_TICKS(5000));
+			scan_list(&scan);
+
 			if (err != AT_OK)
 			{
 				sprintf(msg, "Failed to list access points %d", err);
@@ -787,26 +1058,13 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 			}
 
 			eve_msg.command = at2eve_msg_choose_list;
-			eve_msg.dataptr = &choose_msg;
-			choose_msg.body.toast = "Choose Access Point:";
-			choose_msg.body.options = eve_option_logo
+			eve_msg.dataptr = &scan.choose_msg;
+			scan.choose_msg.body.toast = "Choose Access Point:";
+			scan.choose_msg.body.options = eve_option_logo
 					| eve_option_refresh
 					| eve_option_cancel;
 
-			entry = &choose_msg.body.list;
-
-			for (i = 0; i < querycwlap_count; i++)
-			{
-				if (querycwlap[i].ssid[0] != '\0')
-				{
-					*entry = querycwlap[i].ssid;
-					choice++;
-					entry++;
-				}
-			}
-			choose_msg.body.count = choice;
-
-			if (choose_msg.body.count == 0)
+			if (scan.choose_msg.body.count == 0)
 			{
 				sprintf(msg, "No access points found.");
 				console_add(qconfig, msg);
@@ -839,11 +1097,11 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 
 			choice = at_rsp.choice;
 
-			if ((choice >= 0) && (choice < choose_msg.body.count))
+			if ((choice >= 0) && (choice < scan.choose_msg.body.count))
 			{
 				struct at_set_cwjap_s setcwjap;
 
-				entry = &choose_msg.body.list;
+				entry = &scan.choose_msg.body.list;
 				strcpy(setcwjap.ssid, entry[choice]);
 				memset(setcwjap.bssid, 0, sizeof(setcwjap.bssid));
 
@@ -883,14 +1141,14 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 				}
 
 				enum at_enable autoconn = at_disable;
-				sprintf(msg, "Autoconnect to \"%s\": ", querycwlap[choice].ssid);
+				sprintf(msg, "Autoconnect to \"%s\": ", setcwjap.ssid);
 
 				eve_msg.command = at2eve_msg_choose_list;
-				eve_msg.dataptr = &choose_msg;
-				choose_msg.body.toast = msg;
-				choose_msg.body.count = 2;
+				eve_msg.dataptr = &scan.choose_msg;
+				scan.choose_msg.body.toast = msg;
+				scan.choose_msg.body.count = 2;
 
-				entry = &choose_msg.body.list;
+				entry = &scan.choose_msg.body.list;
 				*entry++ = "Yes";
 				*entry++ = "No";
 
@@ -942,6 +1200,20 @@ static int8_t connect_to_ap(struct eve_setup_s *qconfig)
 					strcpy(ssid, setcwjap.ssid);
 					console_add(qconfig, msg);
 
+					// Remember the access point that was joined for the
+					// reconnect manager.
+					memcpy(&reconnect_ap.cwjap, &setcwjap, sizeof(setcwjap));
+					reconnect_ap.valid = 1;
+					reconnect_ap.saved = 0;
+					if (at_query_cwjap(&curr_ap) == AT_OK)
+					{
+						strcpy(reconnect_ap.cwjap.bssid, curr_ap.bssid);
+						reconnect_ap.channel = curr_ap.channel;
+					}
+
+					// Any disconnect before this point is stale.
+					at_wifi_disconnect_event();
+
 					vTaskDelay(pdMS_TO_TICKS(100));
 					break;
 				}
@@ -1145,6 +1417,345 @@ static int8_t listen_reply(struct eve_setup_s *qconfig)
 	return err;
 }
 
+static int8_t upload_send(struct eve_setup_s *qconfig, struct at2eve_messages_s *eve_msg, uint32_t ack)
+{
+	struct eve2at_messages_s at_rsp; // For ACK response
+
+	xQueueSend(qconfig->eve2at_q, eve_msg, 0);
+
+	while (xQueueReceive(qconfig->at2eve_q, &at_rsp, pdMS_TO_TICKS(5000)) != pdTRUE)
+	{
+		tfp_printf(".");
+	}
+
+	if (at_rsp.command != ack)
+	{
+		tfp_printf("Sync error\r\n");
+		return EVE_IMAGE_ERROR_DECODE;
+	}
+
+	return (int8_t)at_rsp.value;
+}
+
+static void upload_finish(struct eve_setup_s *qconfig, int8_t complete)
+{
+	struct at2eve_messages_s eve_msg;
+	struct at2eve_msg_data_video_end_s video_end;
+	struct eve_ui_video_stats *stats = &video_end.stats;
+	uint32_t ms;
+	char msg[96];
+	int8_t err = EVE_IMAGE_OK;
+
+	// Abandon the upload if it is cut short or was rejected.
+	eve_msg.command = upload_messages[upload.type].end;
+	if (upload.type == UPLOAD_VIDEO)
+	{
+		eve_msg.dataptr = &video_end;
+		video_end.complete = (complete) && (upload.err == EVE_VIDEO_OK);
+		memset(stats, 0, sizeof(struct eve_ui_video_stats));
+	}
+	else
+	{
+		eve_msg.value = (complete) && (upload.err == EVE_IMAGE_OK);
+	}
+	// A refused display frame never reached the co-processor.
+	if ((upload.type != UPLOAD_DISPLAY) || (upload.sent))
+	{
+		err = upload_send(qconfig, &eve_msg, upload_messages[upload.type].ack);
+	}
+	if (upload.err == EVE_IMAGE_OK)
+	{
+		upload.err = err;
+	}
+
+	if (complete)
+	{
+		ms = (xTaskGetTickCount() - upload.start) * portTICK_PERIOD_MS;
+		if (upload.type == UPLOAD_DISPLAY)
+		{
+			// Frames are not reported on the console.
+			if (upload.err == EVE_REMOTE_OK)
+			{
+				sprintf(msg, "ACK %lu\n", ++remote.frames);
+			}
+			else
+			{
+				sprintf(msg, "ERROR %d\n", upload.err);
+			}
+		}
+		else if (upload.err != EVE_IMAGE_OK)
+		{
+			sprintf(msg, "Upload rejected %d.", upload.err);
+			console_add(qconfig, msg);
+			sprintf(msg, "ERROR %d\n", upload.err);
+		}
+		else if (upload.type == UPLOAD_VIDEO)
+		{
+			// Frames a second to one decimal place over the playback time.
+			ms = (stats->play_ms) ? stats->play_ms : 1;
+			sprintf(msg, "Video %lu frames %lu.%lu fps %lu underruns.",
+					stats->frames, (stats->frames * 1000) / ms, ((stats->frames * 10000) / ms) % 10,
+					stats->underruns);
+			console_add(qconfig, msg);
+			sprintf(msg, "VIDEO OK %lu frames %lu.%lu fps %lu underruns %lu min\n",
+					stats->frames, (stats->frames * 1000) / ms, ((stats->frames * 10000) / ms) % 10,
+					stats->underruns, stats->min_level);
+		}
+		else
+		{
+			sprintf(msg, "Image of %lu bytes shown in %lu ms.", upload.length, ms);
+			console_add(qconfig, msg);
+			sprintf(msg, "IMAGE OK\n");
+		}
+		at_set_cipsend(upload.link_id, strlen(msg), (uint8_t *)msg);
+	}
+
+	upload.link_id = -1;
+}
+
+static void upload_data(int8_t link_id, const uint8_t *data, uint16_t length, void *context)
+{
+	struct eve_setup_s *qconfig = (struct eve_setup_s *)context;
+	struct at2eve_messages_s eve_msg;
+	struct at2eve_msg_data_media_s body;
+
+	// Data for an upload refused as busy is discarded.
+	if (link_id != upload.link_id)
+	{
+		return;
+	}
+
+	// The IPD buffer is passed on and is not reused until the EVE task
+	// has written it to the media FIFO or RAM_CMD. While the co-processor
+	// is busy this waits for room, which holds back the sender.
+	if (upload.err == EVE_IMAGE_OK)
+	{
+		eve_msg.command = upload_messages[upload.type].data;
+		eve_msg.dataptr = &body;
+		body.data = data;
+		body.length = length;
+		body.left = upload.left - length;
+		upload.err = upload_send(qconfig, &eve_msg, upload_messages[upload.type].ack);
+		upload.sent = 1;
+	}
+
+	upload.left -= length;
+	if (upload.left == 0)
+	{
+		upload_finish(qconfig, 1);
+	}
+}
+
+static void upload_start(struct eve_setup_s *qconfig, int8_t link_id, uint32_t length, uint8_t type)
+{
+	struct at2eve_messages_s eve_msg;
+	char msg[16];
+
+	// The file or frame follows the command on the link.
+	at_frame_raw(link_id, length, upload_data);
+
+	// Display frames are only taken from the link which started the
+	// remote display and it holds the screen until it ends.
+	if ((upload.link_id != -1)
+			|| ((type == UPLOAD_DISPLAY) && (remote.link_id != link_id))
+			|| ((type != UPLOAD_DISPLAY) && (remote.link_id != -1)))
+	{
+		sprintf(msg, "BUSY\n");
+		at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+		return;
+	}
+
+	upload.link_id = link_id;
+	upload.type = type;
+	upload.sent = 0;
+	upload.length = length;
+	upload.left = length;
+	upload.start = xTaskGetTickCount();
+	upload.err = EVE_IMAGE_OK;
+
+	if (type == UPLOAD_DISPLAY)
+	{
+		// Frames hold whole words of co-processor commands.
+		if ((length & 3) || (length > DISPLAY_FRAME_MAX))
+		{
+			upload.err = EVE_REMOTE_ERROR_FRAME;
+		}
+		return;
+	}
+
+	eve_msg.command = (type == UPLOAD_VIDEO) ? at2eve_msg_video_start : at2eve_msg_image_start;
+	upload.err = upload_send(qconfig, &eve_msg, upload_messages[type].ack);
+}
+
+static void remote_start(struct eve_setup_s *qconfig, int8_t link_id)
+{
+	struct at2eve_messages_s eve_msg;
+	struct at2eve_msg_data_remote_s remote_msg;
+	char msg[64];
+	int8_t err;
+
+	if ((upload.link_id != -1) || ((remote.link_id != -1) && (remote.link_id != link_id)))
+	{
+		sprintf(msg, "BUSY\n");
+		at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+		return;
+	}
+
+	eve_msg.command = at2eve_msg_remote_start;
+	eve_msg.dataptr = &remote_msg;
+	err = upload_send(qconfig, &eve_msg, eve2at_rsp_remote_ack);
+	if (err == EVE_REMOTE_OK)
+	{
+		if (remote.link_id != link_id)
+		{
+			console_add(qconfig, "Remote display started.");
+		}
+		remote.link_id = link_id;
+		remote.frames = 0;
+		sprintf(msg, "DISPLAY %lu %lu %d %d\n", remote_msg.address, remote_msg.size,
+				remote_msg.width, remote_msg.height);
+	}
+	else
+	{
+		sprintf(msg, "ERROR %d\n", err);
+	}
+	at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+}
+
+static void remote_end(struct eve_setup_s *qconfig)
+{
+	struct at2eve_messages_s eve_msg;
+
+	if (remote.link_id == -1)
+	{
+		return;
+	}
+
+	eve_msg.command = at2eve_msg_remote_end;
+	upload_send(qconfig, &eve_msg, eve2at_rsp_remote_ack);
+
+	remote.link_id = -1;
+	console_add(qconfig, "Remote display ended.");
+}
+
+static void screenshot(struct eve_setup_s *qconfig, int8_t link_id)
+{
+	static uint8_t block[SCREENSHOT_BLOCK];
+	struct at2eve_messages_s eve_msg;
+	struct at2eve_msg_data_snapshot_s snapshot_msg;
+	char msg[64];
+	int8_t err;
+
+	if (upload.link_id != -1)
+	{
+		sprintf(msg, "BUSY\n");
+		at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+		return;
+	}
+
+	eve_msg.command = at2eve_msg_snapshot_start;
+	eve_msg.dataptr = &snapshot_msg;
+	err = upload_send(qconfig, &eve_msg, eve2at_rsp_snapshot_ack);
+	if (err != EVE_SNAPSHOT_OK)
+	{
+		sprintf(msg, "ERROR %d\n", err);
+		at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+		return;
+	}
+
+	sprintf(msg, "SCREENSHOT %d %d RGB565 RLE\n", snapshot_msg.width, snapshot_msg.height);
+	err = at_set_cipsend(link_id, strlen(msg), (uint8_t *)msg);
+
+	// Each block is compressed into the buffer after its length and sent
+	// before the next one is read.
+	snapshot_msg.buffer = &block[2];
+	snapshot_msg.size = sizeof(block) - 2;
+	do
+	{
+		snapshot_msg.length = 0;
+		if (err == AT_OK)
+		{
+			eve_msg.command = at2eve_msg_snapshot_data;
+			if (upload_send(qconfig, &eve_msg, eve2at_rsp_snapshot_ack) != EVE_SNAPSHOT_OK)
+			{
+				// A zero length ends the screenshot early.
+				snapshot_msg.length = 0;
+			}
+			block[0] = snapshot_msg.length & 0xff;
+			block[1] = snapshot_msg.length >> 8;
+			err = at_set_cipsend(link_id, snapshot_msg.length + 2, block);
+		}
+	} while ((err == AT_OK) && (snapshot_msg.length));
+
+	eve_msg.command = at2eve_msg_snapshot_end;
+	upload_send(qconfig, &eve_msg, eve2at_rsp_snapshot_ack);
+
+	if (err == AT_OK)
+	{
+		console_add(qconfig, "Screenshot sent.");
+	}
+}
+
+static uint8_t upload_command(const char *message, const char *command, uint32_t *length)
+{
+	char *end;
+
+	if (strncmp(message, command, strlen(command)) != 0)
+	{
+		return 0;
+	}
+
+	*length = strtoul(message + strlen(command), &end, 10);
+
+	return ((*length > 0) && (*end == '\0'));
+}
+
+static void listen_message(int8_t link_id, uint8_t *message, uint16_t length, void *context)
+{
+	struct eve_setup_s *qconfig = (struct eve_setup_s *)context;
+	uint32_t upload_length;
+
+	if (strcmp((char *)message, DISPLAY_COMMAND) == 0)
+	{
+		remote_start(qconfig, link_id);
+		return;
+	}
+	if (strcmp((char *)message, DISPLAY_END_COMMAND) == 0)
+	{
+		if (remote.link_id == link_id)
+		{
+			remote_end(qconfig);
+		}
+		return;
+	}
+	if (strcmp((char *)message, SCREENSHOT_COMMAND) == 0)
+	{
+		screenshot(qconfig, link_id);
+		return;
+	}
+	if (upload_command((char *)message, IMAGE_COMMAND, &upload_length))
+	{
+		upload_start(qconfig, link_id, upload_length, UPLOAD_IMAGE);
+		return;
+	}
+	if (upload_command((char *)message, VIDEO_COMMAND, &upload_length))
+	{
+		upload_start(qconfig, link_id, upload_length, UPLOAD_VIDEO);
+		return;
+	}
+	if (upload_command((char *)message, DISPLAY_FRAME_COMMAND, &upload_length))
+	{
+		upload_start(qconfig, link_id, upload_length, UPLOAD_DISPLAY);
+		return;
+	}
+
+	// Remove control characters from received message.
+	make_printable((char *)message, length);
+
+	// Add received message to multi-line.
+	console_add(qconfig, (char *)message);
+}
+
 static int8_t listen(struct eve_setup_s *qconfig)
 {
 	int8_t err;
@@ -1158,6 +1769,7 @@ static int8_t listen(struct eve_setup_s *qconfig)
 	int8_t link_id_ipd;
 	int8_t ipd_status = AT_NO_DATA;
 	int8_t ipd_next = 0;
+	int8_t action;
 	char msg[64];
 
 	struct at2eve_messages_s at_msg;
@@ -1174,6 +1786,12 @@ static int8_t listen(struct eve_setup_s *qconfig)
 		at_register_ipd(sizeof(ipd->buffer), (uint8_t *)&ipd[i].buffer);
 	}
 
+	// Reassemble IPD data into messages on each link.
+	for (i = AT_LINK_ID_MIN; i <= AT_LINK_ID_MAX; i++)
+	{
+		at_frame_setup(i, at_frame_mode_newline, frame_buffer[i], FRAME_BUFFER_SIZE);
+	}
+
 	listen_connection = -1;
 
 	while (1)
@@ -1208,6 +1826,12 @@ static int8_t listen(struct eve_setup_s *qconfig)
 				// For each link_id report changes to the status.
 				for (i = AT_LINK_ID_MIN; i <= AT_LINK_ID_MAX; i++)
 				{
+					if (listen_connections[i] != connections_prev[i])
+					{
+						// Do not join partial messages from different connections.
+						at_frame_reset(i);
+					}
+
 					if ((listen_connections[i] == 1) && (connections_prev[i] == 0))
 					{
 						console_set_colour(qconfig, COLOR_RGB(0, 255, 0));
@@ -1218,6 +1842,16 @@ static int8_t listen(struct eve_setup_s *qconfig)
 					}
 					else if ((listen_connections[i] == 0) && (connections_prev[i] == 1))
 					{
+						if (upload.link_id == i)
+						{
+							// The upload was cut short.
+							upload_finish(qconfig, 0);
+						}
+						if (remote.link_id == i)
+						{
+							remote_end(qconfig);
+						}
+
 						console_set_colour(qconfig, COLOR_RGB(255, 0, 0));
 						sprintf(msg, "Closed connection from %s port %d.",
 								listen_cipstatus[i].remote_ip, listen_cipstatus[i].remote_port);
@@ -1232,28 +1866,51 @@ static int8_t listen(struct eve_setup_s *qconfig)
 		ipd_status = at_ipd(&link_id_ipd, &ipd_buffer_len, (uint8_t **)&ipd_buffer);
 		if (ipd_status == AT_DATA_WAITING)
 		{
-			// Remove control characters from recevied data.
-			// Also NULL terminate the data received.
-			make_printable(ipd_buffer, ipd_buffer_len);
-
-			// Add received data to multi-line.
-			console_add(qconfig, ipd_buffer);
+			// Each complete message is passed to listen_message.
+			err = at_frame_receive(link_id_ipd, (uint8_t *)ipd_buffer, ipd_buffer_len, listen_message, qconfig);
+			if (err == AT_ERROR_RESOURCE)
+			{
+				// The rest of the message is skipped by the framing.
+				sprintf(msg, "Message on link %d longer than %d bytes dropped.",
+						link_id_ipd, FRAME_BUFFER_SIZE - 1);
+				console_add(qconfig, msg);
+				sprintf(msg, "ERROR %d\n", err);
+				at_set_cipsend(link_id_ipd, strlen(msg), (uint8_t *)msg);
+			}
 
 			// Re-add the completed IPD buffer to the end of the chain.
 			at_register_ipd(sizeof(ipd->buffer), (uint8_t *)&ipd[ipd_next].buffer);
 			ipd_next++;
-			if (ipd_next > IPD_CONCURRENT_REQUESTS)
+			if (ipd_next >= IPD_CONCURRENT_REQUESTS)
 			{
 				ipd_next = 0;
 			}
 		}
 
+		// The WIFI DISCONNECTED message was received from the AT firmware.
+		if (at_wifi_disconnect_event())
+		{
+			if (upload.link_id != -1)
+			{
+				upload_finish(qconfig, 0);
+			}
+			remote_end(qconfig);
+			action = ACTION_RECONNECT;
+			break;
+		}
+
 		// Detect a message from the EVE such as settings button.
 		if (xQueueReceive(qconfig->at2eve_q, &at_msg, 0) == pdTRUE)
 		{
 			if (at_msg.command == eve2at_msg_settings)
 			{
-				return ACTION_SETTINGS;
+				if (upload.link_id != -1)
+				{
+					upload_finish(qconfig, 0);
+				}
+				remote_end(qconfig);
+				action = ACTION_SETTINGS;
+				break;
 			}
 			if (at_msg.command == eve2at_msg_keyboard)
 			{
@@ -1263,12 +1920,116 @@ static int8_t listen(struct eve_setup_s *qconfig)
 		}
 	}
 
+	// The buffers are registered again by the next listen.
 	for (i = 0; i < IPD_CONCURRENT_REQUESTS; i++)
 	{
 		at_delete_ipd((uint8_t *)&ipd[i].buffer);
 	}
 
-	return ACTION_SETTINGS;
+	return action;
+}
+
+static int8_t reconnect(struct eve_setup_s *qconfig)
+{
+	int8_t err = AT_ERROR_RESPONSE;
+	char msg[128];
+	int backoff = RECONNECT_BACKOFF_MIN;
+	TickType_t start;
+	struct eve2at_messages_s at_msg;
+
+	console_set_colour(qconfig, COLOR_RGB(255, 0, 0));
+	console_add(qconfig, "WiFi disconnected. Reconnecting...");
+	console_set_colour(qconfig, COLOR_RGB(255, 255, 255));
+
+	while (1)
+	{
+		// The AT firmware may have rejoined on its own.
+		if (at_is_wifi_connected())
+		{
+			err = AT_OK;
+			break;
+		}
+
+		if (reconnect_ap.valid)
+		{
+			// Rejoin the same access point by BSSID. This avoids a scan.
+			if (reconnect_ap.saved)
+			{
+				err = at_cwjap();
+			}
+			else
+			{
+				err = at_set_cwjap(&reconnect_ap.cwjap);
+			}
+			if (err == AT_OK)
+			{
+				break;
+			}
+
+			sprintf(msg, "Reconnect failed %d, retry in %d ms.", err, backoff);
+		}
+		else
+		{
+			// No access point to rejoin. Wait for the AT firmware.
+			sprintf(msg, "Waiting for WiFi, retry in %d ms.", backoff);
+		}
+		console_add(qconfig, msg);
+
+		// Wait before retrying. The settings button abandons the reconnect.
+		if (xQueueReceive(qconfig->at2eve_q, &at_msg, pdMS_TO_TICKS(backoff)) == pdTRUE)
+		{
+			if (at_msg.command == eve2at_msg_settings)
+			{
+				return ACTION_SETTINGS;
+			}
+		}
+
+		backoff *= 2;
+		if (backoff > RECONNECT_BACKOFF_MAX)
+		{
+			backoff = RECONNECT_BACKOFF_MAX;
+		}
+	}
+
+	if (reconnect_ap.valid)
+	{
+		sprintf(msg, "Reconnected to \"%s\" channel %d.", reconnect_ap.cwjap.ssid, reconnect_ap.channel);
+	}
+	else
+	{
+		sprintf(msg, "Reconnected.");
+	}
+	console_add(qconfig, msg);
+
+	if (dhcp_enable == at_enable)
+	{
+		start = xTaskGetTickCount();
+		while (at_wifi_station_ip() == 0)
+		{
+			if ((xTaskGetTickCount() - start) > pdMS_TO_TICKS(RECONNECT_DHCP_TIMEOUT))
+			{
+				console_add(qconfig, "Timeout waiting for IP Address.");
+				return AT_ERROR_TIMEOUT;
+			}
+			vTaskDelay(pdMS_TO_TICKS(10));
+		}
+	}
+	else
+	{
+		// Apply the static IP address straight away rather than wait.
+		err = set_ip_addr(qconfig);
+		if (err != AT_OK)
+		{
+			return err;
+		}
+	}
+
+	// Any disconnect while rejoining is stale.
+	at_wifi_disconnect_event();
+
+	// Links were closed by the disconnect. Restart the server.
+	stop_server(qconfig);
+	return start_server(qconfig, ip_port, ip_timeout);
 }
 
 static int8_t setup(struct eve_setup_s *qconfig)
@@ -1309,6 +2070,14 @@ static int8_t setup(struct eve_setup_s *qconfig)
 		tfp_printf(msg);
 		tfp_printf("\r\n");
 
+		// Joined at power on with the access point saved in the module.
+		memset(&reconnect_ap, 0, sizeof(reconnect_ap));
+		strcpy(reconnect_ap.cwjap.ssid, curr_ap.ssid);
+		strcpy(reconnect_ap.cwjap.bssid, curr_ap.bssid);
+		reconnect_ap.channel = curr_ap.channel;
+		reconnect_ap.valid = 1;
+		reconnect_ap.saved = 1;
+
 		state = STATE_AP;
 		ap_connected = at_enable;
 	}
@@ -1433,9 +2202,30 @@ void vATmonitorTask (void *param)
 				action = ACTION_NONE;
 
 				err = listen(qconfig);
-				if (err != AT_OK)
+				if (err == ACTION_RECONNECT)
+				{
+					state = STATE_RECONNECT;
+				}
+				else if (err != AT_OK)
+				{
+					// Remedial action
+					action = ACTION_SETTINGS;
+				}
+			}
+			else if (state == STATE_RECONNECT)
+			{
+				err = reconnect(qconfig);
+				if (err == AT_OK)
+				{
+					// Server was restarted by reconnect
+					state = STATE_LISTEN;
+					action = ACTION_NONE;
+				}
+				else
 				{
 					// Remedial action
+					state = STATE_NO_AP;
+					ap_connected = at_disable;
 					action = ACTION_SETTINGS;
 				}
 			}
@@ -62,14 +62,126 @@
 
 /* CONSTANTS ***********************************************************************/
 
+/**
+ @brief Queue wait while a multi-line display update is pending.
+ @details Shorter than one display frame so that coalesced lines are drawn
+ on the next frame.
+ */
+#define EVE_UPDATE_POLL_MS 5
+
+/**
+ @brief Queue wait while idle.
+ @details Touch events are delivered through the queue from the EVE
+ interrupt. The screen is still polled at this interval in case an
+ interrupt is missed.
+ */
+#define EVE_IDLE_POLL_MS 1000
+
+/**
+ @brief Longest wait for a touch event in an input loop.
+ */
+#define EVE_TOUCH_WAIT_MS 100
+
+/**
+ @brief Report multi-line display throughput.
+ @details Define MULTILINE_BENCHMARK to print the number of lines added
+ and frames drawn per second at this interval.
+ */
+#define MULTILINE_BENCHMARK_MS 10000
+
+/**
+ @brief Report boot time.
+ @details Define BOOT_BENCHMARK to print the time taken to load assets and
+ the time from the start of the EVE task to the "Ready." screen.
+ */
+
+/**
+ @brief Dump SPI transaction trace.
+ @details When the EVE library is built with EVE_SPI_TRACE the trace buffer
+ is printed to the UART as "TRACE" lines at the end of each pass of the
+ main loop. Decode the log with Scripts/eve_trace.py.
+ */
+#define TRACE_LINE_BYTES 32
+
 /* GLOBAL VARIABLES ****************************************************************/
 
 /* LOCAL VARIABLES *****************************************************************/
 
+/**
+ @brief Touch event signalling.
+ @details The touch interrupt sends at most one message to the EVE task
+ queue at a time so that it cannot fill the queue. The semaphore wakes
+ input loops that are waiting for a touch.
+ */
+//@{
+static QueueHandle_t touch_q = NULL;
+static SemaphoreHandle_t touch_sem = NULL;
+static volatile uint8_t touch_queued = 0;
+//@}
+
 /* MACROS **************************************************************************/
 
 /* FUNCTIONS ***********************************************************************/
 
+static void touch_notify(void)
+{
+	BaseType_t woken = pdFALSE;
+	struct eve2at_messages_s msg;
+
+	xSemaphoreGiveFromISR(touch_sem, &woken);
+
+	if (!touch_queued)
+	{
+		msg.command = at2eve_msg_touch;
+		if (xQueueSendFromISR(touch_q, &msg, &woken) == pdTRUE)
+		{
+			touch_queued = 1;
+		}
+	}
+
+	if (woken)
+	{
+		portYIELD_FROM_ISR();
+	}
+}
+
+static void touch_wait(void)
+{
+	xSemaphoreTake(touch_sem, pdMS_TO_TICKS(EVE_TOUCH_WAIT_MS));
+}
+
+#ifdef EVE_SPI_TRACE
+static void trace_dump(void)
+{
+	const uint8_t *buffer;
+	uint32_t length;
+	uint32_t lost;
+	uint32_t i;
+
+	length = HAL_TraceGet(&buffer, &lost);
+	if ((length == 0) && (lost == 0))
+	{
+		return;
+	}
+
+	for (i = 0; i < length; i++)
+	{
+		if ((i % TRACE_LINE_BYTES) == 0)
+		{
+			tfp_printf("TRACE ");
+		}
+		tfp_printf("%02x", buffer[i]);
+		if (((i % TRACE_LINE_BYTES) == (TRACE_LINE_BYTES - 1)) || (i == length - 1))
+		{
+			tfp_printf("\r\n");
+		}
+	}
+	tfp_printf("TRACE END %d\r\n", lost);
+
+	HAL_TraceReset();
+}
+#endif // EVE_SPI_TRACE
+
 static uint32_t decode_options(uint32_t options, uint32_t mask)
 {
 	uint32_t eve_opt = 0;
@@ -120,7 +232,20 @@ void vEVEmonitorTask (void *param)
 	struct at2eve_messages_s at_msg;
 	struct eve2at_messages_s eve_msg;
 	uint8_t selection;
+	uint8_t update_pending = 0;
+	// An uploaded image or video is being decoded or is on the screen, or
+	// a remote display client is drawing.
+	uint8_t media_loading = 0;
+	uint8_t media_shown = 0;
 	uint32_t format = COLOR_RGB(255,255,255);
+#ifdef MULTILINE_BENCHMARK
+	TickType_t bench_start = xTaskGetTickCount();
+	uint32_t bench_lines = 0, bench_frames = 0;
+#endif // MULTILINE_BENCHMARK
+#ifdef BOOT_BENCHMARK
+	TickType_t boot_start = xTaskGetTickCount();
+	TickType_t boot_assets;
+#endif // BOOT_BENCHMARK
 
 	EVE_Init();
 
@@ -128,7 +253,13 @@ void vEVEmonitorTask (void *param)
 
 	// Decode JPEG images from flash into RAM_DL on FT8xx.
 	// Start at RAM_DL address zero.
+#ifdef BOOT_BENCHMARK
+	boot_assets = xTaskGetTickCount();
+#endif // BOOT_BENCHMARK
 	eve_ui_load_images();
+#ifdef BOOT_BENCHMARK
+	boot_assets = xTaskGetTickCount() - boot_assets;
+#endif // BOOT_BENCHMARK
 
 	eve_ui_splash("Waiting for ESP32...", 0);
 
@@ -151,12 +282,34 @@ void vEVEmonitorTask (void *param)
 
 	eve_ui_splash("Ready.", 0);
 
+#ifdef BOOT_BENCHMARK
+	tfp_printf("boot: assets %d ms ready %d ms\r\n",
+			(int)(boot_assets * portTICK_PERIOD_MS),
+			(int)((xTaskGetTickCount() - boot_start) * portTICK_PERIOD_MS));
+#endif // BOOT_BENCHMARK
+
+	// Touch events are only queued once the ESP32 handshake is complete.
+	touch_q = qconfig->eve2at_q;
+	touch_sem = xSemaphoreCreateBinary();
+	eve_ui_touch_int_init(touch_notify, touch_wait);
+
 	while (1)
 	{
 		selection = 0;
 
-		if (xQueueReceive(qconfig->eve2at_q, &eve_msg, pdMS_TO_TICKS(100)) == pdTRUE)
+		if (xQueueReceive(qconfig->eve2at_q, &eve_msg,
+				pdMS_TO_TICKS(update_pending ? EVE_UPDATE_POLL_MS : EVE_IDLE_POLL_MS)) == pdTRUE)
 		{
+			if (eve_msg.command == at2eve_msg_touch)
+			{
+				touch_queued = 0;
+				eve_ui_touch_event();
+				// Keys are not checked while the co-processor is decoding.
+				if (!media_loading)
+				{
+					selection = eve_ui_key_check();
+				}
+			}
 			if (eve_msg.command == at2eve_msg_choose_list)
 			{
 				struct at2eve_msg_data_choose_s *choose_msg = (struct at2eve_msg_data_choose_s *)eve_msg.dataptr;
@@ -178,6 +331,16 @@ void vEVEmonitorTask (void *param)
 					selection = choice & 0x00ff;
 				}
 			}
+			if (eve_msg.command == at2eve_msg_choose_list_preview)
+			{
+				struct at2eve_msg_data_choose_s *choose_msg = (struct at2eve_msg_data_choose_s *)eve_msg.dataptr;
+				uint32_t eve_opt = decode_options(choose_msg->options, EVE_HEADER_LOGO);
+
+				eve_ui_present_list_preview(choose_msg->toast, eve_opt, &choose_msg->list, choose_msg->count);
+
+				at_msg.command = eve2at_rsp_preview_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
 			if (eve_msg.command == at2eve_msg_choose_options_list)
 			{
 				struct at2eve_msg_data_choose_s *choose_msg = (struct at2eve_msg_data_choose_s *)eve_msg.dataptr;
@@ -302,7 +465,8 @@ void vEVEmonitorTask (void *param)
 						| EVE_HEADER_SETTINGS_BUTTON | EVE_HEADER_CANCEL_BUTTON | EVE_HEADER_SETTINGS_BUTTON
 						| EVE_HEADER_SAVE_BUTTON | EVE_HEADER_KEYPAD_BUTTON | EVE_HEADER_KEYBOARD_BUTTON);
 
-				eve_ui_multiline_init(ml_msg->toast, eve_opt, format);
+				eve_ui_multiline_init(ml_msg->toast, eve_opt);
+				media_shown = 0;
 
 				at_msg.command = eve2at_rsp_multiline_ack;
 				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
@@ -324,16 +488,203 @@ void vEVEmonitorTask (void *param)
 			if (eve_msg.command == at2eve_msg_multiline_show)
 			{
 				eve_ui_multiline_display();
+				media_shown = 0;
 
 				at_msg.command = eve2at_rsp_multiline_ack;
 				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
 			}
+			if (eve_msg.command == at2eve_msg_image_start)
+			{
+				at_msg.value = eve_ui_image_start();
+				if (at_msg.value == EVE_IMAGE_OK)
+				{
+					media_loading = 1;
+					media_shown = 1;
+				}
+
+				at_msg.command = eve2at_rsp_image_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_image_data)
+			{
+				struct at2eve_msg_data_media_s *img_msg = (struct at2eve_msg_data_media_s *)eve_msg.dataptr;
+
+				// The image is abandoned by eve_ui_image_write on an error.
+				at_msg.value = eve_ui_image_write(img_msg->data, img_msg->length);
+				if (at_msg.value != EVE_IMAGE_OK)
+				{
+					media_loading = 0;
+					media_shown = 0;
+					eve_ui_multiline_display();
+				}
+
+				at_msg.command = eve2at_rsp_image_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_image_end)
+			{
+				if (eve_msg.value)
+				{
+					at_msg.value = eve_ui_image_end();
+				}
+				else
+				{
+					eve_ui_image_abort();
+					at_msg.value = EVE_IMAGE_OK;
+				}
+				if ((eve_msg.value == 0) || (at_msg.value != EVE_IMAGE_OK))
+				{
+					// Return to the console if there is no image to show.
+					if (media_shown)
+					{
+						eve_ui_multiline_display();
+					}
+					media_shown = 0;
+				}
+				media_loading = 0;
+
+				at_msg.command = eve2at_rsp_image_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_video_start)
+			{
+				at_msg.value = eve_ui_video_start();
+				if (at_msg.value == EVE_VIDEO_OK)
+				{
+					media_loading = 1;
+					media_shown = 1;
+				}
+
+				at_msg.command = eve2at_rsp_video_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_video_data)
+			{
+				struct at2eve_msg_data_media_s *video_msg = (struct at2eve_msg_data_media_s *)eve_msg.dataptr;
+
+				// The video is abandoned by eve_ui_video_write on an error.
+				at_msg.value = eve_ui_video_write(video_msg->data, video_msg->length);
+				if (at_msg.value != EVE_VIDEO_OK)
+				{
+					media_loading = 0;
+					media_shown = 0;
+					eve_ui_multiline_display();
+				}
+
+				at_msg.command = eve2at_rsp_video_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_video_end)
+			{
+				struct at2eve_msg_data_video_end_s *end_msg = (struct at2eve_msg_data_video_end_s *)eve_msg.dataptr;
+
+				if (end_msg->complete)
+				{
+					at_msg.value = eve_ui_video_end();
+				}
+				else
+				{
+					eve_ui_video_abort();
+					at_msg.value = EVE_VIDEO_OK;
+				}
+				eve_ui_video_stats(&end_msg->stats);
+
+				// The last frame is not kept after playback.
+				if (media_shown)
+				{
+					eve_ui_multiline_display();
+				}
+				media_shown = 0;
+				media_loading = 0;
+
+				at_msg.command = eve2at_rsp_video_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_remote_start)
+			{
+				struct at2eve_msg_data_remote_s *remote_msg = (struct at2eve_msg_data_remote_s *)eve_msg.dataptr;
+
+				at_msg.value = eve_ui_remote_start(&remote_msg->address, &remote_msg->size);
+				remote_msg->width = EVE_DISP_WIDTH;
+				remote_msg->height = EVE_DISP_HEIGHT;
+				if (at_msg.value == EVE_REMOTE_OK)
+				{
+					// The client's display lists may use any tag so keys
+					// are not checked.
+					media_loading = 1;
+					media_shown = 1;
+				}
+
+				at_msg.command = eve2at_rsp_remote_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_remote_data)
+			{
+				struct at2eve_msg_data_media_s *remote_msg = (struct at2eve_msg_data_media_s *)eve_msg.dataptr;
+
+				at_msg.value = eve_ui_remote_write(remote_msg->data, remote_msg->length, remote_msg->left);
+
+				at_msg.command = eve2at_rsp_remote_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_remote_frame)
+			{
+				at_msg.value = eve_ui_remote_frame(eve_msg.value);
+
+				at_msg.command = eve2at_rsp_remote_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_remote_end)
+			{
+				eve_ui_remote_end();
+				eve_ui_multiline_display();
+				media_loading = 0;
+				media_shown = 0;
+
+				at_msg.value = EVE_REMOTE_OK;
+				at_msg.command = eve2at_rsp_remote_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_snapshot_start)
+			{
+				struct at2eve_msg_data_snapshot_s *snapshot_msg = (struct at2eve_msg_data_snapshot_s *)eve_msg.dataptr;
+
+				at_msg.value = eve_ui_snapshot_start(&snapshot_msg->width, &snapshot_msg->height);
+
+				at_msg.command = eve2at_rsp_snapshot_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_snapshot_data)
+			{
+				struct at2eve_msg_data_snapshot_s *snapshot_msg = (struct at2eve_msg_data_snapshot_s *)eve_msg.dataptr;
+
+				at_msg.value = eve_ui_snapshot_read(snapshot_msg->buffer, snapshot_msg->size, &snapshot_msg->length);
+
+				at_msg.command = eve2at_rsp_snapshot_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
+			if (eve_msg.command == at2eve_msg_snapshot_end)
+			{
+				eve_ui_snapshot_end();
+
+				at_msg.value = EVE_SNAPSHOT_OK;
+				at_msg.command = eve2at_rsp_snapshot_ack;
+				xQueueSend(qconfig->at2eve_q, &at_msg, 0);
+			}
 		}
-		else
+		else if (!media_loading)
 		{
 			selection = eve_ui_key_check();
 		}
 
+		if ((media_shown) && (!media_loading) && (selection == TAG_CANCEL))
+		{
+			// Closing an uploaded image returns to the console locally.
+			eve_ui_multiline_display();
+			media_shown = 0;
+			selection = 0;
+		}
+
 		if (selection == TAG_CANCEL)
 		{
 			at_msg.command = eve2at_msg_cancel;
@@ -362,11 +713,44 @@ void vEVEmonitorTask (void *param)
 		{
 			at_msg.command = eve2at_msg_keypad;
 		}
+		else if ((selection == TAG_PAGE_UP) || (selection == TAG_PAGE_DOWN))
+		{
+			// Paging through history is handled locally.
+			eve_ui_multiline_page((selection == TAG_PAGE_UP) ? 1 : -1);
+			selection = 0;
+		}
 
 		if (selection)
 		{
 			xQueueSend(qconfig->at2eve_q, &at_msg, 0);
 		}
+
+		// Draw lines added to the multi-line display, at most once a frame.
+		// Lines are kept and drawn when an uploaded image is closed.
+		update_pending = 0;
+		if (!media_shown)
+		{
+			update_pending = eve_ui_multiline_update();
+		}
+
+#ifdef MULTILINE_BENCHMARK
+		if ((xTaskGetTickCount() - bench_start) >= pdMS_TO_TICKS(MULTILINE_BENCHMARK_MS))
+		{
+			uint32_t lines, frames;
+
+			eve_ui_multiline_stats(&lines, &frames);
+			tfp_printf("multiline: %lu lines/s %lu frames/s\r\n",
+					(unsigned long)((lines - bench_lines) / (MULTILINE_BENCHMARK_MS / 1000)),
+					(unsigned long)((frames - bench_frames) / (MULTILINE_BENCHMARK_MS / 1000)));
+			bench_lines = lines;
+			bench_frames = frames;
+			bench_start = xTaskGetTickCount();
+		}
+#endif // MULTILINE_BENCHMARK
+
+#ifdef EVE_SPI_TRACE
+		trace_dump();
+#endif // EVE_SPI_TRACE
 	}
 }
 
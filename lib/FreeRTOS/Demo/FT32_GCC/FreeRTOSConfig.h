@@ -111,7 +111,7 @@
 /* These are defined in FreeRTOS.h, default 0 when !defined. */
 #define configUSE_APPLICATION_TASK_TAG              0
 #define configNUM_THREAD_LOCAL_STORAGE_POINTERS     0
-#define configUSE_RECURSIVE_MUTEXES                 0
+#define configUSE_RECURSIVE_MUTEXES                 1
 #define configUSE_MUTEXES                           1
 #define configUSE_COUNTING_SEMAPHORES               0
 #define configUSE_ALTERNATIVE_API                   0
@@ -50,6 +50,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "timers.h"
+#include "semphr.h"
 
 #include "uartrb.h"
 #include "at.h"
@@ -111,9 +112,18 @@ static int cmd_timeout_inet = pdMS_TO_TICKS(2000);
 static int cmd_timeout_ipd = pdMS_TO_TICKS(500);
 static int cmd_timeout_ap = pdMS_TO_TICKS(20000);
 
+/* Ownership of the AT firmware. Each command, and any sequence of commands
+ * which must not be interleaved, is performed while holding this mutex so
+ * that the API can be called from more than one task. It is recursive as
+ * many commands are built from other commands.
+ * Functions with the _locked suffix must be called with the mutex held.
+ */
+static SemaphoreHandle_t at_mutex;
+static UBaseType_t at_mutex_depth = 0;
+
 /* AT device will normally echo commands */
 static enum at_echo at_echo = at_echo_on;
-static enum at_cwlap_sort at_cwlapopt_sort = at_cwlap_sort_ordered;
+static enum at_cwlap_sort at_cwlapopt_sort = at_cwlap_sort_unordered;
 static enum at_cwlap_mask at_cwlapopt_mask = at_cwlap_mask_all;
 static enum at_enable at_cipmux = at_disable;
 static enum at_txmode at_cipmode = at_txmode_normal;
@@ -122,11 +132,17 @@ static enum at_enable at_cipdinfo = at_disable;
 static int8_t at_state_ipd_pending = 0;
 static int8_t at_state_wifi_connected = 0;
 static int8_t at_state_wifi_station_has_ip = 0;
+static int8_t at_state_wifi_disconnect_event = 0;
 static enum at_connection at_state_server_connect[AT_LINK_ID_COUNT] = {0};
 
+static void at_lock(void);
+static void at_unlock(void);
+
 static int8_t at_txcommand(const char *command);
 static int8_t at_rxresponse(char *response, uint16_t *length, int cmdtimeout);
+static int8_t at_rxecho(char *buffer, uint16_t length);
 static int8_t at_txresponse(char *response, uint16_t length);
+static int8_t at_echo_negotiate(void);
 
 static void peek_async_message(void);
 static uint16_t check_async_message(char *message, uint16_t length);
@@ -148,6 +164,31 @@ static char *helper_strcpy_param_escapify(char *dest, const char *src, uint16_t
 static char *helper_strcpy_param_unescapify(char *dest, const char *src, uint16_t max);
 
 static int8_t helper_query_uart(char *cmd, struct at_cwuart_s *uart);
+static void helper_parse_cwlap(char *params, struct at_cwlap_s *cwlap);
+
+static void at_lock(void)
+{
+	xSemaphoreTakeRecursive(at_mutex, portMAX_DELAY);
+	at_mutex_depth++;
+}
+
+static void at_unlock(void)
+{
+	if (--at_mutex_depth == 0)
+	{
+		xSemaphoreGiveRecursive(at_mutex);
+
+		// Tasks waiting for the mutex are queued in priority then FIFO
+		// order. Yield so that a waiting task of the same priority runs
+		// now rather than this task taking the mutex straight back for
+		// its next command.
+		taskYIELD();
+	}
+	else
+	{
+		xSemaphoreGiveRecursive(at_mutex);
+	}
+}
 
 static int8_t at_txcommand(const char *command)
 {
@@ -218,6 +259,31 @@ static int8_t at_txcommand(const char *command)
 	return rsp;
 }
 
+/* Read in an echoed command and ignore it.
+ * Echo is turned off by at_init so this is only needed as a fallback for
+ * modules that refuse ATE0.
+ */
+static int8_t at_rxecho(char *buffer, uint16_t length)
+{
+	uint16_t count;
+	int8_t rsp = AT_OK;
+
+	xTimerChangePeriod(at_timer, at_rx_timeout_cmd, 0);
+
+	count = uartrb_readln(uart_at, (uint8_t *)buffer, length);
+
+	if (xTimerIsTimerActive(at_timer) == pdFALSE)
+	{
+		rsp = AT_ERROR_TIMEOUT;
+	}
+
+	xTimerStop(at_timer, 0);
+
+	at_txresponse(buffer, count);
+
+	return rsp;
+}
+
 static int8_t at_rxresponse(char *response, uint16_t *length, int cmdtimeout)
 {
 	uint16_t espCount = 0;
@@ -235,26 +301,13 @@ static int8_t at_rxresponse(char *response, uint16_t *length, int cmdtimeout)
 	// Read an parse any async messages which may be pending.
 	peek_async_message();
 
-	// Read in echoed command and ignore.
+	// Only modules which refused ATE0 will echo the command.
 	if (at_echo == at_echo_on)
 	{
-		xTimerChangePeriod(at_timer, at_rx_timeout_cmd, 0);
-
-		count = uartrb_readln(uart_at, (uint8_t *)espPtr, rspLength);
-
-		if (xTimerIsTimerActive(at_timer) == pdFALSE)
+		if (at_rxecho(espPtr, rspLength) == AT_ERROR_TIMEOUT)
 		{
-			rsp = AT_ERROR_TIMEOUT;
+			return AT_ERROR_TIMEOUT;
 		}
-
-		xTimerStop(at_timer, 0);
-
-		at_txresponse(espPtr, count);
-	}
-
-	if (rsp == AT_ERROR_TIMEOUT)
-	{
-		return rsp;
 	}
 
 	xTimerChangePeriod(cmd_timer, cmdtimeout, 0);
@@ -365,6 +418,28 @@ static void cmd_timer_callback(TimerHandle_t xTimerHandle)
 	// No action
 }
 
+/* Turn off command echo on the AT firmware and check that it took effect.
+ * Echoed commands double the data received for every command. If the module
+ * refuses ATE0 then at_echo is left on and echoed commands are discarded.
+ */
+static int8_t at_echo_negotiate(void)
+{
+	enum at_echo echo;
+	int8_t rsp;
+
+	// The current state must be known to parse the response to ATE0.
+	rsp = at_query_ate(&echo);
+	if ((rsp == AT_OK) && (echo == at_echo_on))
+	{
+		at_ate(at_echo_off);
+
+		// Confirm with the module. This updates at_echo.
+		rsp = at_query_ate(&echo);
+	}
+
+	return rsp;
+}
+
 int8_t at_init(ft900_uart_regs_t *at, ft900_uart_regs_t *monitor)
 {
 	enum at_cipstatus status = at_cipstatus_not_connected;
@@ -375,6 +450,12 @@ int8_t at_init(ft900_uart_regs_t *at, ft900_uart_regs_t *monitor)
 	uart_at = at;
 	uart_monitor = monitor;
 
+	at_mutex = xSemaphoreCreateRecursiveMutex();
+	if (at_mutex == NULL)
+	{
+		return AT_ERROR_RESOURCE;
+	}
+
 	// Enable 16 byte FIFO buffers
 	uart_mode(uart_monitor, uart_mode_16550);
 	uart_mode(uart_at, uart_mode_16550);
@@ -413,6 +494,9 @@ int8_t at_init(ft900_uart_regs_t *at, ft900_uart_regs_t *monitor)
 
 	uartrb_flush_read(uart_at);
 
+	// Negotiate echo before any other command is parsed.
+	at_echo_negotiate();
+
 	if (at_query_cwjap(NULL) == AT_OK)
 	{
 		at_state_wifi_connected = 1;
@@ -423,7 +507,6 @@ int8_t at_init(ft900_uart_regs_t *at, ft900_uart_regs_t *monitor)
 		at_state_wifi_station_has_ip = 1;
 	}
 
-	at_query_ate(&at_echo);
 	at_query_cipmux(&at_cipmux);
 	at_query_cipmode(&at_cipmode);
 	at_query_cipdinfo(&at_cipdinfo);
@@ -483,6 +566,8 @@ int8_t at_command(const char *command, uint16_t *length, char *response, int cmd
 {
 	int8_t complete;
 
+	at_lock();
+
 	peek_async_message();
 
 	// Transmit command to AT.
@@ -499,10 +584,12 @@ int8_t at_command(const char *command, uint16_t *length, char *response, int cmd
 		complete = at_txresponse(response, *length);
 	}
 
+	at_unlock();
+
 	return complete;
 }
 
-int8_t at_query_ate(enum at_echo *echo)
+static int8_t at_query_ate_locked(enum at_echo *echo)
 {
 	int8_t complete;
 	char rsp[16];
@@ -550,6 +637,17 @@ int8_t at_query_ate(enum at_echo *echo)
 	return complete;
 }
 
+int8_t at_query_ate(enum at_echo *echo)
+{
+	int8_t rsp;
+
+	at_lock();
+	rsp = at_query_ate_locked(echo);
+	at_unlock();
+
+	return rsp;
+}
+
 int8_t at_passthrough(void)
 {
 	int count;
@@ -560,6 +658,9 @@ int8_t at_passthrough(void)
 	uint16_t rxCount = 0;
 	uint16_t rxPtr = 0;
 
+	// Other tasks are held off until pass through mode is left.
+	at_lock();
+
 	while (1)
 	{
 		if (txCount == 0)
@@ -576,6 +677,7 @@ int8_t at_passthrough(void)
 				txPtr = 0;
 
 				// Leave pass through mode.
+				at_unlock();
 				return 1;
 			}
 
@@ -847,7 +949,7 @@ static  __attribute__((unused)) char *rsp_skip_cmd_echo(const char *line)
 	return end;
 }
 
-static void peek_async_message(void)
+static void peek_async_message_locked(void)
 {
 	char message[MARKER_MAX_LENGTH];
 	uint16_t count;
@@ -874,6 +976,13 @@ static void peek_async_message(void)
 	} while (found);
 }
 
+static void peek_async_message(void)
+{
+	at_lock();
+	peek_async_message_locked();
+	at_unlock();
+}
+
 static uint16_t check_async_message(char *message, uint16_t length)
 {
 	int8_t link_id;
@@ -908,6 +1017,8 @@ static uint16_t check_async_message(char *message, uint16_t length)
 		{
 			at_state_wifi_connected = 0;
 			at_state_wifi_station_has_ip = 0;
+			// Latched until read by at_wifi_disconnect_event.
+			at_state_wifi_disconnect_event = 1;
 			found = AT_STRING_LENGTH(MARKER_WIFI_DISCONNECTED);
 		}
 	}
@@ -1082,7 +1193,7 @@ int8_t at_at(void)
 	return cmd_execute("AT" CRLF);
 }
 
-int8_t at_rst(void)
+static int8_t at_rst_locked(void)
 {
 	int8_t rsp;
 	char rsp_buffer[16];
@@ -1093,7 +1204,7 @@ int8_t at_rst(void)
 	if (rsp == AT_OK)
 	{
 		at_echo = at_echo_on;
-		at_cwlapopt_sort = at_cwlap_sort_ordered;
+		at_cwlapopt_sort = at_cwlap_sort_unordered;
 		at_cwlapopt_mask = at_cwlap_mask_all;
 		at_cipmux = at_disable;
 		at_cipmode = at_txmode_normal;
@@ -1112,11 +1223,26 @@ int8_t at_rst(void)
 				}
 			}
 		} while (!complete);
+
+		// Echo is turned back on by the reset.
+		at_echo_negotiate();
 	}
 
 	return rsp;
 }
 
+int8_t at_rst(void)
+{
+	int8_t rsp;
+
+	// Nothing else may be sent until the module is ready again.
+	at_lock();
+	rsp = at_rst_locked();
+	at_unlock();
+
+	return rsp;
+}
+
 int8_t at_gmr(struct at_cwgmr_s *gmr)
 {
 	uint16_t rsp_length = AT_MIN_RESPONSE + AT_MIN_COMMAND + AT_STRING_LENGTH(struct at_cwgmr_s);
@@ -1196,7 +1322,7 @@ int8_t at_restore(void)
 	{
 		// No response
 		at_echo = at_echo_on;
-		at_cwlapopt_sort = at_cwlap_sort_ordered;
+		at_cwlapopt_sort = at_cwlap_sort_unordered;
 		at_cwlapopt_mask = at_cwlap_mask_all;
 		at_cipmux = at_disable;
 		at_cipmode = at_txmode_normal;
@@ -1360,6 +1486,14 @@ int8_t at_set_cwjap(struct at_set_cwjap_s *cwjap)
 	return cmd_set_with_timeout("AT+CWJAP", params, cmd_timeout_ap);
 }
 
+// Join the access point saved in the module's flash
+// AT+CWJAP
+
+int8_t at_cwjap(void)
+{
+	return cmd_execute_with_timeout("AT+CWJAP" CRLF, cmd_timeout_ap);
+}
+
 // Response when not connected to an AP
 // AT+CWJAP?
 // No AP
@@ -1430,41 +1564,81 @@ int8_t at_set_cwlapopt(int8_t sort, int8_t mask)
 	return rsp;
 }
 
-int8_t at_cwlap(struct at_cwlap_s *rsp_cwlap, int8_t *entries)
+static void helper_parse_cwlap(char *params, struct at_cwlap_s *cwlap)
+{
+	char *rspnext = params;
+
+	if (*rspnext == '(')
+	{
+		rspnext++;
+	}
+
+	if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_ecn))
+	{
+		cwlap->ecn = strtol(rspnext, NULL, 10);
+		rspnext = rsp_next_param(rspnext);
+	}
+	else
+	{
+		cwlap->ecn = 0;
+	}
+
+	cwlap->ssid[0] = 0;
+	if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_ssid))
+	{
+		helper_strcpy_param_unescapify(cwlap->ssid, rspnext, rsp_get_param_length_max(rspnext, AT_STRING_LENGTH(cwlap->ssid)));
+		rspnext = rsp_next_param(rspnext);
+	}
+
+	if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_strength))
+	{
+		cwlap->strength = strtol(rspnext, &rspnext, 10);
+		rspnext = rsp_next_param(rspnext);
+	}
+	else
+	{
+		cwlap->strength = 0;
+	}
+
+	cwlap->bssid[0] = 0;
+	if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_bssid))
+	{
+		helper_strcpy_param_unescapify(cwlap->bssid, rspnext, rsp_get_param_length_max(rspnext, AT_STRING_LENGTH(cwlap->bssid)));
+		rspnext = rsp_next_param(rspnext);
+	}
+
+	if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_channel))
+	{
+		cwlap->channel = strtol(rspnext, &rspnext, 10);
+	}
+	else
+	{
+		cwlap->channel = 0;
+	}
+}
+
+static int8_t at_cwlap_stream_locked(at_cwlap_callback_t callback, void *context)
 {
 	char rspline[((AT_MAX_SSID_ESCAPED) + (AT_MAX_NUMBER * 3) + (AT_MAX_BSSID_ESCAPED))];
 	char *rspparams;
-	char *rspnext;
+	struct at_cwlap_s cwlap;
 	uint16_t count;
 	int8_t complete = 0;
-	int8_t slot = 0;
+	int8_t more = 1;
 	int8_t rsp = AT_ERROR_RESPONSE;
 
-	if ((rsp_cwlap == 0) || (entries == 0))
+	if (callback == 0)
 		return AT_ERROR_PARAMETERS;
 
 	at_txcommand("AT+CWLAP" CRLF);
 
-	// Read in echoed command and ignore.
+	// Only modules which refused ATE0 will echo the command.
 	if (at_echo == at_echo_on)
 	{
-		xTimerChangePeriod(at_timer, at_rx_timeout_cmd, 0);
-
-		count = uartrb_readln(uart_at, (uint8_t *)rspline, AT_STRING_LENGTH(rspline));
-		rspnext = &rspline[count];
-
-		if (xTimerIsTimerActive(at_timer) == pdFALSE)
+		if (at_rxecho(rspline, AT_STRING_LENGTH(rspline)) == AT_ERROR_TIMEOUT)
 		{
-			rsp = AT_ERROR_TIMEOUT;
+			return AT_ERROR_TIMEOUT;
 		}
-		xTimerStop(at_timer, 0);
-
-		at_txresponse(rspline, count);
-	}
-
-	if (rsp == AT_ERROR_TIMEOUT)
-	{
-		return rsp;
 	}
 
 	xTimerChangePeriod(cmd_timer, cmd_timeout_ap, 0);
@@ -1483,62 +1657,20 @@ int8_t at_cwlap(struct at_cwlap_s *rsp_cwlap, int8_t *entries)
 			{
 				complete = -1;
 			}
-			else if (slot < *entries)
+			else if (more)
 			{
 				rspparams = rsp_check_response(rspline, "AT+CWLAP" CRLF);
 				if (rspparams)
 				{
-					rspnext = rspparams;
-
-					if (*rspnext == '(')
-					{
-						rspnext++;
-					}
-
-					if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_ecn))
-					{
-						rsp_cwlap[slot].ecn = strtol(rspnext, NULL, 10);
-						rspnext = rsp_next_param(rspnext);
-					}
-					else
-					{
-						rsp_cwlap[slot].ecn = 0;
-					}
-
-					rsp_cwlap[slot].ssid[0] = 0;
-					if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_ssid))
-					{
-						helper_strcpy_param_unescapify(rsp_cwlap[slot].ssid, rspnext, rsp_get_param_length_max(rspnext, AT_STRING_LENGTH(rsp_cwlap[0].ssid)));
-						rspnext = rsp_next_param(rspnext);
-					}
-
-					if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_strength))
-					{
-						rsp_cwlap[slot].strength = strtol(rspnext, &rspnext, 10);
-						rspnext = rsp_next_param(rspnext);
-					}
-					else
-					{
-						rsp_cwlap[slot].strength = 0;
-					}
+					helper_parse_cwlap(rspparams, &cwlap);
 
-					rsp_cwlap[slot].bssid[0] = 0;
-					if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_bssid))
+					// Each access point is passed on as soon as it is received.
+					// The scan cannot be aborted so once the callback has enough
+					// entries the rest of the response is discarded.
+					if (callback(&cwlap, context) != 0)
 					{
-						helper_strcpy_param_unescapify(rsp_cwlap[slot].bssid, rspnext, rsp_get_param_length_max(rspnext, AT_STRING_LENGTH(rsp_cwlap[0].bssid)));
-						rspnext = rsp_next_param(rspnext);
-					}
-
-					if ((rspnext) && (at_cwlapopt_mask & at_cwlap_mask_channel))
-					{
-						rsp_cwlap[slot].channel = strtol(rspnext, &rspnext, 10);
+						more = 0;
 					}
-					else
-					{
-						rsp_cwlap[slot].channel = 0;
-					}
-
-					slot++;
 				}
 			}
 
@@ -1555,7 +1687,55 @@ int8_t at_cwlap(struct at_cwlap_s *rsp_cwlap, int8_t *entries)
 
 	xTimerStop(cmd_timer, 0);
 
-	*entries = slot;
+	return rsp;
+}
+
+int8_t at_cwlap_stream(at_cwlap_callback_t callback, void *context)
+{
+	int8_t rsp;
+
+	// The callback is called with the mutex held and must not block.
+	at_lock();
+	rsp = at_cwlap_stream_locked(callback, context);
+	at_unlock();
+
+	return rsp;
+}
+
+struct cwlap_array_s {
+	struct at_cwlap_s *cwlap;
+	int8_t slot;
+	int8_t entries;
+};
+
+static int8_t cwlap_array_callback(struct at_cwlap_s *cwlap, void *context)
+{
+	struct cwlap_array_s *array = (struct cwlap_array_s *)context;
+
+	if (array->slot < array->entries)
+	{
+		memcpy(&array->cwlap[array->slot], cwlap, sizeof(struct at_cwlap_s));
+		array->slot++;
+	}
+
+	return (array->slot >= array->entries);
+}
+
+int8_t at_cwlap(struct at_cwlap_s *rsp_cwlap, int8_t *entries)
+{
+	struct cwlap_array_s array;
+	int8_t rsp;
+
+	if ((rsp_cwlap == 0) || (entries == 0))
+		return AT_ERROR_PARAMETERS;
+
+	array.cwlap = rsp_cwlap;
+	array.slot = 0;
+	array.entries = *entries;
+
+	rsp = at_cwlap_stream(cwlap_array_callback, &array);
+
+	*entries = array.slot;
 
 	return rsp;
 }
@@ -2030,7 +2210,7 @@ int8_t at_set_cipstart_ssl(int8_t link_id, char *remote_ip, uint16_t remote_port
 	return at_set_cipstart_tcp_helper(link_id, "SSL", remote_ip, remote_port, tcp_keep_alive);
 }
 
-static int8_t at_set_cipsend_all_helper(char *cmd, int8_t link_id, uint16_t length, uint8_t *buffer, char *remote_ip, uint16_t remote_port)
+static int8_t at_set_cipsend_all_helper_locked(char *cmd, int8_t link_id, uint16_t length, uint8_t *buffer, char *remote_ip, uint16_t remote_port)
 {
 	int8_t rsp;
 	char params[(AT_MAX_IP * 2) + (AT_MAX_NUMBER * 3) + 8];
@@ -2083,6 +2263,18 @@ static int8_t at_set_cipsend_all_helper(char *cmd, int8_t link_id, uint16_t leng
 	return rsp;
 }
 
+static int8_t at_set_cipsend_all_helper(char *cmd, int8_t link_id, uint16_t length, uint8_t *buffer, char *remote_ip, uint16_t remote_port)
+{
+	int8_t rsp;
+
+	// The command, prompt and data must not be interleaved with another task.
+	at_lock();
+	rsp = at_set_cipsend_all_helper_locked(cmd, link_id, length, buffer, remote_ip, remote_port);
+	at_unlock();
+
+	return rsp;
+}
+
 static int8_t at_set_cipsend_helper(int8_t link_id, uint16_t length, uint8_t *buffer, char *remote_ip, uint16_t remote_port)
 {
 	return at_set_cipsend_all_helper("AT+CIPSEND", link_id, length, buffer, remote_ip, remote_port);
@@ -2336,7 +2528,7 @@ int8_t at_query_cipdinfo(enum at_enable *enable)
 	return rsp;
 }
 
-int8_t at_register_ipd(uint16_t length, uint8_t *buffer)
+static int8_t at_register_ipd_locked(uint16_t length, uint8_t *buffer)
 {
 	struct ipd_store *new_ipd;
 	struct ipd_store *end_ipd;
@@ -2369,7 +2561,18 @@ int8_t at_register_ipd(uint16_t length, uint8_t *buffer)
 	return AT_OK;
 }
 
-int8_t at_delete_ipd(uint8_t *buffer)
+int8_t at_register_ipd(uint16_t length, uint8_t *buffer)
+{
+	int8_t rsp;
+
+	at_lock();
+	rsp = at_register_ipd_locked(length, buffer);
+	at_unlock();
+
+	return rsp;
+}
+
+static int8_t at_delete_ipd_locked(uint8_t *buffer)
 {
 	struct ipd_store *end_ipd;
 	struct ipd_store *prev_ipd;
@@ -2383,6 +2586,12 @@ int8_t at_delete_ipd(uint8_t *buffer)
 		{
 			if (end_ipd->buffer == buffer)
 			{
+				// Data is not written to an entry once it is removed.
+				if (ipd_write == end_ipd)
+				{
+					ipd_write = end_ipd->next;
+				}
+
 				if (prev_ipd == NULL)
 				{
 					// Remove this entry if it is the first in the list
@@ -2393,7 +2602,7 @@ int8_t at_delete_ipd(uint8_t *buffer)
 				else
 				{
 					// Remove this entry if it is elsewhere
-					prev_ipd = end_ipd->next;
+					prev_ipd->next = end_ipd->next;
 					vPortFree(end_ipd);
 					break;
 				}
@@ -2408,6 +2617,17 @@ int8_t at_delete_ipd(uint8_t *buffer)
 	return AT_OK;
 }
 
+int8_t at_delete_ipd(uint8_t *buffer)
+{
+	int8_t rsp;
+
+	at_lock();
+	rsp = at_delete_ipd_locked(buffer);
+	at_unlock();
+
+	return rsp;
+}
+
 static int8_t async_ipd_receive(void)
 {
 	char rspparams[16 + (AT_MAX_NUMBER * 3) + AT_MAX_IP];
@@ -2562,6 +2782,9 @@ static int8_t async_ipd_receive(void)
 
 int8_t at_ipd_info(int8_t *link_id, char *remote_ip, uint16_t *remote_port, uint16_t *length, uint8_t **buffer)
 {
+	TickType_t start;
+	struct ipd_store *ipd_next;
+
 	if (length == 0)
 		return AT_ERROR_PARAMETERS;
 	if (at_cipmux == at_enable)
@@ -2571,40 +2794,46 @@ int8_t at_ipd_info(int8_t *link_id, char *remote_ip, uint16_t *remote_port, uint
 		if ((remote_ip == 0) || (remote_port == 0))
 			return AT_ERROR_PARAMETERS;
 
-	xTimerChangePeriod(cmd_timer, at_rx_timeout_cmd, 0);
+	// The shared command timer is not used here as the mutex is only held
+	// while checking for data so other tasks can send in the meantime.
+	start = xTaskGetTickCount();
 
-	do
+	while (1)
 	{
 		// Look for data or a disconnect.
 		peek_async_message();
 
-		if (xTimerIsTimerActive(cmd_timer) == pdFALSE)
+		// Other tasks may register or delete buffers in the meantime.
+		at_lock();
+		if ((ipd_head != NULL) && (ipd_head->valid == at_ipd_status_data))
 		{
-			return AT_ERROR_TIMEOUT;
+			break;
 		}
+		at_unlock();
 
-	} while (ipd_head->valid != at_ipd_status_data);
-
-	xTimerStop(cmd_timer, 0);
+		if ((xTaskGetTickCount() - start) > (TickType_t)at_rx_timeout_cmd)
+		{
+			return AT_ERROR_TIMEOUT;
+		}
 
-	if (ipd_head->valid == at_ipd_status_data)
-	{
-		struct ipd_store *ipd_next;
+		// Let lower priority tasks run between polls.
+		vTaskDelay(1);
+	}
 
-		if (length) *length = ipd_head->length;
-		if (buffer) *buffer = ipd_head->buffer;
-		if (remote_port) *remote_port = ipd_head->remote_port;
-		if (remote_ip) strncpy(remote_ip, ipd_head->remote_ip, sizeof(ipd_head->remote_ip));
-		if (link_id) *link_id = ipd_head->link_id;
+	// Still locked from the check above.
+	if (length) *length = ipd_head->length;
+	if (buffer) *buffer = ipd_head->buffer;
+	if (remote_port) *remote_port = ipd_head->remote_port;
+	if (remote_ip) strncpy(remote_ip, ipd_head->remote_ip, sizeof(ipd_head->remote_ip));
+	if (link_id) *link_id = ipd_head->link_id;
 
-		ipd_next = ipd_head->next;
-		vPortFree(ipd_head);
-		ipd_head = ipd_next;
+	ipd_next = ipd_head->next;
+	vPortFree(ipd_head);
+	ipd_head = ipd_next;
 
-		return AT_DATA_WAITING;
-	}
+	at_unlock();
 
-	return AT_NO_DATA;
+	return AT_DATA_WAITING;
 }
 
 int8_t at_ipd(int8_t *link_id, uint16_t *length, uint8_t **buffer)
@@ -2624,6 +2853,16 @@ int8_t at_wifi_station_ip()
 	return at_state_wifi_station_has_ip;
 }
 
+int8_t at_wifi_disconnect_event()
+{
+	int8_t event;
+
+	peek_async_message();
+	event = at_state_wifi_disconnect_event;
+	at_state_wifi_disconnect_event = 0;
+	return event;
+}
+
 enum at_connection at_is_server_connected()
 {
 	int8_t check;
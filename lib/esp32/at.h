@@ -167,8 +167,8 @@ enum PACKED at_echo {
 };
 
 enum PACKED at_cwlap_sort {
-	at_cwlap_sort_ordered = 0,
-	at_cwlap_sort_unordered = 1,
+	at_cwlap_sort_unordered = 0,
+	at_cwlap_sort_ordered = 1, // Ordered by RSSI, strongest first
 };
 
 enum PACKED at_cwlap_mask {
@@ -180,6 +180,13 @@ enum PACKED at_cwlap_mask {
 	at_cwlap_mask_all = 31,
 };
 
+// Called by at_cwlap_stream for each access point as it is received.
+// Return non-zero when no more access points are required.
+// The callback runs with the AT mutex held while the rest of the scan is
+// still arriving from the module. It must not call other AT functions from
+// another task or wait on anything which could, and it must return quickly.
+typedef int8_t (*at_cwlap_callback_t)(struct at_cwlap_s *cwlap, void *context);
+
 enum PACKED at_cwdhcp_mask {
 	at_cwdhcp_station = 1,
 	at_cwdhcp_soft_ap = 2,
@@ -221,6 +228,8 @@ enum PACKED at_connection {
 };
 
 // Initialise timers and ports
+// Once at_init has returned the remaining functions may be called from
+// more than one task. Commands are serialised in the order they are made.
 int8_t at_init(ft900_uart_regs_t *at, ft900_uart_regs_t *monitor);
 int8_t at_timeout_comms(int timeout);
 int8_t at_timeout_cmd(int timeout);
@@ -251,9 +260,11 @@ int8_t at_query_sleep(enum at_enable *on);
 int8_t at_set_cwmode(enum at_mode mode);
 int8_t at_query_cwmode(enum at_mode *mode);
 int8_t at_set_cwjap(struct at_set_cwjap_s *cwjap);
+int8_t at_cwjap(void);
 int8_t at_query_cwjap(struct at_query_cwjap_s *cwjap);
 int8_t at_set_cwlapopt(int8_t sort, int8_t mask);
 int8_t at_cwlap(struct at_cwlap_s *cwlap, int8_t *entries);
+int8_t at_cwlap_stream(at_cwlap_callback_t callback, void *context);
 int8_t at_cwqap(void);
 int8_t at_query_cwdhcp(struct at_cwdhcp_s *cwdhcp);
 int8_t at_set_cwdhcp(enum at_enable operation, struct at_cwdhcp_s *cwdhcp);
@@ -307,6 +318,7 @@ int8_t at_ipd_info(int8_t *link_id, char *remote_ip, uint16_t *remote_port, uint
 
 int8_t at_is_wifi_connected();
 int8_t at_wifi_station_ip();
+int8_t at_wifi_disconnect_event(); // Non-zero once for each WIFI DISCONNECTED received
 enum at_connection at_is_server_connected();
 enum at_connection at_is_link_id_connected(int8_t link_id);
 
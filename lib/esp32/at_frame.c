@@ -0,0 +1,263 @@
+/**
+  @file at_frame.c
+  @brief Message framing over IPD data
+  Reassembles whole messages from data received on each link.
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * Copyright (C) Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ *  ("Bridgetek") subject to the licence terms set out
+ * http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <ft900.h>
+
+#include "at.h"
+#include "at_frame.h"
+
+struct frame_store {
+	enum at_frame_mode mode;
+	uint8_t *buffer;
+	uint16_t size;
+	// Bytes of the current message received so far.
+	uint16_t count;
+	// Length of the current binary message from the header.
+	uint16_t expected;
+	// Header bytes of the current binary message received so far.
+	uint8_t header;
+	// Set while an oversized message is skipped.
+	int8_t discard;
+	// Raw bytes still to pass to raw_callback.
+	uint32_t raw;
+	at_frame_raw_callback_t raw_callback;
+};
+
+static struct frame_store frame[AT_LINK_ID_COUNT];
+
+// The framing functions return after a message which asks for raw data.
+// The data and length are updated to the bytes not yet used.
+static int8_t frame_receive_newline(struct frame_store *f, int8_t link_id, const uint8_t **pdata, uint16_t *plength, at_frame_callback_t callback, void *context)
+{
+	int8_t rsp = AT_OK;
+	const uint8_t *data = *pdata;
+	uint16_t length = *plength;
+	uint8_t c;
+
+	while ((length) && (f->raw == 0))
+	{
+		c = *data++;
+		length--;
+
+		if (c == '\n')
+		{
+			if (!f->discard)
+			{
+				f->buffer[f->count] = '\0';
+				callback(link_id, f->buffer, f->count, context);
+			}
+			f->count = 0;
+			f->discard = 0;
+		}
+		else if ((c != '\r') && (!f->discard))
+		{
+			if (f->count < f->size - 1)
+			{
+				f->buffer[f->count++] = c;
+			}
+			else
+			{
+				// Too long for the buffer. Skip to the next newline.
+				f->count = 0;
+				f->discard = 1;
+				rsp = AT_ERROR_RESOURCE;
+			}
+		}
+	}
+
+	*pdata = data;
+	*plength = length;
+
+	return rsp;
+}
+
+static int8_t frame_receive_length(struct frame_store *f, int8_t link_id, const uint8_t **pdata, uint16_t *plength, at_frame_callback_t callback, void *context)
+{
+	int8_t rsp = AT_OK;
+	const uint8_t *data = *pdata;
+	uint16_t length = *plength;
+	uint16_t n;
+
+	while ((length) && (f->raw == 0))
+	{
+		if (f->header < AT_FRAME_HEADER_LENGTH)
+		{
+			f->expected = (f->expected << 8) | *data++;
+			length--;
+
+			if (++f->header < AT_FRAME_HEADER_LENGTH)
+			{
+				continue;
+			}
+
+			// Header complete. Leave room for the NULL terminator.
+			f->count = 0;
+			f->discard = (f->expected >= f->size);
+		}
+
+		// Copy as much of the message as is available in one go.
+		n = f->expected - f->count;
+		if (n > length)
+		{
+			n = length;
+		}
+		if (!f->discard)
+		{
+			memcpy(&f->buffer[f->count], data, n);
+		}
+		f->count += n;
+		data += n;
+		length -= n;
+
+		if (f->count == f->expected)
+		{
+			if (!f->discard)
+			{
+				f->buffer[f->count] = '\0';
+				callback(link_id, f->buffer, f->count, context);
+			}
+			else
+			{
+				rsp = AT_ERROR_RESOURCE;
+			}
+			f->header = 0;
+			f->expected = 0;
+			f->count = 0;
+			f->discard = 0;
+		}
+	}
+
+	*pdata = data;
+	*plength = length;
+
+	return rsp;
+}
+
+int8_t at_frame_setup(int8_t link_id, enum at_frame_mode mode, uint8_t *buffer, uint16_t size)
+{
+	if ((link_id < AT_LINK_ID_MIN) || (link_id > AT_LINK_ID_MAX))
+		return AT_ERROR_PARAMETERS;
+	if ((buffer == 0) || (size < 2))
+		return AT_ERROR_PARAMETERS;
+
+	frame[link_id].mode = mode;
+	frame[link_id].buffer = buffer;
+	frame[link_id].size = size;
+
+	return at_frame_reset(link_id);
+}
+
+int8_t at_frame_reset(int8_t link_id)
+{
+	if ((link_id < AT_LINK_ID_MIN) || (link_id > AT_LINK_ID_MAX))
+		return AT_ERROR_PARAMETERS;
+
+	frame[link_id].count = 0;
+	frame[link_id].expected = 0;
+	frame[link_id].header = 0;
+	frame[link_id].discard = 0;
+	frame[link_id].raw = 0;
+
+	return AT_OK;
+}
+
+int8_t at_frame_receive(int8_t link_id, const uint8_t *data, uint16_t length, at_frame_callback_t callback, void *context)
+{
+	struct frame_store *f;
+	int8_t rsp = AT_OK;
+	int8_t err = AT_OK;
+	uint16_t n;
+
+	if ((link_id < AT_LINK_ID_MIN) || (link_id > AT_LINK_ID_MAX))
+		return AT_ERROR_PARAMETERS;
+	if ((data == 0) || (callback == 0))
+		return AT_ERROR_PARAMETERS;
+
+	f = &frame[link_id];
+	if (f->buffer == 0)
+		return AT_ERROR_PARAMETERS;
+
+	while (length)
+	{
+		if (f->raw)
+		{
+			// Pass raw data on without copying it.
+			n = (f->raw < length) ? f->raw : length;
+			f->raw -= n;
+			f->raw_callback(link_id, data, n, context);
+			data += n;
+			length -= n;
+		}
+		else if (f->mode == at_frame_mode_length)
+		{
+			err = frame_receive_length(f, link_id, &data, &length, callback, context);
+		}
+		else
+		{
+			err = frame_receive_newline(f, link_id, &data, &length, callback, context);
+		}
+
+		if (err != AT_OK)
+		{
+			rsp = err;
+		}
+	}
+
+	return rsp;
+}
+
+int8_t at_frame_raw(int8_t link_id, uint32_t length, at_frame_raw_callback_t callback)
+{
+	if ((link_id < AT_LINK_ID_MIN) || (link_id > AT_LINK_ID_MAX))
+		return AT_ERROR_PARAMETERS;
+	if (callback == 0)
+		return AT_ERROR_PARAMETERS;
+
+	frame[link_id].raw = length;
+	frame[link_id].raw_callback = callback;
+
+	return AT_OK;
+}
@@ -0,0 +1,90 @@
+/**
+    @file
+
+    @brief
+    Message framing over IPD data
+
+    
+**/
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * Copyright (C) Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ *  ("Bridgetek") subject to the licence terms set out
+ * http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+
+#ifndef _AT_FRAME_H
+#define _AT_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "at.h"
+
+// Size of the length header on a binary frame. Big-endian.
+#define AT_FRAME_HEADER_LENGTH 2
+
+enum PACKED at_frame_mode {
+	at_frame_mode_newline = 0, // Text terminated with '\n', '\r' is removed
+	at_frame_mode_length = 1, // 16-bit big-endian length then data
+};
+
+// Called by at_frame_receive for each complete message. The message is
+// NULL terminated and only valid for the duration of the call.
+typedef void (*at_frame_callback_t)(int8_t link_id, uint8_t *message, uint16_t length, void *context);
+// Called by at_frame_receive with raw data requested by at_frame_raw. The
+// data is passed straight from the received buffer as it arrives.
+typedef void (*at_frame_raw_callback_t)(int8_t link_id, const uint8_t *data, uint16_t length, void *context);
+
+// Assign a reassembly buffer to a link. A message longer than size - 1 is
+// discarded. The buffer must remain valid until the link is set up again.
+int8_t at_frame_setup(int8_t link_id, enum at_frame_mode mode, uint8_t *buffer, uint16_t size);
+// Discard any partial message on a link. Use when the link opens or closes.
+int8_t at_frame_reset(int8_t link_id);
+// Add data received on a link. The callback is called for each message
+// completed by the data.
+int8_t at_frame_receive(int8_t link_id, const uint8_t *data, uint16_t length, at_frame_callback_t callback, void *context);
+// Pass the next length bytes on a link to the raw callback without framing.
+// May be called from a message callback to take the data following that
+// message. The link returns to its framing mode afterwards.
+int8_t at_frame_raw(int8_t link_id, uint32_t length, at_frame_raw_callback_t callback);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* _AT_FRAME_H */
@@ -53,6 +53,7 @@
 #include <ft900.h>
 #include <ft900_spi.h>
 #include <ft900_gpio.h>
+#include <ft900_interrupt.h>
 
 #include "../include/MCU.h"
 
@@ -65,6 +66,18 @@
 #define PIN_NUM_CS   28
 // Powerdown pin
 #define PIN_NUM_PD   43
+// Interrupt pin (EVE INT_N)
+#define PIN_NUM_INT  42
+
+// SPI Master status register transfer complete flag
+#define SPIM_STATUS_SPIF (1 << 7)
+
+// Size of the SPI Master FIFO. Blocks read from flash for MCU_SPIWriteFlash
+// are this size so that one block is read while the FIFO sends the last.
+#define SPIM_FIFO_SIZE 64
+
+// Handler called when EVE asserts INT_N
+static void (*MCU_IntHandler)(void) = NULL;
 
 // This is the MCU specific section and contains the functions which talk to the
 // PIC registers. If porting the code to a different PIC or to another MCU, these
@@ -114,7 +127,11 @@ void MCU_Setup(void)
 
 #endif // FT81X_ENABLE
 
+	// Burst writes use the largest FIFO available.
+	spi_option(SPIM, spi_option_fifo_size, spi_fifo_size_64);
+
 	// Turn off SPI buffering. Timing of chip select is critical.
+	// Buffering is enabled only for the duration of MCU_SPIWriteBurst.
 	spi_option(SPIM, spi_option_fifo, 0);
 }
 
@@ -190,6 +207,11 @@ void MCU_SPIWrite24(uint32_t DataToWrite)
 	spi_writen(SPIM, (uint8_t *)&DataToWrite, 3);
 }
 
+void MCU_SPIRead(uint8_t *DataRead, uint32_t length)
+{
+	spi_readn(SPIM, DataRead, length);
+}
+
 uint32_t MCU_SPIRead32(void)
 {
 	uint32_t DataRead = 0;
@@ -209,6 +231,80 @@ void MCU_SPIWrite(const uint8_t *DataToWrite, uint32_t length)
 	spi_writen(SPIM, DataToWrite, length);
 }
 
+void MCU_SPIWriteBurst(const uint8_t *DataToWrite, uint32_t length)
+{
+	// Let the FIFO keep the SPI clock running between bytes.
+	spi_option(SPIM, spi_option_fifo, 1);
+
+	spi_writen(SPIM, DataToWrite, length);
+
+	// Chip select must not be raised until the last byte has left the
+	// FIFO and the shift register.
+	while (SPIM->SPI_TX_FIFO_COUNT)
+	{
+	}
+	while (!(SPIM->SPI_STATUS & SPIM_STATUS_SPIF))
+	{
+	}
+
+	spi_option(SPIM, spi_option_fifo, 0);
+}
+
+void MCU_SPIWriteFlash(uintptr_t DataToWrite, uint32_t length)
+{
+	uint8_t block[SPIM_FIFO_SIZE] __attribute__((aligned(4)));
+	uint32_t size;
+
+	spi_option(SPIM, spi_option_fifo, 1);
+
+	while (length)
+	{
+		size = (length < SPIM_FIFO_SIZE) ? length : SPIM_FIFO_SIZE;
+
+		// Flash is read in words. While this block is read the FIFO is
+		// still sending the previous one.
+		memcpy_flash2dat(block, DataToWrite, (size + 3) & (~3));
+		// Returns once the block is in the FIFO.
+		spi_writen(SPIM, block, size);
+
+		DataToWrite += size;
+		length -= size;
+	}
+
+	while (SPIM->SPI_TX_FIFO_COUNT)
+	{
+	}
+	while (!(SPIM->SPI_STATUS & SPIM_STATUS_SPIF))
+	{
+	}
+
+	spi_option(SPIM, spi_option_fifo, 0);
+}
+
+static void MCU_IntISR(void)
+{
+	if (gpio_is_interrupted(PIN_NUM_INT))
+	{
+		if (MCU_IntHandler)
+		{
+			MCU_IntHandler();
+		}
+	}
+}
+
+void MCU_IntSetup(void (*handler)(void))
+{
+	MCU_IntHandler = handler;
+
+	// INT_N is open drain and active low.
+	gpio_function(PIN_NUM_INT, pad_gpio42);
+	gpio_dir(PIN_NUM_INT, pad_dir_input);
+	gpio_pull(PIN_NUM_INT, pad_pull_pullup);
+
+	interrupt_attach(interrupt_gpio, (uint8_t)interrupt_gpio, MCU_IntISR);
+	gpio_interrupt_enable(PIN_NUM_INT, gpio_int_edge_falling);
+}
+
 void MCU_Delay_20ms(void)
 {
 	delayms(20);
@@ -0,0 +1,1298 @@
+/**
+ @file EVE_MCU_HOST.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+// Host simulation of an FT81x behind the MCU layer. Used to run the EVE
+// library and eve_ui on a PC without hardware.
+//
+// The simulator holds RAM_G, RAM_DL, the registers and RAM_CMD. Writing
+// REG_CMD_WRITE runs the co-processor, which advances REG_CMD_READ and
+// REG_CMD_DL. Display list commands are copied to RAM_DL, memory commands
+// and CMD_INFLATE are performed and result words (CMD_GETPROPS, CMD_GETPTR,
+// CMD_REGREAD, CMD_MEMCRC, CMD_CALIBRATE) are written back. Widgets are not
+// rendered: each one leaves NOP instructions in the display list. JPEG and
+// PNG data for CMD_LOADIMAGE is consumed and only the image size decoded.
+// AVI data for CMD_PLAYVIDEO is consumed to the end of the RIFF chunk and
+// each video frame is counted as a display frame.
+//
+// Time is simulated from the number of bytes transferred on SPI and the
+// delay functions. REG_FRAMES follows this time at 60 frames a second.
+//
+// Environment variables:
+//   EVE_HOST_TRACE - file to record every chip select cycle to, in the
+//                    EVE_SPI_TRACE record format (see HAL.h) with the data.
+//                    Decode with Scripts/eve_trace.py --binary.
+//   EVE_HOST_SCREENS - file to write the SPI traffic for each screen to.
+//                    One line is written for each CMD_SWAP with the chip
+//                    select cycles, MCU SPI driver calls and bytes written
+//                    and read since the previous one. Each driver call is
+//                    one spi_writen or spi_readn on the FT9xx.
+//   EVE_HOST_TOUCH - touch script. One event per line:
+//                    <ms> touch <tag> <x> <y>
+//                    <ms> release
+//                    <ms> end
+//                    Times are simulated milliseconds. "end" exits the
+//                    program after printing a summary.
+//
+// Scripts/host builds a test driver against this file. "make check" there
+// runs its touch scripts and compares the traces with the golden files.
+
+// Guard against being used for incorrect CPU type.
+#ifndef __FT32__
+
+#pragma message "Compiling " __FILE__ " for host simulation"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h> // for Uint8/16/32 and Int8/16/32 data types
+
+#include <zlib.h>
+
+#include "../include/EVE_config.h"
+#include "../include/MCU.h"
+
+// Simulated memory areas
+#define SIM_RAM_DL_SIZE (8 * 1024)
+#define SIM_RAM_REG_SIZE (4 * 1024)
+#define SIM_TRACKER_SIZE 32
+
+// Time to transfer one byte on quad SPI at 30 MHz
+#define SIM_SPI_NS_PER_BYTE 67
+// Display frame time at 60 Hz
+#define SIM_FRAME_NS 16666667ULL
+
+// Trace record types. Must match HAL.h.
+#define SIM_TRACE_READ 0
+#define SIM_TRACE_WRITE 1
+#define SIM_TRACE_HOST 2
+
+// Chip select cycle state
+#define SIM_SPI_IDLE 0
+#define SIM_SPI_HEADER 1
+#define SIM_SPI_WRITE 2
+#define SIM_SPI_READ 3
+
+// Co-processor data phases for commands followed by data
+#define SIM_DATA_NONE 0
+#define SIM_DATA_MEMWRITE 1
+#define SIM_DATA_INFLATE 2
+#define SIM_DATA_IMAGE 3
+#define SIM_DATA_VIDEO 4
+
+// Longest touch script
+#define SIM_TOUCH_EVENTS 256
+
+static uint8_t simRamG[RAM_G_SIZE];
+static uint8_t simRamDL[SIM_RAM_DL_SIZE];
+static uint8_t simRamReg[SIM_RAM_REG_SIZE];
+static uint8_t simRamCmd[FT_CMD_FIFO_SIZE];
+static uint8_t simTracker[SIM_TRACKER_SIZE];
+
+// Current chip select cycle
+static uint8_t simSpiState = SIM_SPI_IDLE;
+static uint8_t simHeader[4];
+static uint8_t simHeaderLength;
+static uint32_t simAddress;
+static uint32_t simStart;
+static uint32_t simLength;
+static uint8_t *simData = NULL;
+static uint32_t simDataSize = 0;
+
+// Simulated time in nanoseconds
+static uint64_t simTime = 0;
+
+// Co-processor state
+static uint32_t simCmdDL = 0;
+static uint8_t simDataPhase = SIM_DATA_NONE;
+static uint32_t simDataDest;
+static uint32_t simDataLeft;
+static uint32_t simDataUsed;
+static z_stream simZ;
+static uint8_t simImage[4];
+static uint32_t simImageWidth;
+static uint32_t simImageHeight;
+static uint32_t simImagePtr;
+static uint8_t simImagePng;
+static uint8_t simImageSof;
+static uint8_t simImageTail;
+static uint32_t simLastPtr;
+
+// Media FIFO. Set while a command reads its data from the media FIFO
+// instead of RAM_CMD. REG_CMD_READ stays on the command until it is done.
+static uint32_t simFifoAddress;
+static uint32_t simFifoSize;
+static uint8_t simFifoData = 0;
+static uint32_t simFifoCommand;
+
+// Statistics
+static uint32_t simFrames = 0;
+static uint32_t simTransactions = 0;
+static uint64_t simBytes = 0;
+static uint64_t simCalls = 0;
+
+// SPI driver calls in the current chip select cycle
+static uint32_t simCycleCalls = 0;
+
+// SPI traffic since the last screen, for writes and for reads
+static struct
+{
+	uint32_t transactions;
+	uint32_t calls;
+	uint64_t bytes;
+} simScreen[2];
+static uint32_t simScreenCount = 0;
+
+static FILE *simTrace = NULL;
+static FILE *simScreens = NULL;
+
+static struct
+{
+	uint32_t time;
+	uint8_t tag;
+	uint16_t x;
+	uint16_t y;
+	uint8_t type;
+} simTouch[SIM_TOUCH_EVENTS];
+static uint32_t simTouchCount = 0;
+static uint32_t simTouchNext = 0;
+
+#define SIM_TOUCH_PRESS 0
+#define SIM_TOUCH_RELEASE 1
+#define SIM_TOUCH_END 2
+
+// Handler called when EVE asserts INT_N
+static void (*MCU_IntHandler)(void) = NULL;
+
+// Co-processor commands. Parameter words and whether a string follows.
+static const struct
+{
+	uint32_t cmd;
+	uint8_t params;
+	uint8_t string;
+} simCommands[] = {
+	{CMD_APPEND, 2, 0}, {CMD_BGCOLOR, 1, 0}, {CMD_BITMAP_TRANSFORM, 13, 0},
+	{CMD_BUTTON, 3, 1}, {CMD_CALIBRATE, 1, 0}, {CMD_CLOCK, 4, 0},
+	{CMD_COLDSTART, 0, 0}, {CMD_CSKETCH, 5, 0}, {CMD_DIAL, 3, 0},
+	{CMD_DLSTART, 0, 0}, {CMD_FGCOLOR, 1, 0}, {CMD_GAUGE, 4, 0},
+	{CMD_GETMATRIX, 6, 0}, {CMD_GETPROPS, 3, 0}, {CMD_GETPTR, 1, 0},
+	{CMD_GRADCOLOR, 1, 0}, {CMD_GRADIENT, 4, 0}, {CMD_INFLATE, 1, 0},
+	{CMD_INTERRUPT, 1, 0}, {CMD_KEYS, 3, 1}, {CMD_LOADIDENTITY, 0, 0},
+	{CMD_LOADIMAGE, 2, 0}, {CMD_LOGO, 0, 0}, {CMD_MEDIAFIFO, 2, 0},
+	{CMD_MEMCPY, 3, 0}, {CMD_MEMCRC, 3, 0}, {CMD_MEMSET, 3, 0},
+	{CMD_MEMWRITE, 2, 0}, {CMD_MEMZERO, 2, 0}, {CMD_NUMBER, 3, 0},
+	{CMD_PLAYVIDEO, 1, 0}, {CMD_PROGRESS, 4, 0}, {CMD_REGREAD, 2, 0},
+	{CMD_ROMFONT, 2, 0}, {CMD_ROTATE, 1, 0}, {CMD_SCALE, 2, 0},
+	{CMD_SCREENSAVER, 0, 0}, {CMD_SCROLLBAR, 4, 0}, {CMD_SETBASE, 1, 0},
+	{CMD_SETBITMAP, 3, 0}, {CMD_SETFONT, 2, 0}, {CMD_SETFONT2, 3, 0},
+	{CMD_SETMATRIX, 0, 0}, {CMD_SETROTATE, 1, 0}, {CMD_SETSCRATCH, 1, 0},
+	{CMD_SKETCH, 4, 0}, {CMD_SLIDER, 4, 0}, {CMD_SNAPSHOT, 1, 0},
+	{CMD_SNAPSHOT2, 4, 0}, {CMD_SPINNER, 2, 0}, {CMD_STOP, 0, 0},
+	{CMD_SWAP, 0, 0}, {CMD_SYNC, 0, 0}, {CMD_TEXT, 2, 1},
+	{CMD_TOGGLE, 3, 1}, {CMD_TRACK, 3, 0}, {CMD_TRANSLATE, 2, 0},
+	{CMD_VIDEOFRAME, 2, 0}, {CMD_VIDEOSTART, 0, 0},
+};
+
+// ######################### SIMULATED MEMORY ##################################
+
+// ----------------- Map an EVE address to simulated memory --------------------
+static uint8_t *SIM_Map(uint32_t address)
+{
+	address &= 0x3fffff;
+
+	if (address < RAM_G_SIZE)
+	{
+		return &simRamG[address];
+	}
+	if ((address >= RAM_DL) && (address < RAM_DL + SIM_RAM_DL_SIZE))
+	{
+		return &simRamDL[address - RAM_DL];
+	}
+	if ((address >= RAM_REG) && (address < RAM_REG + SIM_RAM_REG_SIZE))
+	{
+		return &simRamReg[address - RAM_REG];
+	}
+	if ((address >= RAM_CMD) && (address < RAM_CMD + FT_CMD_FIFO_SIZE))
+	{
+		return &simRamCmd[address - RAM_CMD];
+	}
+	if ((address >= REG_TRACKER) && (address < REG_TRACKER + SIM_TRACKER_SIZE))
+	{
+		return &simTracker[address - REG_TRACKER];
+	}
+	// ROM and unmapped areas read as zero.
+	return NULL;
+}
+
+static uint8_t SIM_Read8(uint32_t address)
+{
+	uint8_t *p = SIM_Map(address);
+
+	return p ? *p : 0;
+}
+
+static void SIM_Write8(uint32_t address, uint8_t val8)
+{
+	uint8_t *p = SIM_Map(address);
+
+	if (p)
+	{
+		*p = val8;
+	}
+}
+
+static uint32_t SIM_Read32(uint32_t address)
+{
+	return SIM_Read8(address) | (SIM_Read8(address + 1) << 8)
+			| (SIM_Read8(address + 2) << 16) | ((uint32_t)SIM_Read8(address + 3) << 24);
+}
+
+static void SIM_Write32(uint32_t address, uint32_t val32)
+{
+	SIM_Write8(address, val32);
+	SIM_Write8(address + 1, val32 >> 8);
+	SIM_Write8(address + 2, val32 >> 16);
+	SIM_Write8(address + 3, val32 >> 24);
+}
+
+// ######################### STATISTICS ########################################
+
+// -------------- Report the SPI traffic used to draw a screen -----------------
+static void SIM_ScreenReport(void)
+{
+	if (simScreens)
+	{
+		fprintf(simScreens, "screen %u: write %u transactions %u calls %llu bytes, "
+				"read %u transactions %u calls %llu bytes\n", simScreenCount,
+				simScreen[0].transactions, simScreen[0].calls, (unsigned long long)simScreen[0].bytes,
+				simScreen[1].transactions, simScreen[1].calls, (unsigned long long)simScreen[1].bytes);
+	}
+
+	memset(simScreen, 0, sizeof(simScreen));
+	simScreenCount++;
+}
+
+// ######################### CO-PROCESSOR ######################################
+
+// Offsets are from REG_CMD_READ and wrap in RAM_CMD.
+static uint8_t SIM_CmdByte(uint32_t offset)
+{
+	return simRamCmd[(SIM_Read32(REG_CMD_READ) + offset) & (FT_CMD_FIFO_SIZE - 1)];
+}
+
+// Data for a command from RAM_CMD or the media FIFO.
+static uint8_t SIM_DataByte(uint32_t offset)
+{
+	if (simFifoData)
+	{
+		return SIM_Read8(simFifoAddress
+				+ ((SIM_Read32(REG_MEDIAFIFO_READ) + offset) % simFifoSize));
+	}
+	return SIM_CmdByte(offset);
+}
+
+static uint32_t SIM_CmdWord(uint32_t offset)
+{
+	return SIM_CmdByte(offset) | (SIM_CmdByte(offset + 1) << 8)
+			| (SIM_CmdByte(offset + 2) << 16) | ((uint32_t)SIM_CmdByte(offset + 3) << 24);
+}
+
+static void SIM_CmdResult(uint32_t offset, uint32_t val32)
+{
+	SIM_Write32(RAM_CMD + ((SIM_Read32(REG_CMD_READ) + offset) & (FT_CMD_FIFO_SIZE - 1)), val32);
+}
+
+static void SIM_CmdAdvance(uint32_t length)
+{
+	SIM_Write32(REG_CMD_READ, (SIM_Read32(REG_CMD_READ) + length) & (FT_CMD_FIFO_SIZE - 1));
+}
+
+static void SIM_DisplayList(uint32_t val32)
+{
+	SIM_Write32(RAM_DL + (simCmdDL & (SIM_RAM_DL_SIZE - 1)), val32);
+	simCmdDL = (simCmdDL + 4) & (SIM_RAM_DL_SIZE - 1);
+	SIM_Write32(REG_CMD_DL, simCmdDL);
+}
+
+// Big-endian word from the last four image bytes
+static uint32_t SIM_ImageWord(void)
+{
+	return ((uint32_t)simImage[0] << 24) | (simImage[1] << 16) | (simImage[2] << 8) | simImage[3];
+}
+
+// ------- Consume data following CMD_MEMWRITE, INFLATE, LOADIMAGE or PLAYVIDEO ------
+// Returns the number of bytes used from the available data.
+static uint32_t SIM_CmdData(uint32_t available)
+{
+	uint8_t buffer[512];
+	uint32_t used = 0;
+	uint32_t i;
+	uint8_t b;
+	int ret;
+
+	while ((used < available) && (simDataPhase != SIM_DATA_NONE))
+	{
+		b = SIM_DataByte(used);
+		used++;
+		simDataUsed++;
+
+		if (simDataPhase == SIM_DATA_MEMWRITE)
+		{
+			if (simDataLeft)
+			{
+				SIM_Write8(simDataDest++, b);
+				simDataLeft--;
+			}
+			if ((simDataLeft == 0) && ((simDataUsed & 3) == 0))
+			{
+				simDataPhase = SIM_DATA_NONE;
+			}
+		}
+		else if (simDataPhase == SIM_DATA_INFLATE)
+		{
+			if (simDataLeft)
+			{
+				// Skip padding after the end of the deflate stream.
+				if ((simDataUsed & 3) == 0)
+				{
+					simDataPhase = SIM_DATA_NONE;
+				}
+				continue;
+			}
+			simZ.next_in = &b;
+			simZ.avail_in = 1;
+			do
+			{
+				simZ.next_out = buffer;
+				simZ.avail_out = sizeof(buffer);
+				ret = inflate(&simZ, Z_NO_FLUSH);
+				for (i = 0; i < sizeof(buffer) - simZ.avail_out; i++)
+				{
+					SIM_Write8(simDataDest++, buffer[i]);
+				}
+			} while ((simZ.avail_out == 0) && (ret == Z_OK));
+
+			if (ret != Z_OK)
+			{
+				if (ret != Z_STREAM_END)
+				{
+					fprintf(stderr, "eve host: CMD_INFLATE data error\n");
+				}
+				inflateEnd(&simZ);
+				simLastPtr = simDataDest;
+				simDataLeft = 1;
+				if ((simDataUsed & 3) == 0)
+				{
+					simDataPhase = SIM_DATA_NONE;
+				}
+			}
+		}
+		else if (simDataPhase == SIM_DATA_IMAGE)
+		{
+			// Keep the last four bytes to find markers and sizes.
+			memmove(simImage, simImage + 1, 3);
+			simImage[3] = b;
+
+			if (simDataLeft)
+			{
+				// Image complete. Skip padding.
+				if ((simDataUsed & 3) == 0)
+				{
+					simDataPhase = SIM_DATA_NONE;
+				}
+				continue;
+			}
+
+			if (simDataUsed == 1)
+			{
+				simImagePng = (b == 0x89);
+			}
+
+			if (simImagePng)
+			{
+				// IHDR holds the width and height at offsets 16 and 20.
+				if (simDataUsed == 20)
+				{
+					simImageWidth = SIM_ImageWord();
+				}
+				else if (simDataUsed == 24)
+				{
+					simImageHeight = SIM_ImageWord();
+				}
+				else if (simImageTail)
+				{
+					// CRC of the IEND chunk.
+					if (--simImageTail == 0)
+					{
+						simDataLeft = 1;
+					}
+				}
+				else if (memcmp(simImage, "IEND", 4) == 0)
+				{
+					simImageTail = 4;
+				}
+			}
+			else
+			{
+				// Baseline JPEG. The frame header marker is followed by the
+				// length, precision, height and width.
+				if (simImageSof)
+				{
+					if (simImageSof < 8)
+					{
+						simImageSof++;
+					}
+					if (simImageSof == 6)
+					{
+						simImageHeight = SIM_ImageWord() & 0xffff;
+					}
+					else if (simImageSof == 8)
+					{
+						simImageWidth = SIM_ImageWord() & 0xffff;
+						simImageSof++;
+					}
+				}
+				else if ((simImage[2] == 0xff) && ((simImage[3] & 0xfc) == 0xc0))
+				{
+					simImageSof = 1;
+				}
+				if ((simImage[2] == 0xff) && (simImage[3] == 0xd9))
+				{
+					// End of image.
+					simDataLeft = 1;
+				}
+			}
+
+			if ((simDataLeft) && ((simDataUsed & 3) == 0))
+			{
+				simDataPhase = SIM_DATA_NONE;
+			}
+		}
+		else if (simDataPhase == SIM_DATA_VIDEO)
+		{
+			memmove(simImage, simImage + 1, 3);
+			simImage[3] = b;
+
+			// The RIFF chunk size gives the length of the file.
+			if (simDataUsed == 8)
+			{
+				simDataLeft = 8 + (simImage[0] | (simImage[1] << 8)
+						| (simImage[2] << 16) | ((uint32_t)simImage[3] << 24));
+			}
+			else if ((simDataUsed > 8) && (simDataUsed < simDataLeft)
+					&& (simImage[2] == 'd') && ((simImage[3] == 'c') || (simImage[3] == 'b'))
+					&& (isdigit(simImage[0])) && (isdigit(simImage[1])))
+			{
+				simFrames++;
+			}
+
+			if ((simDataUsed >= 8) && (simDataUsed >= simDataLeft) && ((simDataUsed & 3) == 0))
+			{
+				simDataPhase = SIM_DATA_NONE;
+			}
+		}
+	}
+
+	if ((simDataPhase == SIM_DATA_NONE) && (simImagePtr != 0xffffffff))
+	{
+		simLastPtr = simImagePtr + (simImageWidth * simImageHeight * 2);
+		simImagePtr = 0xffffffff;
+	}
+
+	return used;
+}
+
+// ---------------------- Execute one co-processor command ---------------------
+// Returns the length of the command or 0 if it is not complete.
+static uint32_t SIM_CmdExecute(uint32_t available)
+{
+	uint32_t cmd = SIM_CmdWord(0);
+	uint32_t length;
+	uint32_t i;
+	uint32_t p1, p2, p3;
+
+	if ((cmd & 0xffffff00) != 0xffffff00)
+	{
+		SIM_DisplayList(cmd);
+		return 4;
+	}
+
+	for (i = 0; i < sizeof(simCommands) / sizeof(simCommands[0]); i++)
+	{
+		if (simCommands[i].cmd == cmd)
+		{
+			break;
+		}
+	}
+	if (i == sizeof(simCommands) / sizeof(simCommands[0]))
+	{
+		fprintf(stderr, "eve host: co-processor fault, unknown command 0x%08x\n", cmd);
+		SIM_Write32(REG_CMD_READ, 0xfff);
+		return 0;
+	}
+
+	length = 4 + (simCommands[i].params * 4);
+	if (available < length)
+	{
+		return 0;
+	}
+	if (simCommands[i].string)
+	{
+		while (1)
+		{
+			if (length >= available)
+			{
+				return 0;
+			}
+			if (SIM_CmdByte(length++) == 0)
+			{
+				break;
+			}
+		}
+		length = (length + 3) & (~3);
+		if (available < length)
+		{
+			return 0;
+		}
+		// Stand in for the glyphs drawn by the widget.
+		for (i = 4 + (simCommands[i].params * 4); i < length; i += 4)
+		{
+			SIM_DisplayList(NOP());
+		}
+	}
+
+	p1 = SIM_CmdWord(4);
+	p2 = SIM_CmdWord(8);
+	p3 = SIM_CmdWord(12);
+
+	switch (cmd)
+	{
+	case CMD_DLSTART:
+		simCmdDL = 0;
+		SIM_Write32(REG_CMD_DL, 0);
+		break;
+
+	case CMD_SWAP:
+		simFrames++;
+		SIM_ScreenReport();
+		break;
+
+	case CMD_APPEND:
+		for (i = 0; i < p2; i += 4)
+		{
+			SIM_DisplayList(SIM_Read32(p1 + i));
+		}
+		break;
+
+	case CMD_MEMCPY:
+		for (i = 0; i < p3; i++)
+		{
+			SIM_Write8(p1 + i, SIM_Read8(p2 + i));
+		}
+		break;
+
+	case CMD_MEMSET:
+		for (i = 0; i < p3; i++)
+		{
+			SIM_Write8(p1 + i, p2);
+		}
+		break;
+
+	case CMD_MEMZERO:
+		for (i = 0; i < p2; i++)
+		{
+			SIM_Write8(p1 + i, 0);
+		}
+		break;
+
+	case CMD_MEMCRC:
+		{
+			uLong crc = crc32(0L, Z_NULL, 0);
+
+			for (i = 0; i < p2; i++)
+			{
+				uint8_t b = SIM_Read8(p1 + i);
+				crc = crc32(crc, &b, 1);
+			}
+			SIM_CmdResult(12, crc);
+		}
+		break;
+
+	case CMD_MEMWRITE:
+		simDataPhase = SIM_DATA_MEMWRITE;
+		simDataDest = p1;
+		simDataLeft = p2;
+		simDataUsed = 0;
+		if (p2 == 0)
+		{
+			simDataPhase = SIM_DATA_NONE;
+		}
+		break;
+
+	case CMD_INFLATE:
+		memset(&simZ, 0, sizeof(simZ));
+		inflateInit(&simZ);
+		simDataPhase = SIM_DATA_INFLATE;
+		simDataDest = p1;
+		simDataLeft = 0;
+		simDataUsed = 0;
+		break;
+
+	case CMD_LOADIMAGE:
+		simImageWidth = 0;
+		simImageHeight = 0;
+		simImagePtr = p1;
+		simImagePng = 0;
+		simImageSof = 0;
+		simImageTail = 0;
+		memset(simImage, 0, sizeof(simImage));
+		simDataPhase = SIM_DATA_IMAGE;
+		simDataLeft = 0;
+		simDataUsed = 0;
+		if (p2 & OPT_MEDIAFIFO)
+		{
+			// Completes when the image has been read from the FIFO.
+			simFifoData = 1;
+			simFifoCommand = length;
+			return 0;
+		}
+		break;
+
+	case CMD_PLAYVIDEO:
+		memset(simImage, 0, sizeof(simImage));
+		simDataPhase = SIM_DATA_VIDEO;
+		simDataLeft = 0;
+		simDataUsed = 0;
+		if (p1 & OPT_MEDIAFIFO)
+		{
+			// Completes when the video has been read from the FIFO.
+			simFifoData = 1;
+			simFifoCommand = length;
+			return 0;
+		}
+		break;
+
+	case CMD_MEDIAFIFO:
+		simFifoAddress = p1;
+		simFifoSize = p2;
+		SIM_Write32(REG_MEDIAFIFO_READ, 0);
+		SIM_Write32(REG_MEDIAFIFO_WRITE, 0);
+		break;
+
+	case CMD_GETPROPS:
+		SIM_CmdResult(4, simLastPtr);
+		SIM_CmdResult(8, simImageWidth & 0xffff);
+		SIM_CmdResult(12, simImageHeight & 0xffff);
+		break;
+
+	case CMD_GETPTR:
+		SIM_CmdResult(4, simLastPtr);
+		break;
+
+	case CMD_REGREAD:
+		SIM_CmdResult(8, SIM_Read32(p1));
+		break;
+
+	case CMD_CALIBRATE:
+		SIM_CmdResult(4, 1);
+		break;
+
+	default:
+		break;
+	}
+
+	return length;
+}
+
+// --------------- Run the co-processor up to REG_CMD_WRITE --------------------
+static void SIM_CmdRun(void)
+{
+	uint32_t available;
+	uint32_t used;
+
+	while (1)
+	{
+		if (SIM_Read32(REG_CMD_READ) == 0xfff)
+		{
+			// Faulted. Recovers when REG_CPURESET is toggled.
+			return;
+		}
+
+		if (simFifoData)
+		{
+			available = (SIM_Read32(REG_MEDIAFIFO_WRITE) + simFifoSize
+					- SIM_Read32(REG_MEDIAFIFO_READ)) % simFifoSize;
+			used = SIM_CmdData(available);
+			SIM_Write32(REG_MEDIAFIFO_READ,
+					(SIM_Read32(REG_MEDIAFIFO_READ) + used) % simFifoSize);
+			if (simDataPhase != SIM_DATA_NONE)
+			{
+				return;
+			}
+			simFifoData = 0;
+			SIM_CmdAdvance(simFifoCommand);
+			continue;
+		}
+
+		available = (SIM_Read32(REG_CMD_WRITE) - SIM_Read32(REG_CMD_READ)) & (FT_CMD_FIFO_SIZE - 1);
+		if (available == 0)
+		{
+			return;
+		}
+
+		if (simDataPhase != SIM_DATA_NONE)
+		{
+			used = SIM_CmdData(available);
+		}
+		else
+		{
+			used = SIM_CmdExecute(available);
+		}
+		if (used == 0)
+		{
+			if (simFifoData)
+			{
+				// Data may already be waiting in the media FIFO.
+				continue;
+			}
+			return;
+		}
+		SIM_CmdAdvance(used);
+	}
+}
+
+// ############################ TOUCH SCRIPT ###################################
+
+static void SIM_TouchLoad(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[128];
+	char type[16];
+	unsigned int time, tag, x, y;
+	int n;
+
+	if (f == NULL)
+	{
+		fprintf(stderr, "eve host: cannot open touch script %s\n", path);
+		exit(1);
+	}
+
+	while ((fgets(line, sizeof(line), f)) && (simTouchCount < SIM_TOUCH_EVENTS))
+	{
+		n = sscanf(line, "%u %15s %u %u %u", &time, type, &tag, &x, &y);
+		if ((n < 2) || (line[0] == '#'))
+		{
+			continue;
+		}
+		simTouch[simTouchCount].time = time;
+		if ((strcmp(type, "touch") == 0) && (n == 5))
+		{
+			simTouch[simTouchCount].type = SIM_TOUCH_PRESS;
+			simTouch[simTouchCount].tag = tag;
+			simTouch[simTouchCount].x = x;
+			simTouch[simTouchCount].y = y;
+		}
+		else if (strcmp(type, "release") == 0)
+		{
+			simTouch[simTouchCount].type = SIM_TOUCH_RELEASE;
+		}
+		else if (strcmp(type, "end") == 0)
+		{
+			simTouch[simTouchCount].type = SIM_TOUCH_END;
+		}
+		else
+		{
+			fprintf(stderr, "eve host: bad touch script line: %s", line);
+			continue;
+		}
+		simTouchCount++;
+	}
+	fclose(f);
+}
+
+static void SIM_Summary(void)
+{
+	fprintf(stderr, "eve host: %u frames %u transactions %llu calls %llu bytes %llu ms\n",
+			simFrames, simTransactions, (unsigned long long)simCalls, (unsigned long long)simBytes,
+			(unsigned long long)(simTime / 1000000));
+
+	if (simTrace)
+	{
+		fclose(simTrace);
+		simTrace = NULL;
+	}
+	if (simScreens)
+	{
+		fclose(simScreens);
+		simScreens = NULL;
+	}
+}
+
+// --------------- Apply touch events up to the simulated time -----------------
+static void SIM_TouchUpdate(void)
+{
+	uint8_t flags;
+	uint8_t tag;
+
+	SIM_Write32(REG_FRAMES, (uint32_t)(simTime / SIM_FRAME_NS));
+	SIM_Write32(REG_CLOCK, (uint32_t)(simTime * 60 / 1000));
+
+	while ((simTouchNext < simTouchCount)
+			&& (simTouch[simTouchNext].time <= simTime / 1000000))
+	{
+		tag = SIM_Read8(REG_TOUCH_TAG);
+		flags = 0;
+
+		switch (simTouch[simTouchNext].type)
+		{
+		case SIM_TOUCH_PRESS:
+			SIM_Write32(REG_TOUCH_TAG, simTouch[simTouchNext].tag);
+			SIM_Write32(REG_TOUCH_SCREEN_XY,
+					(simTouch[simTouchNext].x << 16) | simTouch[simTouchNext].y);
+			SIM_Write32(REG_TOUCH_TAG_XY, SIM_Read32(REG_TOUCH_SCREEN_XY));
+			SIM_Write32(REG_TOUCH_RAW_XY, SIM_Read32(REG_TOUCH_SCREEN_XY));
+			SIM_Write32(REG_TOUCH_RZ, 100);
+			flags = INT_TOUCH;
+			break;
+
+		case SIM_TOUCH_RELEASE:
+			SIM_Write32(REG_TOUCH_TAG, 0);
+			SIM_Write32(REG_TOUCH_SCREEN_XY, 0x80008000);
+			SIM_Write32(REG_TOUCH_TAG_XY, 0x80008000);
+			SIM_Write32(REG_TOUCH_RAW_XY, 0xffffffff);
+			SIM_Write32(REG_TOUCH_RZ, 32767);
+			flags = INT_TOUCH;
+			break;
+
+		case SIM_TOUCH_END:
+			// The summary is printed on exit.
+			exit(0);
+		}
+		simTouchNext++;
+
+		if (SIM_Read8(REG_TOUCH_TAG) != tag)
+		{
+			flags |= INT_TAG;
+		}
+		SIM_Write8(REG_INT_FLAGS, SIM_Read8(REG_INT_FLAGS) | flags);
+
+		if ((SIM_Read8(REG_INT_EN) & 1)
+				&& (SIM_Read8(REG_INT_FLAGS) & SIM_Read8(REG_INT_MASK))
+				&& (MCU_IntHandler))
+		{
+			MCU_IntHandler();
+		}
+	}
+}
+
+// ######################### CHIP SELECT CYCLES ################################
+
+static void SIM_DataAdd(uint8_t val8)
+{
+	if (simLength >= simDataSize)
+	{
+		simDataSize = simDataSize ? simDataSize * 2 : 4096;
+		simData = realloc(simData, simDataSize);
+		if (simData == NULL)
+		{
+			fprintf(stderr, "eve host: out of memory\n");
+			exit(1);
+		}
+	}
+	simData[simLength++] = val8;
+}
+
+// ------------------- Write a record in the EVE_SPI_TRACE format --------------
+static void SIM_TraceRecord(uint8_t type, uint32_t address)
+{
+	uint32_t header[3];
+	static const uint8_t pad[3] = {0, 0, 0};
+
+	simTransactions++;
+	simBytes += simHeaderLength + simLength;
+	simCalls += simCycleCalls;
+
+	// Host commands are counted with writes.
+	simScreen[type == SIM_TRACE_READ].transactions++;
+	simScreen[type == SIM_TRACE_READ].calls += simCycleCalls;
+	simScreen[type == SIM_TRACE_READ].bytes += simHeaderLength + simLength;
+
+	if (simTrace == NULL)
+	{
+		return;
+	}
+
+	header[0] = MCU_htole32((address & 0x00ffffff) | (type << 24));
+	header[1] = MCU_htole32(simLength);
+	header[2] = MCU_htole32(simLength);
+	fwrite(header, sizeof(header), 1, simTrace);
+	fwrite(simData, 1, simLength, simTrace);
+	fwrite(pad, 1, (4 - (simLength & 3)) & 3, simTrace);
+}
+
+static void SIM_SpiByte(uint8_t *val8)
+{
+	simTime += SIM_SPI_NS_PER_BYTE;
+
+	switch (simSpiState)
+	{
+	case SIM_SPI_HEADER:
+		simHeader[simHeaderLength++] = *val8;
+		*val8 = 0;
+		if (simHeaderLength == 3)
+		{
+			simAddress = ((simHeader[0] & 0x3f) << 16) | (simHeader[1] << 8) | simHeader[2];
+			if ((simHeader[0] & 0xc0) == 0x80)
+			{
+				simSpiState = SIM_SPI_WRITE;
+			}
+		}
+		else if (simHeaderLength == 4)
+		{
+			// Dummy byte of a read.
+			simSpiState = SIM_SPI_READ;
+		}
+		simStart = simAddress;
+		break;
+
+	case SIM_SPI_WRITE:
+		SIM_Write8(simAddress, *val8);
+		SIM_DataAdd(*val8);
+		simAddress = ((simAddress >= RAM_CMD) && (simAddress < RAM_CMD + FT_CMD_FIFO_SIZE))
+				? RAM_CMD + ((simAddress + 1) & (FT_CMD_FIFO_SIZE - 1)) : simAddress + 1;
+		break;
+
+	case SIM_SPI_READ:
+		*val8 = SIM_Read8(simAddress);
+		SIM_DataAdd(*val8);
+		simAddress++;
+		break;
+
+	default:
+		break;
+	}
+}
+
+// ------------------- MCU specific initialisation  ----------------------------
+void MCU_Init(void)
+{
+	const char *path;
+
+	memset(simRamReg, 0, sizeof(simRamReg));
+	SIM_Write8(REG_ID, 0x7c);
+	SIM_Write32(REG_FREQUENCY, 60000000);
+	// Chip ID in RAM_G before the co-processor starts.
+	SIM_Write32(RAM_G + 0xc0000, 0x00011208);
+	simImagePtr = 0xffffffff;
+
+	path = getenv("EVE_HOST_TRACE");
+	if ((path) && (simTrace == NULL))
+	{
+		simTrace = fopen(path, "wb");
+		if (simTrace == NULL)
+		{
+			fprintf(stderr, "eve host: cannot create trace %s\n", path);
+			exit(1);
+		}
+	}
+
+	path = getenv("EVE_HOST_SCREENS");
+	if ((path) && (simScreens == NULL))
+	{
+		simScreens = fopen(path, "w");
+		if (simScreens == NULL)
+		{
+			fprintf(stderr, "eve host: cannot create %s\n", path);
+			exit(1);
+		}
+	}
+
+	path = getenv("EVE_HOST_TOUCH");
+	if ((path) && (simTouchCount == 0))
+	{
+		SIM_TouchLoad(path);
+	}
+
+	// Release state for touch registers.
+	SIM_Write32(REG_TOUCH_SCREEN_XY, 0x80008000);
+	SIM_Write32(REG_TOUCH_TAG_XY, 0x80008000);
+	SIM_Write32(REG_TOUCH_RAW_XY, 0xffffffff);
+	SIM_Write32(REG_TOUCH_RZ, 32767);
+
+	atexit(SIM_Summary);
+}
+
+void MCU_Setup(void)
+{
+}
+
+// ########################### GPIO CONTROL ####################################
+
+// --------------------- Chip Select line low ----------------------------------
+void MCU_CSlow(void)
+{
+	simSpiState = SIM_SPI_HEADER;
+	simHeaderLength = 0;
+	simLength = 0;
+	simCycleCalls = 0;
+}
+
+// --------------------- Chip Select line high ---------------------------------
+void MCU_CShigh(void)
+{
+	uint32_t end = simStart + simLength;
+
+	switch (simSpiState)
+	{
+	case SIM_SPI_WRITE:
+		SIM_TraceRecord(SIM_TRACE_WRITE, simStart);
+		if ((simStart <= REG_CPURESET) && (end > REG_CPURESET) && (SIM_Read8(REG_CPURESET) & 1))
+		{
+			// Co-processor reset.
+			SIM_Write32(REG_CMD_READ, 0);
+			SIM_Write32(REG_CMD_WRITE, 0);
+			simDataPhase = SIM_DATA_NONE;
+			simFifoData = 0;
+		}
+		if (((simStart <= REG_CMD_WRITE) && (end > REG_CMD_WRITE))
+				|| ((simStart <= REG_MEDIAFIFO_WRITE) && (end > REG_MEDIAFIFO_WRITE)))
+		{
+			SIM_CmdRun();
+		}
+		break;
+
+	case SIM_SPI_READ:
+		SIM_TraceRecord(SIM_TRACE_READ, simStart);
+		if ((simStart <= REG_INT_FLAGS) && (end > REG_INT_FLAGS))
+		{
+			// Cleared by reading.
+			SIM_Write8(REG_INT_FLAGS, 0);
+		}
+		break;
+
+	case SIM_SPI_HEADER:
+		if (simHeaderLength == 3)
+		{
+			// Host commands are three bytes with no data.
+			SIM_TraceRecord(SIM_TRACE_HOST, simHeader[0] | (simHeader[1] << 8));
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	simSpiState = SIM_SPI_IDLE;
+	SIM_TouchUpdate();
+}
+
+// -------------------------- PD line low --------------------------------------
+void MCU_PDlow(void)
+{
+}
+
+// ------------------------- PD line high --------------------------------------
+void MCU_PDhigh(void)
+{
+}
+
+// --------------------- SPI Send and Receive ----------------------------------
+
+// Each MCU_SPI function counts as one call to the SPI driver.
+static void SIM_SpiRead(uint8_t *DataRead, uint32_t length)
+{
+	simCycleCalls++;
+	while (length--)
+	{
+		*DataRead = 0;
+		SIM_SpiByte(DataRead++);
+	}
+}
+
+static void SIM_SpiWrite(const uint8_t *DataToWrite, uint32_t length)
+{
+	uint8_t val8;
+
+	simCycleCalls++;
+	while (length--)
+	{
+		val8 = *DataToWrite++;
+		SIM_SpiByte(&val8);
+	}
+}
+
+void MCU_SPIRead(uint8_t *DataRead, uint32_t length)
+{
+	SIM_SpiRead(DataRead, length);
+}
+
+void MCU_SPIWrite(const uint8_t *DataToWrite, uint32_t length)
+{
+	SIM_SpiWrite(DataToWrite, length);
+}
+
+void MCU_SPIWriteBurst(const uint8_t *DataToWrite, uint32_t length)
+{
+	SIM_SpiWrite(DataToWrite, length);
+}
+
+// Program memory is directly addressable on the host.
+void MCU_SPIWriteFlash(uintptr_t DataToWrite, uint32_t length)
+{
+	SIM_SpiWrite((const uint8_t *)DataToWrite, length);
+}
+
+uint8_t MCU_SPIRead8(void)
+{
+	uint8_t DataRead = 0;
+
+	SIM_SpiRead(&DataRead, 1);
+
+	return DataRead;
+}
+
+void MCU_SPIWrite8(uint8_t DataToWrite)
+{
+	SIM_SpiWrite(&DataToWrite, 1);
+}
+
+uint16_t MCU_SPIRead16(void)
+{
+	uint16_t DataRead = 0;
+
+	SIM_SpiRead((uint8_t *)&DataRead, 2);
+
+	return DataRead;
+}
+
+void MCU_SPIWrite16(uint16_t DataToWrite)
+{
+	SIM_SpiWrite((uint8_t *)&DataToWrite, 2);
+}
+
+uint32_t MCU_SPIRead24(void)
+{
+	uint32_t DataRead = 0;
+
+	SIM_SpiRead((uint8_t *)&DataRead, 3);
+
+	return DataRead;
+}
+
+void MCU_SPIWrite24(uint32_t DataToWrite)
+{
+	SIM_SpiWrite((uint8_t *)&DataToWrite, 3);
+}
+
+uint32_t MCU_SPIRead32(void)
+{
+	uint32_t DataRead = 0;
+
+	SIM_SpiRead((uint8_t *)&DataRead, 4);
+
+	return DataRead;
+}
+
+void MCU_SPIWrite32(uint32_t DataToWrite)
+{
+	SIM_SpiWrite((uint8_t *)&DataToWrite, 4);
+}
+
+void MCU_IntSetup(void (*handler)(void))
+{
+	MCU_IntHandler = handler;
+}
+
+void MCU_Delay_20ms(void)
+{
+	simTime += 20000000ULL;
+	SIM_TouchUpdate();
+}
+
+void MCU_Delay_500ms(void)
+{
+	simTime += 500000000ULL;
+	SIM_TouchUpdate();
+}
+
+// Host is assumed to be Little Endian.
+uint16_t MCU_htobe16(uint16_t h)
+{
+	return __builtin_bswap16(h);
+}
+
+uint32_t MCU_htobe32(uint32_t h)
+{
+	return __builtin_bswap32(h);
+}
+
+uint16_t MCU_htole16(uint16_t h)
+{
+	return h;
+}
+
+uint32_t MCU_htole32(uint32_t h)
+{
+	return h;
+}
+
+uint16_t MCU_be16toh(uint16_t h)
+{
+	return __builtin_bswap16(h);
+}
+
+uint32_t MCU_be32toh(uint32_t h)
+{
+	return __builtin_bswap32(h);
+}
+
+uint16_t MCU_le16toh(uint16_t h)
+{
+	return h;
+}
+
+uint32_t MCU_le32toh(uint32_t h)
+{
+	return h;
+}
+
+#endif /* __FT32__ */
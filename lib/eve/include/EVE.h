@@ -51,6 +51,22 @@
 #include "EVE_config.h"
 #include "FT8xx.h"
 
+/**
+ @brief Snapshot of the touch registers.
+ @details The members from raw_xy to tag are in the same order as the
+ 	 registers in EVE memory, from REG_TOUCH_RAW_XY to REG_TOUCH_TAG, so
+ 	 they are read in one transaction.
+ */
+typedef struct
+{
+	uint32_t raw_xy;	// REG_TOUCH_RAW_XY, 0x80008000 when not touched
+	uint32_t rz;		// REG_TOUCH_RZ
+	uint32_t screen_xy;	// REG_TOUCH_SCREEN_XY
+	uint32_t tag_xy;	// REG_TOUCH_TAG_XY
+	uint32_t tag;		// REG_TOUCH_TAG
+	uint32_t tracker;	// REG_TRACKER, only read when requested
+} EVE_TOUCH_SNAPSHOT;
+
 /**
  @brief Initialise EVE API.
  @details Initialise the EVE API layer, HAL layer and MCU-specific hardware
@@ -60,16 +76,28 @@ void EVE_Init(void);
 
 /**
  @brief EVE API: Begin coprocessor list
- @details Starts a coprocessor list. Waits for the coprocessor to be idle
- 	 before asserting chip select.
+ @details Starts a coprocessor list. Does not wait for the previous list
+ 	 to complete; commands are added after it in the command memory.
  */
 void EVE_LIB_BeginCoProList(void);
 
 /**
  @brief EVE API: End coprocessor list
- @details Ends a coprocessor list. Deasserts chip select.
+ @details Ends a coprocessor list and starts the coprocessor working on it.
+ 	 Does not wait for the list to complete.
+ @returns Fence for the end of this list. Pass to EVE_LIB_AwaitFence or
+ 	 EVE_LIB_CheckFence when the results of the list are needed.
+ */
+uint32_t EVE_LIB_EndCoProList(void);
+
+/**
+ @brief EVE API: Send coprocessor list so far
+ @details Starts the coprocessor working on the commands added to the
+ 	 current list without ending it. Further commands may be added and
+ 	 the list must still be ended with EVE_LIB_EndCoProList.
+ @returns Fence for the commands sent so far.
  */
-void EVE_LIB_EndCoProList(void);
+uint32_t EVE_LIB_FlushCoProList(void);
 
 /**
  @brief EVE API: Waits for coprocessor list to end
@@ -77,6 +105,36 @@ void EVE_LIB_EndCoProList(void);
  */
 void EVE_LIB_AwaitCoProEmpty(void);
 
+/**
+ @brief EVE API: Check if a coprocessor list has completed
+ @details Does not wait.
+ @param fence - Value returned from EVE_LIB_EndCoProList.
+ @returns Non-zero if the list has completed or the coprocessor has
+ 	 faulted, zero if it is still executing.
+ */
+uint8_t EVE_LIB_CheckFence(uint32_t fence);
+
+/**
+ @brief EVE API: Waits for a coprocessor list to complete
+ @details Will poll the coprocessor until the list that returned the fence
+ 	 has been completed. Later lists may still be executing.
+ @param fence - Value returned from EVE_LIB_EndCoProList.
+ */
+void EVE_LIB_AwaitFence(uint32_t fence);
+
+/**
+ @brief EVE API: Waits a limited time for a coprocessor list to complete
+ @details Polls the coprocessor as EVE_LIB_AwaitFence but gives up once
+ 	 REG_FRAMES shows that a number of display frames have passed. A
+ 	 coprocessor left waiting for more media FIFO data does not hold up
+ 	 the caller for ever.
+ @param fence - Value returned from EVE_LIB_EndCoProList.
+ @param frames - Longest wait counted in display frames.
+ @returns 1 if the list has completed, 0 if it is still executing or
+ 	 0xFF if the coprocessor has faulted.
+ */
+uint8_t EVE_LIB_AwaitFenceFrames(uint32_t fence, uint32_t frames);
+
 /**
  @brief EVE API: Write a buffer to memory mapped RAM
  @details Writes a block of data via SPI to the EVE.
@@ -130,6 +188,55 @@ uint16_t EVE_LIB_SendString(const char* string);
  */
 void EVE_LIB_GetProps(uint32_t *addr, uint32_t *width, uint32_t *height);
 
+/**
+ @brief EVE API: Start a media FIFO
+ @details Sends CMD_MEDIAFIFO to make a ring buffer in RAM_G and waits for
+ 	 the coprocessor to set it up. Data written to the FIFO is read by a
+ 	 later command with OPT_MEDIAFIFO. Data may be written before that
+ 	 command is sent as long as it fits in the FIFO.
+ 	 This sends its own coprocessor list.
+ @param address - Start of the FIFO in RAM_G, 4 byte aligned.
+ @param size - Size of the FIFO in bytes, a multiple of 4.
+ */
+void EVE_LIB_MediaFifoStart(uint32_t address, uint32_t size);
+
+/**
+ @brief EVE API: Free space in the media FIFO
+ @details Reads REG_MEDIAFIFO_READ. There will always be 4 bytes reserved
+ 	 so that a full FIFO is not mistaken for an empty one.
+ @returns Number of bytes that can be written.
+ */
+uint32_t EVE_LIB_MediaFifoSpace(void);
+
+/**
+ @brief EVE API: Write data to the media FIFO
+ @details Writes as much of the data as there is space for and does not
+ 	 wait. The write is split where the FIFO wraps. REG_MEDIAFIFO_WRITE is
+ 	 kept on a 4 byte boundary so a partial word at the end is passed to
+ 	 the coprocessor by the next write or by EVE_LIB_MediaFifoFlush.
+ @param data - Pointer to the data.
+ @param length - Number of bytes, any length.
+ @returns Number of bytes written.
+ */
+uint32_t EVE_LIB_MediaFifoWrite(const uint8_t *data, uint32_t length);
+
+/**
+ @brief EVE API: Pass the end of the data to the coprocessor
+ @details Pads the data written to the media FIFO to a multiple of 4 bytes
+ 	 and updates REG_MEDIAFIFO_WRITE. Call after the last write.
+ */
+void EVE_LIB_MediaFifoFlush(void);
+
+/**
+ @brief EVE API: Read the touch state
+ @details Reads the tag, raw, screen and tag coordinates from the touch
+ 	 registers in a single SPI transaction. REG_TRACKER is not next to
+ 	 the other touch registers and needs a second transaction.
+ @param touch - Pointer to structure to receive the touch state.
+ @param tracker - Non-zero to also read REG_TRACKER.
+ */
+void EVE_LIB_GetTouch(EVE_TOUCH_SNAPSHOT *touch, uint8_t tracker);
+
 // Graphics instructions
 void EVE_CLEAR_COLOR_RGB(uint8_t R, uint8_t G, uint8_t B);
 void EVE_CLEAR_COLOR(uint32_t c);
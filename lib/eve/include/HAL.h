@@ -48,6 +48,39 @@
 
 #include "FT8xx.h" // Register and command definitions for FT8xx
 
+/**
+ @brief Size of the co-processor command staging buffer.
+ @details Commands are collected in MCU RAM until the end of a co-processor
+ 	 list and then sent to EVE in one SPI burst. Must be a multiple of 4.
+ */
+#ifndef EVE_CMD_BUFFER_SIZE
+#define EVE_CMD_BUFFER_SIZE 1024
+#endif
+
+/**
+ @brief SPI transaction trace.
+ @details Define EVE_SPI_TRACE to record each chip select cycle in a trace
+ 	 buffer of EVE_SPI_TRACE_SIZE bytes. Define EVE_SPI_TRACE_DATA to
+ 	 also record the bytes transferred. Each record is three 32-bit
+ 	 words followed by the data, padded to a multiple of 4 bytes:
+ 	 - bits 0 to 23 address (host command and parameter for
+ 	   HAL_TRACE_HOST) and bits 24 to 31 type,
+ 	 - number of bytes transferred after the address,
+ 	 - number of data bytes recorded.
+ 	 Records are dropped when the buffer is full.
+ */
+//@{
+#ifdef EVE_SPI_TRACE
+#ifndef EVE_SPI_TRACE_SIZE
+#define EVE_SPI_TRACE_SIZE 8192
+#endif
+#define HAL_TRACE_READ 0 // Memory read
+#define HAL_TRACE_WRITE 1 // Memory write
+#define HAL_TRACE_HOST 2 // Host command
+#define HAL_TRACE_STREAM 3 // Data streamed to RAM_CMD for the previous command
+#endif // EVE_SPI_TRACE
+//@}
+
 /**
  @brief Initialise EVE HAL Layer.
  @details Power cycle and start the EVE display in a controlled manner.
@@ -104,7 +137,8 @@ uint16_t HAL_GetCmdPointer(void);
  @brief Commits the current command memory write pointer
  @details Stores the internal HAL command memory write pointer to
  	 the REG_CMD_WRITE register. This will start the coprocessor
- 	 working through items in the display list.
+ 	 working through items in the display list. Any commands in the
+ 	 staging buffer are flushed to EVE first.
  */
 void HAL_WriteCmdPointer(void);
 
@@ -128,6 +162,89 @@ uint8_t HAL_WaitCmdFifoEmpty(void);
  */
 uint16_t HAL_CheckCmdFreeSpace();
 
+/**
+ @brief Get a fence for the commands committed so far
+ @details A fence is a count of bytes committed to the coprocessor through
+ 	 the REG_CMD_WRITE register. It is passed once the coprocessor has
+ 	 read all of those bytes.
+ @returns Fence value for use with HAL_CheckCmdFence or HAL_WaitCmdFence.
+ */
+uint32_t HAL_GetCmdFence(void);
+
+/**
+ @brief Check if the coprocessor has passed a fence
+ @details Reads the REG_CMD_READ register once and does not wait.
+ @param fence - Value from HAL_GetCmdFence.
+ @returns 1 if the fence has been passed, 0 if not yet or 0xff for an
+ 	 error condition.
+ */
+uint8_t HAL_CheckCmdFence(uint32_t fence);
+
+/**
+ @brief Wait for the coprocessor to pass a fence
+ @details Polls the REG_CMD_READ register until all commands committed
+ 	 before the fence was taken have been completed. Commands committed
+ 	 after the fence do not need to be completed.
+ @param fence - Value from HAL_GetCmdFence.
+ @returns Zero for normal completion or 0xff for an error condition.
+ */
+uint8_t HAL_WaitCmdFence(uint32_t fence);
+
+/**
+ @brief Reset the coprocessor
+ @details Recovers from a coprocessor fault or abandons a command that
+ 	 is waiting for data which will not arrive. The coprocessor is held in
+ 	 reset while the command memory pointers are cleared. Staged commands
+ 	 are discarded and all outstanding fences are passed.
+ 	 Coprocessor state such as fonts set with CMD_SETFONT and the media
+ 	 FIFO is lost.
+ */
+void HAL_ResetCmdFifo(void);
+
+/**
+ @brief Add a 32 bit value to the command staging buffer
+ @details Co-processor commands are collected in a buffer in MCU RAM
+ 	 rather than being sent to EVE immediately. The command memory write
+ 	 pointer must still be advanced with HAL_IncCmdPointer. If the buffer
+ 	 is full then it is flushed to EVE first.
+ @param val32 - 32 bit value
+ */
+void HAL_CmdBufferWrite32(uint32_t val32);
+
+/**
+ @brief Send the command staging buffer to EVE
+ @details Writes the contents of the staging buffer to the command memory
+ 	 in as few SPI bursts as possible. The transfer is split where the
+ 	 command memory wraps and will wait for free space if the
+ 	 coprocessor has not yet consumed enough of the FIFO. REG_CMD_WRITE
+ 	 is updated once after the last burst, or earlier if the coprocessor
+ 	 must be given the data written so far to free more space.
+ 	 This function will control chip select.
+ */
+void HAL_CmdBufferFlush(void);
+
+/**
+ @brief Stream a block of data to the command memory
+ @details Flushes the staging buffer and then writes the data after it in
+ 	 the command memory. Data larger than the free space is sent in
+ 	 segments as the coprocessor frees space, split where the command
+ 	 memory wraps. REG_CMD_WRITE is updated when the free space runs out
+ 	 and after the last segment. The command memory write pointer is
+ 	 advanced past the data.
+ 	 This function will control chip select.
+ @param buffer - data to send, padded to a multiple of 4 bytes
+ @param length - number of bytes to send, a multiple of 4
+ */
+void HAL_CmdStreamWrite(const uint8_t *buffer, uint32_t length);
+
+/**
+ @brief Stream a block of data from program memory to the command memory
+ @details As HAL_CmdStreamWrite but the data is sent with MCU_SPIWriteFlash.
+ @param flash - address of the data in program memory, 4 byte aligned
+ @param length - number of bytes to send, a multiple of 4
+ */
+void HAL_CmdStreamWriteFlash(uintptr_t flash, uint32_t length);
+
 /**
  @brief Write a 32 bit value to an EVE memory location
  @details Formats a memory space write to EVE. This can be any register
@@ -188,6 +305,64 @@ uint16_t HAL_MemRead16(uint32_t address);
  */
 uint8_t HAL_MemRead8(uint32_t address);
 
+/**
+ @brief Enable EVE interrupts
+ @details Clears any pending interrupt flags, sets REG_INT_MASK to the
+   	   interrupt sources required and enables the INT_N line. The handler
+   	   is called from interrupt context when INT_N is asserted.
+ @param mask - interrupt sources e.g. INT_TOUCH | INT_TAG
+ @param handler - function to call when EVE asserts INT_N
+ */
+void HAL_IntSetup(uint8_t mask, void (*handler)(void));
+
+/**
+ @brief Read and clear EVE interrupt flags
+ @details Reading REG_INT_FLAGS clears the flags and releases INT_N so
+   	   that the next interrupt can be signalled.
+ @returns interrupt flags set since the last read
+ */
+uint8_t HAL_IntFlags(void);
+
+/**
+ @brief Read a block of data from EVE memory
+ @details Formats a memory space read to EVE and reads consecutive bytes
+   	   in a single transaction. Use this where several registers are
+   	   next to each other rather than reading each one separately.
+   	   This function will control chip select.
+ @param address - 24 bit address on EVE
+ @param buffer - buffer to receive the data
+ @param length - number of bytes to read
+ */
+void HAL_MemReadBlock(uint32_t address, uint8_t *buffer, uint32_t length);
+
+/**
+ @brief Write a block of data from program memory to EVE memory
+ @details Formats a memory space write to EVE and sends the data from
+   	   program memory with MCU_SPIWriteFlash in a single transaction.
+   	   This function will control chip select.
+ @param address - 24 bit address on EVE
+ @param flash - address of the data in program memory, 4 byte aligned
+ @param length - number of bytes to write
+ */
+void HAL_MemWriteFlash(uint32_t address, uintptr_t flash, uint32_t length);
+
+#ifdef EVE_SPI_TRACE
+/**
+ @brief Get SPI transaction trace
+ @details Returns the records collected since the last call to
+   	   HAL_TraceReset.
+ @param buffer - receives a pointer to the trace records
+ @param lost - receives the number of records dropped
+ @returns length of the trace records in bytes
+ */
+uint32_t HAL_TraceGet(const uint8_t **buffer, uint32_t *lost);
+
+/**
+ @brief Empty SPI transaction trace buffer
+ */
+void HAL_TraceReset(void);
+#endif // EVE_SPI_TRACE
+
 /**
  @brief Sends an address for writing to EVE
  @details Formats a memory address for writing to the EVE.
@@ -214,9 +389,11 @@ void HAL_CmdWrite(uint8_t cmd, uint8_t param);
 
 /**
  @brief Sends a block of data to EVE
- @details Sends a block of data using SPI to the EVE.
+ @details Sends a block of data using SPI to the EVE as a single burst.
+   	   The transfer is complete when the function returns.
    	   This function will not control chip select.
- @param val32 - 32 bit value
+ @param buffer - data to send
+ @param length - number of bytes to send
  */
 void HAL_Write(const uint8_t *buffer, uint32_t length);
 
@@ -262,6 +439,15 @@ uint32_t HAL_Read32(void);
  */
 uint16_t HAL_Read16(void);
 
+/**
+ @brief Reads a block of data from EVE
+ @details Reads multiple bytes after an address has been sent.
+   	   This function will not control chip select.
+ @param buffer - buffer to receive the data
+ @param length - number of bytes to read
+ */
+void HAL_Read(uint8_t *buffer, uint32_t length);
+
 /**
  @brief Reads a 8 bit value from EVE
  @details Sends a 8 bit dummy value using SPI to the EVE
@@ -105,6 +105,37 @@ void MCU_PDhigh(void);
  */
 void MCU_SPIWrite(const uint8_t *DataToWrite, uint32_t length);
 
+/**
+ @brief MCU specific SPI burst write
+ @details Performs an SPI write of the data block using any hardware
+ 	 buffering available on the MCU to send the data without gaps. The
+ 	 function must not return until all data has been clocked out so that
+ 	 chip select can be safely deasserted afterwards.
+ @param DataToWrite - pointer to buffer to write.
+ @param length - number of bytes to write.
+ */
+void MCU_SPIWriteBurst(const uint8_t *DataToWrite, uint32_t length);
+
+/**
+ @brief MCU specific SPI burst write from program memory
+ @details As MCU_SPIWriteBurst for data held in program memory on MCUs
+ 	 where this is a separate address space. Reading the data should be
+ 	 overlapped with sending it where the hardware allows.
+ @param DataToWrite - address of the data in program memory, 4 byte
+ 	 aligned.
+ @param length - number of bytes to write.
+ */
+void MCU_SPIWriteFlash(uintptr_t DataToWrite, uint32_t length);
+
+/**
+ @brief MCU specific SPI block read
+ @details Performs SPI dummy writes and stores the data received in
+    	 response.
+ @param DataRead - Buffer to receive data from EVE.
+ @param length - Number of bytes to read.
+ */
+void MCU_SPIRead(uint8_t *DataRead, uint32_t length);
+
 /**
  @brief MCU specific SPI 8 bit read
  @details Performs an SPI dummy write and returns the data received in
@@ -169,6 +200,15 @@ uint32_t MCU_SPIRead32(void);
  */
 void MCU_SPIWrite32(uint32_t DataToWrite);
 
+/**
+ @brief MCU specific interrupt setup
+ @details Configures the GPIO connected to the EVE INT_N line to raise an
+ 	 interrupt on a falling edge. The handler is called in interrupt
+ 	 context and must not access the SPI bus.
+ @param handler - function to call when EVE asserts INT_N
+ */
+void MCU_IntSetup(void (*handler)(void));
+
 /**
  @brief MCU specific 20 ms delay
  @details Cause the MCU to idle or otherwise delay for a minimum of
@@ -45,12 +45,19 @@
 
 #include "../include/EVE.h"
 #include "../include/HAL.h"
+#include "../include/MCU.h"
 
 
 
 // Set beginning of graphics command memory
 //static uint32_t RAMCommandBuffer = RAM_CMD;
 
+// Media FIFO in RAM_G. The write offset includes any partial word not yet
+// passed to the co-processor in REG_MEDIAFIFO_WRITE.
+static uint32_t mediaFifoAddress = 0;
+static uint32_t mediaFifoSize = 0;
+static uint32_t mediaFifoWrite = 0;
+
 
 //##############################################################################
 // Library functions
@@ -130,22 +137,29 @@ void EVE_Init(void)
 // Begins co-pro list for display creation
 void EVE_LIB_BeginCoProList(void)
 {
-    // Wait for command FIFO to be empty and record current position in FIFO
-    EVE_LIB_AwaitCoProEmpty();
-       
-    // Begins SPI transaction
-    HAL_ChipSelect(1);
-    // Send address for writing as the next free location in the co-pro buffer
-    HAL_SetWriteAddress(RAM_CMD + HAL_GetCmdPointer());
+    // The previous list may still be executing. Commands are now collected
+    // in the HAL staging buffer and sent to the next free location in the
+    // co-pro buffer when the list ends.
 }
 
 // Ends co-pro list for display creation
-void EVE_LIB_EndCoProList(void)
+uint32_t EVE_LIB_EndCoProList(void)
 {
-    // End SPI transaction
-    HAL_ChipSelect(0);
-    // Update the ring buffer pointer to start decode
+    // Send the staged commands in one SPI burst and update the ring buffer
+    // pointer to start decode
     HAL_WriteCmdPointer();
+
+    // Return a fence for the end of this list
+    return HAL_GetCmdFence();
+}
+
+// Sends the commands so far without ending the co-pro list
+uint32_t EVE_LIB_FlushCoProList(void)
+{
+    HAL_WriteCmdPointer();
+
+    // Return a fence for the commands sent so far
+    return HAL_GetCmdFence();
 }
 
 // Waits for the read and write pointers to become equal
@@ -155,6 +169,32 @@ void EVE_LIB_AwaitCoProEmpty(void)
 	HAL_WaitCmdFifoEmpty();
 }
 
+// Checks if a co-pro list has completed
+uint8_t EVE_LIB_CheckFence(uint32_t fence)
+{
+	return (HAL_CheckCmdFence(fence) != 0);
+}
+
+// Waits for a co-pro list to complete
+void EVE_LIB_AwaitFence(uint32_t fence)
+{
+	HAL_WaitCmdFence(fence);
+}
+
+// Waits for a co-pro list to complete for a number of display frames
+uint8_t EVE_LIB_AwaitFenceFrames(uint32_t fence, uint32_t frames)
+{
+	uint32_t frame = HAL_MemRead32(REG_FRAMES);
+	uint8_t status;
+
+	do
+	{
+		status = HAL_CheckCmdFence(fence);
+	} while ((status == 0) && (HAL_MemRead32(REG_FRAMES) - frame < frames));
+
+	return status;
+}
+
 // Writes a block of data to the RAM_G
 void EVE_LIB_WriteDataToRAMG(const uint8_t *ImgData, uint32_t DataSize, uint32_t DestAddress)
 {
@@ -166,13 +206,8 @@ void EVE_LIB_WriteDataToRAMG(const uint8_t *ImgData, uint32_t DataSize, uint32_t
     // Pad data length to multiple of 4.
     DataSize = (DataSize + 3) & (~3);
 
-    // Send data as 32 bits.
-    while (DataSize)
-    {
-        HAL_Write32(*(uint32_t *)ImgData);
-        ImgData += 4;
-        DataSize -= 4;
-    }
+    // Send data in a single burst.
+    HAL_Write(ImgData, DataSize);
 
     // End SPI transaction
     HAL_ChipSelect(0);
@@ -189,13 +224,8 @@ void EVE_LIB_ReadDataFromRAMG(uint8_t *ImgData, uint32_t DataSize, uint32_t SrcA
     // Pad data length to multiple of 4.
     DataSize = (DataSize + 3) & (~3);
 
-    // Send data as 32 bits.
-    while (DataSize)
-    {
-    	*(uint32_t *)ImgData = HAL_Read32();
-        ImgData += 4;
-        DataSize -= 4;
-    }
+    // Read data in one burst.
+    HAL_Read(ImgData, DataSize);
 
     // End SPI transaction
     HAL_ChipSelect(0);
@@ -204,71 +234,15 @@ void EVE_LIB_ReadDataFromRAMG(uint8_t *ImgData, uint32_t DataSize, uint32_t SrcA
 // Write a block of data to the coprocessor
 void EVE_LIB_WriteDataToCMD(const uint8_t *ImgData, uint32_t DataSize)
 {
-    uint32_t CurrentIndex = 0;
-    uint32_t ChunkSize = 0;
-    const uint32_t MaxChunkSize = 128;
-    uint8_t IsLastChunk = 0;
-    uint16_t Freespace = 0;
-                                                    
-    // This code works by sending the data in a series of one or more bursts.
-    // If the data is more than MaxChunkSize bytes, it is sent as a series of
-	// one or more bursts and then the remainder. MaxChunkSize is a size which
-    // is smaller than the command buffer on the EVE and small enough to gain
-    // maximum buffering effect from the MCU SPI hardware.
-
     // Pad data length to multiple of 4.
     DataSize = (DataSize + 3) & (~3);
 
-    // While not all data is sent
-    while (CurrentIndex < DataSize)
-    {
-        // If more than ChunkSize bytes to send
-        if ((DataSize - CurrentIndex) > MaxChunkSize)
-        {
-            // ... then add ChunkSize to the current target index to make new target
-        	ChunkSize = MaxChunkSize;
-            // ... and this is not the last chunk
-            IsLastChunk = 0;
-        }
-        // or if all remaining bytes can fit in one chunk
-        else
-        {
-            // ... then add the amount of data to the current target
-        	ChunkSize = DataSize - CurrentIndex;
-            // .. and this is the last chunk
-            IsLastChunk = 1;
-        }
-        
-        // Wait until there is space
-        Freespace = 0;
-        while (Freespace < MaxChunkSize)
-        {
-            Freespace = HAL_CheckCmdFreeSpace();
-        }
-
-        // Begin an SPI burst write
-        HAL_ChipSelect(1);
-
-        // to the next location in the FIFO
-        HAL_SetWriteAddress(RAM_CMD + HAL_GetCmdPointer());
-        
-        HAL_Write(ImgData, ChunkSize);
-        ImgData += ChunkSize;
-        CurrentIndex += ChunkSize;
-
-        // End the SPI burst
-        HAL_ChipSelect(0);
-       
-        // Calculate where end of data lies
-        HAL_IncCmdPointer(ChunkSize);
-        HAL_WriteCmdPointer();
-
-        // If this is the last chunk of the data,
-        if (IsLastChunk)
-        {
-        	break;
-        }
-    }
+    // Send the data to the next location in the FIFO after any staged
+    // commands. The HAL sends as much as the free space in the FIFO allows
+    // in each burst and splits bursts where the FIFO wraps. REG_CMD_READ is
+    // only read, and REG_CMD_WRITE only updated, when the free space known
+    // to the HAL runs out.
+    HAL_CmdStreamWrite(ImgData, DataSize);
 }
 
 // Writes a string over SPI
@@ -286,7 +260,7 @@ uint16_t EVE_LIB_SendString(const char* string)
     // Send string as 32 bit data.
     while (length)
     {
-        HAL_Write32(*(uint32_t *)string);
+        HAL_CmdBufferWrite32(*(uint32_t *)string);
         string += 4;
         length -= 4;
     }
@@ -297,6 +271,7 @@ uint16_t EVE_LIB_SendString(const char* string)
 void EVE_LIB_GetProps(uint32_t *addr, uint32_t *width, uint32_t *height)
 {
 	uint32_t WritePointer;
+	uint32_t fence;
 
 	WritePointer = HAL_GetCmdPointer();
 	EVE_LIB_BeginCoProList();
@@ -310,8 +285,8 @@ void EVE_LIB_GetProps(uint32_t *addr, uint32_t *width, uint32_t *height)
 	EVE_DISPLAY();
 	EVE_CMD_SWAP();
 	// Wait for it to finish.
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
+	fence = EVE_LIB_EndCoProList();
+	EVE_LIB_AwaitFence(fence);
 
 	// Obtain the results from the RAM_CMD in the CoProcessor.
 	*addr = HAL_MemRead32(RAM_CMD + ((WritePointer + (2 * sizeof(uint32_t))) & (FT_CMD_FIFO_SIZE - 1)));
@@ -319,229 +294,345 @@ void EVE_LIB_GetProps(uint32_t *addr, uint32_t *width, uint32_t *height)
 	*height = HAL_MemRead32(RAM_CMD + ((WritePointer + (4 * sizeof(uint32_t))) & (FT_CMD_FIFO_SIZE - 1)));
 }
 
+void EVE_LIB_GetTouch(EVE_TOUCH_SNAPSHOT *touch, uint8_t tracker)
+{
+    // REG_TOUCH_RAW_XY to REG_TOUCH_TAG inclusive.
+    HAL_MemReadBlock(REG_TOUCH_RAW_XY, (uint8_t *)touch,
+            REG_TOUCH_TAG + sizeof(uint32_t) - REG_TOUCH_RAW_XY);
+
+    touch->raw_xy = MCU_le32toh(touch->raw_xy);
+    touch->rz = MCU_le32toh(touch->rz);
+    touch->screen_xy = MCU_le32toh(touch->screen_xy);
+    touch->tag_xy = MCU_le32toh(touch->tag_xy);
+    touch->tag = MCU_le32toh(touch->tag);
+
+    touch->tracker = 0;
+    if (tracker)
+    {
+        touch->tracker = HAL_MemRead32(REG_TRACKER);
+    }
+}
+
+// Sets up a media FIFO and waits for the co-processor to accept it
+void EVE_LIB_MediaFifoStart(uint32_t address, uint32_t size)
+{
+    EVE_LIB_BeginCoProList();
+    EVE_CMD_MEDIAFIFO(address, size);
+    EVE_LIB_AwaitFence(EVE_LIB_EndCoProList());
+
+    mediaFifoAddress = address;
+    mediaFifoSize = size;
+    mediaFifoWrite = 0;
+
+    // Start writing at the beginning of the FIFO
+    HAL_MemWrite32(REG_MEDIAFIFO_WRITE, 0);
+}
+
+// Returns the space available in the media FIFO
+uint32_t EVE_LIB_MediaFifoSpace(void)
+{
+    uint32_t readPointer;
+    uint32_t fullness;
+
+    if (mediaFifoSize == 0)
+    {
+        return 0;
+    }
+
+    readPointer = HAL_MemRead32(REG_MEDIAFIFO_READ);
+    fullness = (mediaFifoWrite + mediaFifoSize - readPointer) % mediaFifoSize;
+
+    // -4 stops a full FIFO appearing empty
+    return mediaFifoSize - 4 - fullness;
+}
+
+// Writes as much data to the media FIFO as will fit
+uint32_t EVE_LIB_MediaFifoWrite(const uint8_t *data, uint32_t length)
+{
+    uint32_t written = 0;
+    uint32_t space;
+    uint32_t n;
+
+    space = EVE_LIB_MediaFifoSpace();
+    if (length > space)
+    {
+        length = space;
+    }
+
+    while (written < length)
+    {
+        // Split the write where the FIFO wraps
+        n = mediaFifoSize - mediaFifoWrite;
+        if (n > length - written)
+        {
+            n = length - written;
+        }
+
+        // RAM_G is written with byte granularity so no padding is sent
+        HAL_ChipSelect(1);
+        HAL_SetWriteAddress(mediaFifoAddress + mediaFifoWrite);
+        HAL_Write(data + written, n);
+        HAL_ChipSelect(0);
+
+        written += n;
+        mediaFifoWrite += n;
+        if (mediaFifoWrite == mediaFifoSize)
+        {
+            mediaFifoWrite = 0;
+        }
+    }
+
+    if (written)
+    {
+        // Pass whole words to the co-processor
+        HAL_MemWrite32(REG_MEDIAFIFO_WRITE, mediaFifoWrite & (~3));
+    }
+
+    return written;
+}
+
+// Pads the data in the media FIFO to a whole word and passes it on
+void EVE_LIB_MediaFifoFlush(void)
+{
+    if (mediaFifoSize == 0)
+    {
+        return;
+    }
+
+    // The padding bytes are after the end of the data and are not used.
+    // There is always room as 4 bytes of the FIFO are kept free.
+    mediaFifoWrite = (mediaFifoWrite + 3) & (~3);
+    if (mediaFifoWrite == mediaFifoSize)
+    {
+        mediaFifoWrite = 0;
+    }
+
+    HAL_MemWrite32(REG_MEDIAFIFO_WRITE, mediaFifoWrite);
+}
+
 //##############################################################################
 // Display List commands for co-processor
 //##############################################################################
 
 void EVE_CLEAR_COLOR_RGB(uint8_t R, uint8_t G, uint8_t B)
 {
-    HAL_Write32(CLEAR_COLOR_RGB(R, G, B));
+    HAL_CmdBufferWrite32(CLEAR_COLOR_RGB(R, G, B));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CLEAR_COLOR(uint32_t c)
 {
-    HAL_Write32(CLEAR_COLOR(c));
+    HAL_CmdBufferWrite32(CLEAR_COLOR(c));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CLEAR(uint8_t C, uint8_t S, uint8_t T)
 {
-    HAL_Write32(CLEAR((C & 0x01),(S & 0x01),(T & 0x01)));
+    HAL_CmdBufferWrite32(CLEAR((C & 0x01),(S & 0x01),(T & 0x01)));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_COLOR_RGB(uint8_t R, uint8_t G, uint8_t B)
 {
-    HAL_Write32(COLOR_RGB(R, G, B));
+    HAL_CmdBufferWrite32(COLOR_RGB(R, G, B));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_COLOR(uint32_t c)
 {
-    HAL_Write32(COLOR(c));
+    HAL_CmdBufferWrite32(COLOR(c));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_VERTEX2F(int16_t x, int16_t y)
 {
-    HAL_Write32(VERTEX2F(x, y));
+    HAL_CmdBufferWrite32(VERTEX2F(x, y));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_VERTEX2II(uint16_t x, uint16_t y, uint8_t handle, uint8_t cell)
 {
-    HAL_Write32(VERTEX2II(x, y, handle, cell));
+    HAL_CmdBufferWrite32(VERTEX2II(x, y, handle, cell));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_HANDLE(uint8_t handle)
 {
-    HAL_Write32(BITMAP_HANDLE(handle));
+    HAL_CmdBufferWrite32(BITMAP_HANDLE(handle));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_SOURCE(uint32_t addr)
 {
-    HAL_Write32(BITMAP_SOURCE(addr));
+    HAL_CmdBufferWrite32(BITMAP_SOURCE(addr));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_LAYOUT(uint8_t format, uint16_t linestride, uint16_t height )
 {
-    HAL_Write32(BITMAP_LAYOUT(format, linestride, height));
+    HAL_CmdBufferWrite32(BITMAP_LAYOUT(format, linestride, height));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_SIZE(uint8_t filter, uint8_t wrapx, uint8_t wrapy, uint16_t width, uint16_t height)
 {        
-    HAL_Write32(BITMAP_SIZE(filter, wrapx, wrapy, width, height));
+    HAL_CmdBufferWrite32(BITMAP_SIZE(filter, wrapx, wrapy, width, height));
     HAL_IncCmdPointer(4);
 }   
 
 void EVE_CELL(uint8_t cell)
 {
-    HAL_Write32(CELL(cell));
+    HAL_CmdBufferWrite32(CELL(cell));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_TAG(uint8_t s)
 {
-    HAL_Write32(TAG(s));
+    HAL_CmdBufferWrite32(TAG(s));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_ALPHA_FUNC(uint8_t func, uint8_t ref)
 {        
-    HAL_Write32(ALPHA_FUNC(func, ref));
+    HAL_CmdBufferWrite32(ALPHA_FUNC(func, ref));
     HAL_IncCmdPointer(4);
 }
  
 void EVE_STENCIL_FUNC(uint8_t func, uint8_t ref, uint8_t mask)
 {
-    HAL_Write32(STENCIL_FUNC(func, ref, mask));
+    HAL_CmdBufferWrite32(STENCIL_FUNC(func, ref, mask));
     HAL_IncCmdPointer(4);
 }
                 
 void EVE_BLEND_FUNC(uint8_t src, uint8_t dst)
 {
-    HAL_Write32(BLEND_FUNC(src, dst));
+    HAL_CmdBufferWrite32(BLEND_FUNC(src, dst));
     HAL_IncCmdPointer(4);
 }
                    
 void EVE_STENCIL_OP(uint8_t sfail, uint8_t spass)
 {
-    HAL_Write32(STENCIL_OP(sfail, spass));
+    HAL_CmdBufferWrite32(STENCIL_OP(sfail, spass));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_POINT_SIZE(uint16_t size)
 {
-    HAL_Write32(POINT_SIZE(size));
+    HAL_CmdBufferWrite32(POINT_SIZE(size));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_LINE_WIDTH(uint16_t width)
 {
-    HAL_Write32(LINE_WIDTH(width));
+    HAL_CmdBufferWrite32(LINE_WIDTH(width));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CLEAR_COLOR_A(uint8_t alpha)
 {            
-    HAL_Write32(CLEAR_COLOR_A(alpha));
+    HAL_CmdBufferWrite32(CLEAR_COLOR_A(alpha));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_COLOR_A(uint8_t alpha)
 {
-    HAL_Write32(COLOR_A(alpha));
+    HAL_CmdBufferWrite32(COLOR_A(alpha));
     HAL_IncCmdPointer(4);
 }
  
 void EVE_CLEAR_STENCIL(uint8_t s)
 {
-    HAL_Write32(CLEAR_STENCIL(s));
+    HAL_CmdBufferWrite32(CLEAR_STENCIL(s));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CLEAR_TAG(uint8_t s)
 {
-    HAL_Write32(CLEAR_TAG(s));
+    HAL_CmdBufferWrite32(CLEAR_TAG(s));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_STENCIL_MASK(uint8_t mask)
 {
-    HAL_Write32(STENCIL_MASK(mask));
+    HAL_CmdBufferWrite32(STENCIL_MASK(mask));
     HAL_IncCmdPointer(4);
 }
    
 void EVE_TAG_MASK(uint8_t mask)
 {
-    HAL_Write32(TAG_MASK(mask));
+    HAL_CmdBufferWrite32(TAG_MASK(mask));
     HAL_IncCmdPointer(4);
 }
    
 void EVE_SCISSOR_XY(uint16_t x, uint16_t y)
 {   
-    HAL_Write32(SCISSOR_XY(x, y));
+    HAL_CmdBufferWrite32(SCISSOR_XY(x, y));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_SCISSOR_SIZE(uint16_t width, uint16_t height)
 {
-    HAL_Write32(SCISSOR_SIZE(width, height));
+    HAL_CmdBufferWrite32(SCISSOR_SIZE(width, height));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CALL(uint16_t dest)
 {
-    HAL_Write32(CALL(dest));
+    HAL_CmdBufferWrite32(CALL(dest));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_JUMP(uint16_t dest)
 {
-    HAL_Write32(JUMP(dest));
+    HAL_CmdBufferWrite32(JUMP(dest));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BEGIN(uint8_t prim)
 {
-    HAL_Write32(BEGIN(prim));
+    HAL_CmdBufferWrite32(BEGIN(prim));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_COLOR_MASK(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
-    HAL_Write32(COLOR_MASK(r, g, b, a));
+    HAL_CmdBufferWrite32(COLOR_MASK(r, g, b, a));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_END(void)
 {
-    HAL_Write32(END());
+    HAL_CmdBufferWrite32(END());
     HAL_IncCmdPointer(4);
 }
 
 void EVE_SAVE_CONTEXT(void)
 {
-    HAL_Write32(SAVE_CONTEXT());
+    HAL_CmdBufferWrite32(SAVE_CONTEXT());
     HAL_IncCmdPointer(4);
 }
 
 void EVE_RESTORE_CONTEXT(void)
 {
-    HAL_Write32(RESTORE_CONTEXT());
+    HAL_CmdBufferWrite32(RESTORE_CONTEXT());
     HAL_IncCmdPointer(4);
 }
 
 void EVE_RETURN(void)
 {
-    HAL_Write32(RETURN());
+    HAL_CmdBufferWrite32(RETURN());
     HAL_IncCmdPointer(4);
 }
 
 void EVE_MACRO(uint8_t m)
 {
-    HAL_Write32(MACRO(m));
+    HAL_CmdBufferWrite32(MACRO(m));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_DISPLAY(void)
 {
-    HAL_Write32(DISPLAY());
+    HAL_CmdBufferWrite32(DISPLAY());
     HAL_IncCmdPointer(4);
 }
 
@@ -554,9 +645,9 @@ void EVE_CMD_TEXT(int16_t x, int16_t y, int16_t font, uint16_t options, const ch
     uint32_t CommandSize;
     uint32_t StringLength;
     
-    HAL_Write32(CMD_TEXT);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (font & 0xffff));
+    HAL_CmdBufferWrite32(CMD_TEXT);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (font & 0xffff));
     CommandSize = 12;
     
     StringLength = EVE_LIB_SendString(string);
@@ -570,10 +661,10 @@ void EVE_CMD_BUTTON(int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, ui
     uint32_t CommandSize;
     uint32_t StringLength;
         
-    HAL_Write32(CMD_BUTTON);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (font & 0xffff));
+    HAL_CmdBufferWrite32(CMD_BUTTON);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (font & 0xffff));
     CommandSize = 16;
     
     StringLength = EVE_LIB_SendString(string);
@@ -587,10 +678,10 @@ void EVE_CMD_KEYS(int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint
     uint32_t CommandSize;
     uint32_t StringLength;
     
-    HAL_Write32(CMD_KEYS);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (font & 0xffff));
+    HAL_CmdBufferWrite32(CMD_KEYS);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (font & 0xffff));
     CommandSize = 16;
     
     StringLength = EVE_LIB_SendString(string);
@@ -601,16 +692,16 @@ void EVE_CMD_KEYS(int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint
 
 void EVE_CMD_NUMBER(int16_t x, int16_t y, int16_t font, uint16_t options, int32_t n)
 {
-    HAL_Write32(CMD_NUMBER);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (font & 0xffff));
-    HAL_Write32(n);
+    HAL_CmdBufferWrite32(CMD_NUMBER);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (font & 0xffff));
+    HAL_CmdBufferWrite32(n);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_LOADIDENTITY(void)
 {
-    HAL_Write32(CMD_LOADIDENTITY);
+    HAL_CmdBufferWrite32(CMD_LOADIDENTITY);
     HAL_IncCmdPointer(4);
 }
 
@@ -619,10 +710,10 @@ void EVE_CMD_TOGGLE(int16_t x, int16_t y, int16_t w, int16_t font, uint16_t opti
     uint32_t CommandSize;
     uint32_t StringLength;
     
-    HAL_Write32(CMD_TOGGLE);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)font << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)state << 16)|options);
+    HAL_CmdBufferWrite32(CMD_TOGGLE);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)font << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)state << 16)|options);
     CommandSize = 16;
 
     StringLength = EVE_LIB_SendString(string);
@@ -634,370 +725,370 @@ void EVE_CMD_TOGGLE(int16_t x, int16_t y, int16_t w, int16_t font, uint16_t opti
 /* Error handling for val is not done, so better to always use range of 65535 in order that needle is drawn within display region */
 void EVE_CMD_GAUGE(int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
 {     
-    HAL_Write32(CMD_GAUGE);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (r & 0xffff));
-    HAL_Write32(((uint32_t)minor << 16) | (major & 0xffff));
-    HAL_Write32(((uint32_t)range << 16) | (val & 0xffff));
+    HAL_CmdBufferWrite32(CMD_GAUGE);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (r & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)minor << 16) | (major & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)range << 16) | (val & 0xffff));
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_REGREAD(uint32_t ptr, uint32_t result)
 {       
-    HAL_Write32(CMD_REGREAD);
-    HAL_Write32(ptr);
-    HAL_Write32(0);
+    HAL_CmdBufferWrite32(CMD_REGREAD);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(0);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_GETPROPS(uint32_t ptr, uint32_t w, uint32_t h)
 {          
-    HAL_Write32(CMD_GETPROPS);
-    HAL_Write32(ptr);
-    HAL_Write32(w);
-    HAL_Write32(h);
+    HAL_CmdBufferWrite32(CMD_GETPROPS);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(w);
+    HAL_CmdBufferWrite32(h);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_MEMCPY(uint32_t dest, uint32_t src, uint32_t num)
 {         
-    HAL_Write32(CMD_MEMCPY);
-    HAL_Write32(dest);
-    HAL_Write32(src);
-    HAL_Write32(num);
+    HAL_CmdBufferWrite32(CMD_MEMCPY);
+    HAL_CmdBufferWrite32(dest);
+    HAL_CmdBufferWrite32(src);
+    HAL_CmdBufferWrite32(num);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_SPINNER(int16_t x, int16_t y, uint16_t style, uint16_t scale)
 {        
-    HAL_Write32(CMD_SPINNER);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)scale << 16) | (style & 0xffff));
+    HAL_CmdBufferWrite32(CMD_SPINNER);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)scale << 16) | (style & 0xffff));
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_BGCOLOR(uint32_t c)
 {         
-    HAL_Write32(CMD_BGCOLOR);
-    HAL_Write32(c);
+    HAL_CmdBufferWrite32(CMD_BGCOLOR);
+    HAL_CmdBufferWrite32(c);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_SWAP(void)
 {       
-    HAL_Write32(CMD_SWAP);
+    HAL_CmdBufferWrite32(CMD_SWAP);
     HAL_IncCmdPointer(4);
 }
   
 void EVE_CMD_INFLATE(uint32_t ptr)
 {
-    HAL_Write32(CMD_INFLATE);
-    HAL_Write32(ptr);
+    HAL_CmdBufferWrite32(CMD_INFLATE);
+    HAL_CmdBufferWrite32(ptr);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_TRANSLATE(int32_t tx, int32_t ty)
 {
-    HAL_Write32(CMD_TRANSLATE);
-    HAL_Write32(tx);
-    HAL_Write32(ty);
+    HAL_CmdBufferWrite32(CMD_TRANSLATE);
+    HAL_CmdBufferWrite32(tx);
+    HAL_CmdBufferWrite32(ty);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_STOP(void)
 {    
-    HAL_Write32(CMD_STOP);
+    HAL_CmdBufferWrite32(CMD_STOP);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_SLIDER(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range)
 {   
-    HAL_Write32(CMD_SLIDER);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)val << 16) | (options & 0xffff));
-    HAL_Write32(range);
+    HAL_CmdBufferWrite32(CMD_SLIDER);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)val << 16) | (options & 0xffff));
+    HAL_CmdBufferWrite32(range);
     HAL_IncCmdPointer(20);
 }
 
 void EVE_BITMAP_TRANSFORM_A(long a)
 {
-    HAL_Write32(BITMAP_TRANSFORM_A(a)); //    ((21UL << 24) | (((a)&131071UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_A(a)); //    ((21UL << 24) | (((a)&131071UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_TRANSFORM_B(long b)
 {
-    HAL_Write32(BITMAP_TRANSFORM_B(b)); //  ((22UL << 24) | (((b)&131071UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_B(b)); //  ((22UL << 24) | (((b)&131071UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_TRANSFORM_C(long c)
 {
-    HAL_Write32(BITMAP_TRANSFORM_C(c)); //  ((23UL << 24) | (((c)&16777215UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_C(c)); //  ((23UL << 24) | (((c)&16777215UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_TRANSFORM_D(long d)
 {
-    HAL_Write32(BITMAP_TRANSFORM_D(d)); //   ((24UL << 24) | (((d)&131071UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_D(d)); //   ((24UL << 24) | (((d)&131071UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_TRANSFORM_E(long e)
 {
-    HAL_Write32(BITMAP_TRANSFORM_E(e)); //   ((25UL << 24) | (((e)&131071UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_E(e)); //   ((25UL << 24) | (((e)&131071UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_TRANSFORM_F(long f)
 {
-    HAL_Write32(BITMAP_TRANSFORM_F(f)); //  ((26UL << 24) | (((f)&16777215UL)<<0))
+    HAL_CmdBufferWrite32(BITMAP_TRANSFORM_F(f)); //  ((26UL << 24) | (((f)&16777215UL)<<0))
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_INTERRUPT(uint32_t ms)
 {       
-    HAL_Write32(CMD_INTERRUPT);
-    HAL_Write32(ms);
+    HAL_CmdBufferWrite32(CMD_INTERRUPT);
+    HAL_CmdBufferWrite32(ms);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_FGCOLOR(uint32_t c)
 {         
-    HAL_Write32(CMD_FGCOLOR);
-    HAL_Write32(c);
+    HAL_CmdBufferWrite32(CMD_FGCOLOR);
+    HAL_CmdBufferWrite32(c);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_ROTATE(int32_t a)
 {            
-    HAL_Write32(CMD_ROTATE);
-    HAL_Write32(a);
+    HAL_CmdBufferWrite32(CMD_ROTATE);
+    HAL_CmdBufferWrite32(a);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_MEMWRITE(uint32_t ptr, uint32_t num)
 {      
-    HAL_Write32(CMD_MEMWRITE);
-    HAL_Write32(ptr);
-    HAL_Write32(num);
+    HAL_CmdBufferWrite32(CMD_MEMWRITE);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(num);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_SCROLLBAR(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
 {       
-    HAL_Write32(CMD_SCROLLBAR);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)val << 16) | (options & 0xffff));
-    HAL_Write32(((uint32_t)range << 16) | (size & 0xffff));
+    HAL_CmdBufferWrite32(CMD_SCROLLBAR);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)val << 16) | (options & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)range << 16) | (size & 0xffff));
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_GETMATRIX(int32_t a, int32_t b, int32_t c, int32_t d, int32_t e, int32_t f)
 {     
-    HAL_Write32(CMD_GETMATRIX);
-    HAL_Write32(a);
-    HAL_Write32(b);
-    HAL_Write32(c);
-    HAL_Write32(d);
-    HAL_Write32(e);
-    HAL_Write32(f);
+    HAL_CmdBufferWrite32(CMD_GETMATRIX);
+    HAL_CmdBufferWrite32(a);
+    HAL_CmdBufferWrite32(b);
+    HAL_CmdBufferWrite32(c);
+    HAL_CmdBufferWrite32(d);
+    HAL_CmdBufferWrite32(e);
+    HAL_CmdBufferWrite32(f);
     HAL_IncCmdPointer(28);
 }
 
 void EVE_CMD_SKETCH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint32_t ptr, uint16_t format)
 {      
-    HAL_Write32(CMD_SKETCH);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(ptr);
-    HAL_Write32(format);
+    HAL_CmdBufferWrite32(CMD_SKETCH);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(format);
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_MEMSET(uint32_t ptr, uint32_t value, uint32_t num)
 {      
-    HAL_Write32(CMD_MEMSET);
-    HAL_Write32(ptr);
-    HAL_Write32(value);
-    HAL_Write32(num);
+    HAL_CmdBufferWrite32(CMD_MEMSET);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(value);
+    HAL_CmdBufferWrite32(num);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_GRADCOLOR(uint32_t c)
 {     
-    HAL_Write32(CMD_GRADCOLOR);
-    HAL_Write32(c);
+    HAL_CmdBufferWrite32(CMD_GRADCOLOR);
+    HAL_CmdBufferWrite32(c);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_BITMAP_TRANSFORM(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2, uint16_t result)
 {       
-    HAL_Write32(CMD_BITMAP_TRANSFORM);
-    HAL_Write32(x0);
-    HAL_Write32(y0);
-    HAL_Write32(x1);
-    HAL_Write32(y1);
-    HAL_Write32(x2);
-    HAL_Write32(y2);
-    HAL_Write32(tx0);
-    HAL_Write32(ty0);
-    HAL_Write32(tx1);
-    HAL_Write32(ty1);
-    HAL_Write32(tx2);
-    HAL_Write32(ty2);
-    HAL_Write32(result);
+    HAL_CmdBufferWrite32(CMD_BITMAP_TRANSFORM);
+    HAL_CmdBufferWrite32(x0);
+    HAL_CmdBufferWrite32(y0);
+    HAL_CmdBufferWrite32(x1);
+    HAL_CmdBufferWrite32(y1);
+    HAL_CmdBufferWrite32(x2);
+    HAL_CmdBufferWrite32(y2);
+    HAL_CmdBufferWrite32(tx0);
+    HAL_CmdBufferWrite32(ty0);
+    HAL_CmdBufferWrite32(tx1);
+    HAL_CmdBufferWrite32(ty1);
+    HAL_CmdBufferWrite32(tx2);
+    HAL_CmdBufferWrite32(ty2);
+    HAL_CmdBufferWrite32(result);
     HAL_IncCmdPointer(56);
 }
 
 void EVE_CMD_CALIBRATE(uint32_t result)
 {    
-    HAL_Write32(CMD_CALIBRATE);
-    HAL_Write32(result);
+    HAL_CmdBufferWrite32(CMD_CALIBRATE);
+    HAL_CmdBufferWrite32(result);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_SETFONT(uint32_t font, uint32_t ptr)
 {     
-    HAL_Write32(CMD_SETFONT);
-    HAL_Write32(font);
-    HAL_Write32(ptr);
+    HAL_CmdBufferWrite32(CMD_SETFONT);
+    HAL_CmdBufferWrite32(font);
+    HAL_CmdBufferWrite32(ptr);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_LOGO(void)
 {   
-    HAL_Write32(CMD_LOGO);
+    HAL_CmdBufferWrite32(CMD_LOGO);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_APPEND(uint32_t ptr, uint32_t num)
 {       
-    HAL_Write32(CMD_APPEND);
-    HAL_Write32(ptr);
-    HAL_Write32(num);
+    HAL_CmdBufferWrite32(CMD_APPEND);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(num);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_MEMZERO(uint32_t ptr, uint32_t num)
 {      
-    HAL_Write32(CMD_MEMZERO);
-    HAL_Write32(ptr);
-    HAL_Write32(num);
+    HAL_CmdBufferWrite32(CMD_MEMZERO);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(num);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_SCALE(int32_t sx, int32_t sy)
 {      
-    HAL_Write32(CMD_SCALE);
-    HAL_Write32(sx);
-    HAL_Write32(sy);
+    HAL_CmdBufferWrite32(CMD_SCALE);
+    HAL_CmdBufferWrite32(sx);
+    HAL_CmdBufferWrite32(sy);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_CLOCK(int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t h, uint16_t m, uint16_t s, uint16_t ms)
 {         
-    HAL_Write32(CMD_CLOCK);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (r & 0xffff));
-    HAL_Write32(((uint32_t)m << 16) | (h & 0xffff));
-    HAL_Write32(((uint32_t)ms << 16) | (s & 0xffff));
+    HAL_CmdBufferWrite32(CMD_CLOCK);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (r & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)m << 16) | (h & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)ms << 16) | (s & 0xffff));
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_GRADIENT(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
 {        
-    HAL_Write32(CMD_GRADIENT);
-    HAL_Write32(((uint32_t)y0 << 16) | (x0 & 0xffff));
-    HAL_Write32(rgb0);
-    HAL_Write32(((uint32_t)y1 << 16) | (x1 & 0xffff));
-    HAL_Write32(rgb1);
+    HAL_CmdBufferWrite32(CMD_GRADIENT);
+    HAL_CmdBufferWrite32(((uint32_t)y0 << 16) | (x0 & 0xffff));
+    HAL_CmdBufferWrite32(rgb0);
+    HAL_CmdBufferWrite32(((uint32_t)y1 << 16) | (x1 & 0xffff));
+    HAL_CmdBufferWrite32(rgb1);
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_SETMATRIX(void)
 {       
-    HAL_Write32(CMD_SETMATRIX);
+    HAL_CmdBufferWrite32(CMD_SETMATRIX);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_TRACK(int16_t x, int16_t y, int16_t w, int16_t h, int16_t tag)
 {      
-    HAL_Write32(CMD_TRACK);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(tag);
+    HAL_CmdBufferWrite32(CMD_TRACK);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(tag);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_GETPTR(uint32_t result)
 {        
-    HAL_Write32(CMD_GETPTR);
-    HAL_Write32(result);
+    HAL_CmdBufferWrite32(CMD_GETPTR);
+    HAL_CmdBufferWrite32(result);
     HAL_IncCmdPointer(8);
 }
 
 
 void EVE_CMD_PROGRESS(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range)
 {       
-    HAL_Write32(CMD_PROGRESS);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(((uint32_t)val << 16) | (options & 0xffff));
-    HAL_Write32(range);
+    HAL_CmdBufferWrite32(CMD_PROGRESS);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)val << 16) | (options & 0xffff));
+    HAL_CmdBufferWrite32(range);
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_COLDSTART(void)
 {      
-    HAL_Write32(CMD_COLDSTART);
+    HAL_CmdBufferWrite32(CMD_COLDSTART);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_DIAL(int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t val)
 {        
-    HAL_Write32(CMD_DIAL);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)options << 16) | (r & 0xffff));
-    HAL_Write32(val);
+    HAL_CmdBufferWrite32(CMD_DIAL);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)options << 16) | (r & 0xffff));
+    HAL_CmdBufferWrite32(val);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_LOADIMAGE(uint32_t ptr, uint32_t options)
 {         
-    HAL_Write32(CMD_LOADIMAGE);
-    HAL_Write32(ptr);
-    HAL_Write32(options);
+    HAL_CmdBufferWrite32(CMD_LOADIMAGE);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(options);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_DLSTART(void)
 {          
-    HAL_Write32(CMD_DLSTART);
+    HAL_CmdBufferWrite32(CMD_DLSTART);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_SNAPSHOT(uint32_t ptr)
 {            
-    HAL_Write32(CMD_SNAPSHOT);
-    HAL_Write32(ptr);
+    HAL_CmdBufferWrite32(CMD_SNAPSHOT);
+    HAL_CmdBufferWrite32(ptr);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_SCREENSAVER(void)
 {          
-    HAL_Write32(CMD_SCREENSAVER);
+    HAL_CmdBufferWrite32(CMD_SCREENSAVER);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_MEMCRC(uint32_t ptr, uint32_t num, uint32_t result)
 {            
-    HAL_Write32(CMD_MEMCRC);
-    HAL_Write32(ptr);
-    HAL_Write32(num);
-    HAL_Write32(result);
+    HAL_CmdBufferWrite32(CMD_MEMCRC);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(num);
+    HAL_CmdBufferWrite32(result);
     HAL_IncCmdPointer(16);
 }
 
@@ -1008,43 +1099,43 @@ void EVE_CMD_MEMCRC(uint32_t ptr, uint32_t num, uint32_t result)
 
 void EVE_VERTEX_FORMAT(uint8_t frac)
 {
-    HAL_Write32(VERTEX_FORMAT(frac));
+    HAL_CmdBufferWrite32(VERTEX_FORMAT(frac));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_LAYOUT_H(uint8_t linestride, uint8_t height)
 {
-    HAL_Write32(BITMAP_LAYOUT_H(linestride, height));
+    HAL_CmdBufferWrite32(BITMAP_LAYOUT_H(linestride, height));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_BITMAP_SIZE_H(uint8_t width, uint8_t height)
 {
-    HAL_Write32(BITMAP_SIZE_H(width, height));
+    HAL_CmdBufferWrite32(BITMAP_SIZE_H(width, height));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_PALETTE_SOURCE(uint32_t addr)
 {
-    HAL_Write32(PALETTE_SOURCE(addr));
+    HAL_CmdBufferWrite32(PALETTE_SOURCE(addr));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_VERTEX_TRANSLATE_X(uint32_t x)
 {
-    HAL_Write32(VERTEX_TRANSLATE_X(x));
+    HAL_CmdBufferWrite32(VERTEX_TRANSLATE_X(x));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_VERTEX_TRANSLATE_Y(uint32_t y)
 {
-    HAL_Write32(VERTEX_TRANSLATE_Y(y));
+    HAL_CmdBufferWrite32(VERTEX_TRANSLATE_Y(y));
     HAL_IncCmdPointer(4);
 }
 
 void EVE_NOP(void)
 {
-    HAL_Write32(NOP());
+    HAL_CmdBufferWrite32(NOP());
     HAL_IncCmdPointer(4);
 }
 
@@ -1053,111 +1144,111 @@ void EVE_NOP(void)
 
 void EVE_CMD_SETROTATE(uint32_t r)
 {          
-    HAL_Write32(CMD_SETROTATE);
-    HAL_Write32(r);
+    HAL_CmdBufferWrite32(CMD_SETROTATE);
+    HAL_CmdBufferWrite32(r);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_SETFONT2(uint32_t font, uint32_t ptr, uint32_t firstchar)
 {           
-    HAL_Write32(CMD_SETFONT2);
-    HAL_Write32(font);
-    HAL_Write32(ptr);
-    HAL_Write32(firstchar);
+    HAL_CmdBufferWrite32(CMD_SETFONT2);
+    HAL_CmdBufferWrite32(font);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(firstchar);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_SNAPSHOT2(uint32_t fmt, uint32_t ptr, int16_t x, int16_t y, int16_t w, int16_t h)
 {          
-    HAL_Write32(CMD_SNAPSHOT2);
-    HAL_Write32(fmt);
-    HAL_Write32(ptr);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(CMD_SNAPSHOT2);
+    HAL_CmdBufferWrite32(fmt);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_MEDIAFIFO(uint32_t ptr, uint32_t size)
 {    
-    HAL_Write32(CMD_MEDIAFIFO);
-    HAL_Write32(ptr);
-    HAL_Write32(size);
+    HAL_CmdBufferWrite32(CMD_MEDIAFIFO);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(size);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_INT_SWLOADIMAGE(uint32_t ptr, uint32_t options)
 {        
-    HAL_Write32(CMD_INT_SWLOADIMAGE);
-    HAL_Write32(ptr);
-    HAL_Write32(options);
+    HAL_CmdBufferWrite32(CMD_INT_SWLOADIMAGE);
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(options);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_SYNC(void)
 {        
-    HAL_Write32(CMD_SYNC);
+    HAL_CmdBufferWrite32(CMD_SYNC);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_CSKETCH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint32_t ptr, uint16_t format, uint16_t freq)
 {        
-    HAL_Write32(CMD_CSKETCH);
-    HAL_Write32(((uint32_t)y << 16) | (x & 0xffff));
-    HAL_Write32(((uint32_t)h << 16) | (w & 0xffff));
-    HAL_Write32(ptr);
-    HAL_Write32(((uint32_t)freq << 16) | (format & 0xffff));
+    HAL_CmdBufferWrite32(CMD_CSKETCH);
+    HAL_CmdBufferWrite32(((uint32_t)y << 16) | (x & 0xffff));
+    HAL_CmdBufferWrite32(((uint32_t)h << 16) | (w & 0xffff));
+    HAL_CmdBufferWrite32(ptr);
+    HAL_CmdBufferWrite32(((uint32_t)freq << 16) | (format & 0xffff));
     HAL_IncCmdPointer(20);
 }
 
 void EVE_CMD_ROMFONT(uint32_t font, uint32_t romslot)
 {       
-    HAL_Write32(CMD_ROMFONT);
-    HAL_Write32(font);
-    HAL_Write32(romslot);
+    HAL_CmdBufferWrite32(CMD_ROMFONT);
+    HAL_CmdBufferWrite32(font);
+    HAL_CmdBufferWrite32(romslot);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_PLAYVIDEO(uint32_t options)
 {      
-    HAL_Write32(CMD_PLAYVIDEO);
-    HAL_Write32(options);
+    HAL_CmdBufferWrite32(CMD_PLAYVIDEO);
+    HAL_CmdBufferWrite32(options);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_VIDEOFRAME(uint32_t dst, uint32_t ptr)
 {  
-    HAL_Write32(CMD_VIDEOFRAME);
-    HAL_Write32(dst);
-    HAL_Write32(ptr);
+    HAL_CmdBufferWrite32(CMD_VIDEOFRAME);
+    HAL_CmdBufferWrite32(dst);
+    HAL_CmdBufferWrite32(ptr);
     HAL_IncCmdPointer(12);
 }
 
 void EVE_CMD_VIDEOSTART(void)
 {
-    HAL_Write32(CMD_VIDEOSTART);
+    HAL_CmdBufferWrite32(CMD_VIDEOSTART);
     HAL_IncCmdPointer(4);
 }
 
 void EVE_CMD_SETBASE(uint32_t base)
 {
-    HAL_Write32(CMD_SETBASE);
-    HAL_Write32(base);
+    HAL_CmdBufferWrite32(CMD_SETBASE);
+    HAL_CmdBufferWrite32(base);
     HAL_IncCmdPointer(8);
 }
 
 void EVE_CMD_SETBITMAP(uint32_t source, uint16_t fmt, uint16_t w, uint16_t h)
 {
-    HAL_Write32(CMD_SETBITMAP);
-    HAL_Write32(source);
-    HAL_Write32(((uint32_t)w << 16) | (fmt & 0xffff));
-    HAL_Write32(h);
+    HAL_CmdBufferWrite32(CMD_SETBITMAP);
+    HAL_CmdBufferWrite32(source);
+    HAL_CmdBufferWrite32(((uint32_t)w << 16) | (fmt & 0xffff));
+    HAL_CmdBufferWrite32(h);
     HAL_IncCmdPointer(16);
 }
 
 void EVE_CMD_SETSCRATCH(uint32_t handle)
 {
-    HAL_Write32(CMD_SETSCRATCH);
-    HAL_Write32(handle);
+    HAL_CmdBufferWrite32(CMD_SETSCRATCH);
+    HAL_CmdBufferWrite32(handle);
     HAL_IncCmdPointer(8);
 }
 
@@ -51,6 +51,43 @@
 // Used to navigate command ring buffer
 static uint16_t writeCmdPointer = 0x0000;
 
+// Staging buffer for co-processor commands. Commands are collected here
+// and sent to RAM_CMD in a single SPI burst by HAL_CmdBufferFlush.
+static uint32_t cmdBuffer[EVE_CMD_BUFFER_SIZE / sizeof(uint32_t)];
+// Number of bytes held in the staging buffer
+static uint16_t cmdBufferLength = 0;
+// Offset in RAM_CMD where the staging buffer will be written
+static uint16_t cmdBufferPointer = 0x0000;
+// Smallest segment worth sending when waiting for command FIFO space
+#define HAL_CMD_SEGMENT_MIN 64
+
+// Running totals of bytes committed to and consumed by the co-processor.
+// These are used as fences to track completion of co-processor lists.
+static uint32_t cmdCommitted = 0;
+static uint32_t cmdCompleted = 0;
+// Last values written to REG_CMD_WRITE and read from REG_CMD_READ
+static uint16_t lastWriteCmdPointer = 0x0000;
+static uint16_t lastReadCmdPointer = 0x0000;
+
+#ifdef EVE_SPI_TRACE
+// Trace records. See HAL.h for the format.
+static uint32_t traceBuffer[EVE_SPI_TRACE_SIZE / sizeof(uint32_t)];
+// Bytes used in the trace buffer
+static uint32_t traceLength = 0;
+// Records dropped because the trace buffer was full
+static uint32_t traceLost = 0;
+// Header of the record for the current chip select cycle
+static uint32_t *traceRecord = NULL;
+// Set while data for a command is streamed to RAM_CMD
+static uint8_t traceStream = 0;
+
+#define HAL_TRACE_BEGIN(a, t) HAL_TraceBegin(a, t)
+#define HAL_TRACE_DATA(d, l) HAL_TraceData((const uint8_t *)(d), l)
+#else
+#define HAL_TRACE_BEGIN(a, t)
+#define HAL_TRACE_DATA(d, l)
+#endif // EVE_SPI_TRACE
+
 
 void HAL_Init(void)
 {
@@ -112,6 +149,72 @@ void HAL_PowerDown(int8_t enable)
 		MCU_PDlow();
 }
 
+// ############################# SPI TRACE #####################################
+#ifdef EVE_SPI_TRACE
+// ------------------ Start a record for a chip select cycle -------------------
+static void HAL_TraceBegin(uint32_t address, uint8_t type)
+{
+	traceLength = (traceLength + 3) & (~3);
+	if (traceLength + (3 * sizeof(uint32_t)) > sizeof(traceBuffer))
+	{
+		traceRecord = NULL;
+		traceLost++;
+		return;
+	}
+
+	traceRecord = &traceBuffer[traceLength / sizeof(uint32_t)];
+	traceRecord[0] = (address & 0x00ffffff) | (type << 24);
+	traceRecord[1] = 0;
+	traceRecord[2] = 0;
+	traceLength += 3 * sizeof(uint32_t);
+}
+
+// ------------------ Add data transferred to the current record ---------------
+static void HAL_TraceData(const uint8_t *data, uint32_t length)
+{
+	if (traceRecord == NULL)
+	{
+		return;
+	}
+
+	traceRecord[1] += length;
+#ifdef EVE_SPI_TRACE_DATA
+	// Data sent from program memory is counted but not recorded.
+	if (data == NULL)
+	{
+		return;
+	}
+	// Data which does not fit is counted but not recorded.
+	if (length > sizeof(traceBuffer) - traceLength)
+	{
+		length = sizeof(traceBuffer) - traceLength;
+	}
+	memcpy((uint8_t *)traceBuffer + traceLength, data, length);
+	traceRecord[2] += length;
+	traceLength += length;
+#else
+	(void)data;
+#endif // EVE_SPI_TRACE_DATA
+}
+
+// ------------------------- Get the trace records -----------------------------
+uint32_t HAL_TraceGet(const uint8_t **buffer, uint32_t *lost)
+{
+	*buffer = (const uint8_t *)traceBuffer;
+	*lost = traceLost;
+
+	return traceLength;
+}
+
+// ------------------------- Empty the trace buffer ----------------------------
+void HAL_TraceReset(void)
+{
+	traceLength = 0;
+	traceLost = 0;
+	traceRecord = NULL;
+}
+#endif // EVE_SPI_TRACE
+
 // ------------------ Send FT81x register address for writing ------------------
 void HAL_SetWriteAddress(uint32_t address)
 {
@@ -119,6 +222,11 @@ void HAL_SetWriteAddress(uint32_t address)
 	// written. Ignore return values as this is an SPI write only.
 	// Send high byte of address with 'write' bits set.
 	MCU_SPIWrite24(MCU_htobe32((address << 8) | (1 << 31)));
+
+#ifdef EVE_SPI_TRACE
+	HAL_TRACE_BEGIN(address, ((traceStream) && (address >= RAM_CMD)
+			&& (address < RAM_CMD + FT_CMD_FIFO_SIZE)) ? HAL_TRACE_STREAM : HAL_TRACE_WRITE);
+#endif // EVE_SPI_TRACE
 }
 
 // ------------------ Send FT81x register address for reading ------------------
@@ -128,6 +236,8 @@ void HAL_SetReadAddress(uint32_t address)
 	// Ignore return values as this is an SPI write only.
 	// Send high byte of address with 'read' bits set.
 	MCU_SPIWrite32(MCU_htobe32((address << 8) | (0 << 31)));
+
+	HAL_TRACE_BEGIN(address, HAL_TRACE_READ);
 }
 
 // ------------------------ Send a block of data --------------------------
@@ -135,8 +245,10 @@ void HAL_Write(const uint8_t *buffer, uint32_t length)
 {
 	// Send multiple bytes of data after previously sending address. Ignore return
 	// values as this is an SPI write only. Data must be the correct endianess
-	// for the SPI bus.
-	MCU_SPIWrite(buffer, length);
+	// for the SPI bus. Blocks are sent as a burst to keep the SPI bus busy.
+	MCU_SPIWriteBurst(buffer, length);
+
+	HAL_TRACE_DATA(buffer, length);
 }
 
 // ------------------------ Send a 32-bit data value --------------------------
@@ -144,7 +256,10 @@ void HAL_Write32(uint32_t val32)
 {    
 	// Send four bytes of data after previously sending address. Ignore return
 	// values as this is an SPI write only.
-	MCU_SPIWrite32(MCU_htole32(val32));
+	val32 = MCU_htole32(val32);
+	MCU_SPIWrite32(val32);
+
+	HAL_TRACE_DATA(&val32, sizeof(val32));
 }
 
 // ------------------------ Send a 16-bit data value --------------------------
@@ -152,7 +267,10 @@ void HAL_Write16(uint16_t val16)
 {
 	// Send two bytes of data after previously sending address. Ignore return
 	// values as this is an SPI write only.
-	MCU_SPIWrite16(MCU_htole16(val16));
+	val16 = MCU_htole16(val16);
+	MCU_SPIWrite16(val16);
+
+	HAL_TRACE_DATA(&val16, sizeof(val16));
 }
 
 // ------------------------ Send an 8-bit data value ---------------------------
@@ -161,6 +279,8 @@ void HAL_Write8(uint8_t val8)
 	// Send one byte of data after previously sending address. Ignore return
 	// values as this is an SPI write only.
 	MCU_SPIWrite8(val8);
+
+	HAL_TRACE_DATA(&val8, sizeof(val8));
 }
 
 // ------------------------ Read a 32-bit data value --------------------------
@@ -172,11 +292,22 @@ uint32_t HAL_Read32(void)
 
 	// Read low byte of data first.
 	val32 = MCU_SPIRead32();
+	HAL_TRACE_DATA(&val32, sizeof(val32));
 
 	// Return combined 32-bit value
 	return MCU_le32toh(val32);
 }
 
+// ------------------------ Read a block of data ------------------------------
+void HAL_Read(uint8_t *buffer, uint32_t length)
+{
+	// Read multiple bytes from a register or memory previously addressed.
+	// Data is in the endianess of the EVE.
+	MCU_SPIRead(buffer, length);
+
+	HAL_TRACE_DATA(buffer, length);
+}
+
 // ------------------------ Read a 16-bit data value ---------------------------
 uint16_t HAL_Read16(void)
 {
@@ -186,6 +317,7 @@ uint16_t HAL_Read16(void)
 
 	// Read low byte of data first.
 	val16 = MCU_SPIRead16();
+	HAL_TRACE_DATA(&val16, sizeof(val16));
 
 	// Return combined 16-bit value
 	return MCU_le16toh(val16);
@@ -199,6 +331,7 @@ uint8_t HAL_Read8(void)
 	uint8_t val8;
 
 	val8 = MCU_SPIRead8();
+	HAL_TRACE_DATA(&val8, sizeof(val8));
 
 	// Return 8-bit value read
 	return val8;
@@ -266,6 +399,33 @@ uint32_t HAL_MemRead32(uint32_t address)
 	// Return 32-bit value read
 	return val32;
 }
+// -------------- Read a block of data from specified address -------------------
+void HAL_MemReadBlock(uint32_t address, uint8_t *buffer, uint32_t length)
+{
+	// CS low begins the SPI transfer
+	MCU_CSlow();
+	// Send address to be read
+	HAL_SetReadAddress(address);
+	// Read the data
+	HAL_Read(buffer, length);
+	// CS high terminates the SPI transfer
+	MCU_CShigh();
+}
+
+// ------------ Write a block from program memory to specified address ---------
+void HAL_MemWriteFlash(uint32_t address, uintptr_t flash, uint32_t length)
+{
+	// CS low begins the SPI transfer
+	MCU_CSlow();
+	// Send address to be written
+	HAL_SetWriteAddress(address);
+	// Send the data
+	MCU_SPIWriteFlash(flash, length);
+	HAL_TRACE_DATA(NULL, length);
+	// CS high terminates the SPI transfer
+	MCU_CShigh();
+}
+
 // -------------- Read a 16-bit value from specified address --------------------
 uint16_t HAL_MemRead16(uint32_t address)
 {
@@ -300,10 +460,32 @@ uint8_t HAL_MemRead8(uint32_t address)
 	// Return 8-bit value read
 	return val8;
 }
+// ############################# INTERRUPTS ####################################
+// --------------------- Enable interrupts from EVE ----------------------------
+void HAL_IntSetup(uint8_t mask, void (*handler)(void))
+{
+	HAL_MemWrite8(REG_INT_EN, 0);
+	HAL_MemWrite8(REG_INT_MASK, mask);
+	// Discard any events which happened before now.
+	HAL_IntFlags();
+
+	MCU_IntSetup(handler);
+
+	HAL_MemWrite8(REG_INT_EN, 1);
+}
+
+// --------------------- Read and clear interrupt flags ------------------------
+uint8_t HAL_IntFlags(void)
+{
+	return HAL_MemRead8(REG_INT_FLAGS);
+}
+
 // ############################# HOST COMMANDS #################################
 // -------------------------- Write a host command -----------------------------
 void HAL_CmdWrite(uint8_t cmd, uint8_t param)
 {
+	HAL_TRACE_BEGIN((param << 8) | cmd, HAL_TRACE_HOST);
+
 	// CS low begins the SPI transfer
 	MCU_CSlow();
 	// Send command
@@ -317,6 +499,34 @@ void HAL_CmdWrite(uint8_t cmd, uint8_t param)
 }
 // ######################## SUPPORTING FUNCTIONS ###############################
 
+// ------------- Write REG_CMD_WRITE and advance the commit total --------------
+static void HAL_CommitCmdPointer(uint16_t pointer)
+{
+	HAL_MemWrite32(REG_CMD_WRITE, pointer);
+
+	cmdCommitted += (pointer - lastWriteCmdPointer) & (FT_CMD_FIFO_SIZE - 1);
+	lastWriteCmdPointer = pointer;
+}
+
+// ------------- Read REG_CMD_READ and advance the completed total -------------
+static uint32_t HAL_ReadCmdPointer(void)
+{
+	uint32_t readCmdPointer;
+
+	// Check the graphics processor read pointer
+	readCmdPointer = HAL_MemRead32(REG_CMD_READ);
+
+	// The co-processor can never be more than one FIFO behind so the
+	// distance moved since the last read is unambiguous.
+	if (readCmdPointer != 0xFFF)
+	{
+		cmdCompleted += ((uint16_t)readCmdPointer - lastReadCmdPointer) & (FT_CMD_FIFO_SIZE - 1);
+		lastReadCmdPointer = (uint16_t)readCmdPointer;
+	}
+
+	return readCmdPointer;
+}
+
 // --------- Increment co-processor address offset counter --------------------
 void HAL_IncCmdPointer(uint16_t commandSize)
 {
@@ -331,10 +541,19 @@ uint16_t HAL_GetCmdPointer(void)
 	return writeCmdPointer;
 }
 
+// --------- Commit co-processor address offset counter to EVE ----------------
 void HAL_WriteCmdPointer(void)
 {
-	// and move write pointer to here
-	HAL_MemWrite32(REG_CMD_WRITE, writeCmdPointer);
+	// Any staged commands must reach RAM_CMD first
+	HAL_CmdBufferFlush();
+	// and move write pointer to here, unless the flush already has
+	if (writeCmdPointer != lastWriteCmdPointer)
+	{
+		HAL_CommitCmdPointer(writeCmdPointer);
+	}
+	// Staging resumes from the committed position. This also covers data
+	// written directly to RAM_CMD by the caller.
+	cmdBufferPointer = writeCmdPointer;
 }
 
 // ------ Wait for co-processor read and write pointers to be equal ------------
@@ -346,7 +565,7 @@ uint8_t HAL_WaitCmdFifoEmpty(void)
 	do
 	{
 		// Read the graphics processor read pointer
-		readCmdPointer = HAL_MemRead32(REG_CMD_READ);
+		readCmdPointer = HAL_ReadCmdPointer();
 
 	} while ((writeCmdPointer != readCmdPointer) && (readCmdPointer != 0xFFF));
 
@@ -369,7 +588,7 @@ uint16_t HAL_CheckCmdFreeSpace(void)
 	uint16_t Fullness, Freespace;
 
 	// Check the graphics processor read pointer
-	readCmdPointer = HAL_MemRead32(REG_CMD_READ);
+	readCmdPointer = HAL_ReadCmdPointer();
 
 	// Fullness is difference between MCUs current write pointer value and the FT81x's REG_CMD_READ
 	Fullness = ((writeCmdPointer - (uint16_t)readCmdPointer) & (FT_CMD_FIFO_SIZE - 1));
@@ -378,3 +597,200 @@ uint16_t HAL_CheckCmdFreeSpace(void)
 
 	return Freespace;
 }
+
+// ------------ Fence marking the end of all committed commands ----------------
+uint32_t HAL_GetCmdFence(void)
+{
+	return cmdCommitted;
+}
+
+// ------------- Check if co-processor has passed a fence ----------------------
+uint8_t HAL_CheckCmdFence(uint32_t fence)
+{
+	if (HAL_ReadCmdPointer() == 0xFFF)
+	{
+		// Return 0xFF if an error occurred
+		return 0xFF;
+	}
+
+	// Return 1 once all commands before the fence are complete
+	return ((int32_t)(cmdCompleted - fence) >= 0) ? 1 : 0;
+}
+
+// --------------- Wait for co-processor to pass a fence -----------------------
+uint8_t HAL_WaitCmdFence(uint32_t fence)
+{
+	uint8_t status;
+
+	do
+	{
+		status = HAL_CheckCmdFence(fence);
+	} while (status == 0);
+
+	// Return 0 for normal completion or 0xFF for an error condition
+	return (status == 1) ? 0 : 0xFF;
+}
+
+// ----------------------- Reset the co-processor -----------------------------
+void HAL_ResetCmdFifo(void)
+{
+	// Hold the co-processor in reset while the pointers are cleared
+	HAL_MemWrite8(REG_CPURESET, 1);
+	HAL_MemWrite32(REG_CMD_READ, 0);
+	HAL_MemWrite32(REG_CMD_WRITE, 0);
+	HAL_MemWrite32(REG_CMD_DL, 0);
+	HAL_MemWrite8(REG_CPURESET, 0);
+
+	// Staged commands are discarded and nothing is left to complete
+	writeCmdPointer = 0;
+	cmdBufferLength = 0;
+	cmdBufferPointer = 0;
+	lastWriteCmdPointer = 0;
+	lastReadCmdPointer = 0;
+	cmdCompleted = cmdCommitted;
+}
+
+// ######################## COMMAND STAGING BUFFER #############################
+
+// ------------ Free space in CMD FIFO after a given write offset --------------
+static uint16_t HAL_CmdFreeSpaceFrom(uint16_t offset)
+{
+	uint32_t readCmdPointer;
+	uint16_t Fullness;
+
+	// Check the graphics processor read pointer
+	readCmdPointer = HAL_ReadCmdPointer();
+
+	Fullness = ((offset - (uint16_t)readCmdPointer) & (FT_CMD_FIFO_SIZE - 1));
+
+	return (FT_CMD_FIFO_SIZE - 4) - Fullness;
+}
+
+// ------------------ Add a 32-bit value to the staging buffer -----------------
+void HAL_CmdBufferWrite32(uint32_t val32)
+{
+	// Make room if the staging buffer is full. The co-processor will wait
+	// for the remainder of any partially sent command.
+	if (cmdBufferLength >= EVE_CMD_BUFFER_SIZE)
+	{
+		HAL_CmdBufferFlush();
+	}
+
+	// Store in SPI bus order so the buffer can be sent unchanged.
+	cmdBuffer[cmdBufferLength / sizeof(uint32_t)] = MCU_htole32(val32);
+	cmdBufferLength += sizeof(uint32_t);
+}
+
+// ------------- Stream data into the CMD FIFO in segments --------------------
+// The source is a data memory buffer or, if flash is set, an address in
+// program memory.
+static void HAL_CmdWriteSegments(uintptr_t source, uint32_t length, uint8_t flash)
+{
+	uint16_t Freespace = 0;
+	uint16_t MinSpace;
+	uint32_t ChunkSize;
+	uint8_t Uncommitted = 0;
+
+	while (length)
+	{
+		// Space known to be free is used up before REG_CMD_READ is read
+		// again. Then wait until a worthwhile amount of space is free.
+		// Sending a few bytes at a time would spend more time on addressing
+		// than data.
+		MinSpace = (length < HAL_CMD_SEGMENT_MIN) ? length : HAL_CMD_SEGMENT_MIN;
+		if (Freespace < MinSpace)
+		{
+			// The co-processor can only free space in data it has been given
+			if (Uncommitted)
+			{
+				HAL_CommitCmdPointer(cmdBufferPointer);
+				Uncommitted = 0;
+			}
+			do
+			{
+				Freespace = HAL_CmdFreeSpaceFrom(cmdBufferPointer);
+			} while (Freespace < MinSpace);
+		}
+
+		ChunkSize = (length < Freespace) ? length : Freespace;
+
+		// RAM_CMD does not wrap within an SPI transfer so split the burst
+		// at the end of the ring buffer.
+		if (cmdBufferPointer + ChunkSize > FT_CMD_FIFO_SIZE)
+		{
+			ChunkSize = FT_CMD_FIFO_SIZE - cmdBufferPointer;
+		}
+
+		// Begin an SPI burst write
+		MCU_CSlow();
+		// to the next location in the FIFO
+		HAL_SetWriteAddress(RAM_CMD + cmdBufferPointer);
+		if (flash)
+		{
+			MCU_SPIWriteFlash(source, ChunkSize);
+			HAL_TRACE_DATA(NULL, ChunkSize);
+		}
+		else
+		{
+			HAL_Write((const uint8_t *)source, ChunkSize);
+		}
+		// End the SPI burst
+		MCU_CShigh();
+
+		source += ChunkSize;
+		length -= ChunkSize;
+		Freespace -= ChunkSize;
+		cmdBufferPointer = (cmdBufferPointer + ChunkSize) & (FT_CMD_FIFO_SIZE - 1);
+		Uncommitted = 1;
+	}
+
+	// Let the co-processor start on the data
+	if (Uncommitted)
+	{
+		HAL_CommitCmdPointer(cmdBufferPointer);
+	}
+}
+
+// --------------- Send the staging buffer to the command FIFO -----------------
+void HAL_CmdBufferFlush(void)
+{
+	HAL_CmdWriteSegments((uintptr_t)cmdBuffer, cmdBufferLength, 0);
+
+	cmdBufferLength = 0;
+}
+
+// --------------- Stream a block of data to the command FIFO ------------------
+void HAL_CmdStreamWrite(const uint8_t *buffer, uint32_t length)
+{
+	// Commands staged before the data must reach the FIFO first
+	HAL_CmdBufferFlush();
+
+#ifdef EVE_SPI_TRACE
+	traceStream = 1;
+#endif // EVE_SPI_TRACE
+	HAL_CmdWriteSegments((uintptr_t)buffer, length, 0);
+#ifdef EVE_SPI_TRACE
+	traceStream = 0;
+#endif // EVE_SPI_TRACE
+
+	// The data is already committed so keep the write pointer in step
+	writeCmdPointer = cmdBufferPointer;
+}
+
+// ---------- Stream a block of program memory to the command FIFO -------------
+void HAL_CmdStreamWriteFlash(uintptr_t flash, uint32_t length)
+{
+	// Commands staged before the data must reach the FIFO first
+	HAL_CmdBufferFlush();
+
+#ifdef EVE_SPI_TRACE
+	traceStream = 1;
+#endif // EVE_SPI_TRACE
+	HAL_CmdWriteSegments(flash, length, 1);
+#ifdef EVE_SPI_TRACE
+	traceStream = 0;
+#endif // EVE_SPI_TRACE
+
+	// The data is already committed so keep the write pointer in step
+	writeCmdPointer = cmdBufferPointer;
+}
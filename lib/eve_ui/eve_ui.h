@@ -43,7 +43,12 @@
 #ifndef _EVE_COMMON_H
 #define _EVE_COMMON_H
 
+#ifdef __FT32__
 #include <ft900.h>
+#else
+// Host builds have a single address space for code and data.
+#define __flash__
+#endif // __FT32__
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,7 +56,8 @@ extern "C" {
 
 /**
  @brief Custom font and bitmap definitions.
- @details These utilise handles 0 to 14.
+ @details These utilise handles 1 to 8 which are reserved from the bitmap
+ handle allocator when the images are loaded.
  */
 //@{
 #define FONT_HEADER 28
@@ -86,6 +92,8 @@ extern "C" {
  * @details Screen control is performed with a set of buttons.
  */
 //@{
+#define TAG_PAGE_UP		246			// Scroll multiline display back
+#define TAG_PAGE_DOWN	247			// Scroll multiline display forward
 #define TAG_REFRESH		248
 #define TAG_SAVE		249
 #define TAG_KEYPAD		250
@@ -111,6 +119,104 @@ extern "C" {
 
 #define EVE_OPTIONS_READ_ONLY		(1 << 8) // Flag an item as read only
 
+/**
+ * @brief RAM_G and bitmap handle allocation.
+ * @details Fonts and images are allocated from the arena at the bottom of
+ * RAM_G. Other areas are allocated from the top and can be freed. On
+ * FT81x the co-processor overwrites the top of RAM_G while decoding a PNG
+ * image so nothing is allocated there.
+ */
+//@{
+#define EVE_RAMG_NONE				0xffffffff // No RAM_G available
+#define EVE_HANDLE_NONE				0xff // No bitmap handle available
+#define EVE_RAM_G_DLCACHE_SIZE		(32 * 1024) // Display list cache
+#define EVE_RAM_G_HISTORY_SIZE		(64 * 1024) // Multiline display history
+#define EVE_RAM_G_MEDIAFIFO_SIZE	(32 * 1024) // Media FIFO for streamed images
+#define EVE_RAM_G_VIDEOFIFO_SIZE	(128 * 1024) // Media FIFO for streamed video
+#define EVE_RAM_G_REMOTE_SIZE		(256 * 1024) // Remote display client data
+#define EVE_RAM_G_SNAPSHOT_SIZE		(32 * 1024) // Band of lines for screenshots
+#define EVE_RAM_G_PNG_WORK_SIZE		(42 * 1024) // Top of RAM_G used to decode PNG
+//@}
+
+/**
+ * @brief Longest wait for the co-processor to finish streamed data.
+ * @details Counted in display frames by EVE_LIB_AwaitFenceFrames. Data
+ * which is cut short leaves the co-processor waiting for more.
+ */
+#define EVE_COPRO_WAIT_FRAMES		60
+
+/**
+ * @brief Results from streamed image loading.
+ */
+//@{
+#define EVE_IMAGE_OK				0
+#define EVE_IMAGE_ERROR_MEMORY		-1 // No RAM_G or bitmap handle
+#define EVE_IMAGE_ERROR_FORMAT		-2 // Not a baseline JPEG or 8 bit PNG
+#define EVE_IMAGE_ERROR_SIZE		-3 // Larger than the display
+#define EVE_IMAGE_ERROR_HEADER		-4 // Header does not fit in the media FIFO
+#define EVE_IMAGE_ERROR_DECODE		-5 // Co-processor fault or incomplete image
+//@}
+
+/**
+ * @brief Results from streamed video playback.
+ */
+//@{
+#define EVE_VIDEO_OK				0
+#define EVE_VIDEO_ERROR_MEMORY		-1 // No RAM_G for the media FIFO
+#define EVE_VIDEO_ERROR_FORMAT		-2 // Not an AVI file
+#define EVE_VIDEO_ERROR_SIZE		-3 // Larger than the display
+#define EVE_VIDEO_ERROR_DECODE		-5 // Co-processor fault or incomplete video
+//@}
+
+/**
+ * @brief Results from remote display frames.
+ */
+//@{
+#define EVE_REMOTE_OK				0
+#define EVE_REMOTE_ERROR_MEMORY		-1 // No RAM_G for the client
+#define EVE_REMOTE_ERROR_FRAME		-2 // Incomplete or unsupported command
+#define EVE_REMOTE_ERROR_FAULT		-3 // Co-processor fault
+#define EVE_REMOTE_ERROR_STATE		-4 // Remote display not started
+//@}
+
+/**
+ * @brief Results from screenshots.
+ */
+//@{
+#define EVE_SNAPSHOT_OK				0
+#define EVE_SNAPSHOT_ERROR_MEMORY	-1 // No RAM_G for the band
+#define EVE_SNAPSHOT_ERROR_SIZE		-2 // Buffer smaller than one packet
+#define EVE_SNAPSHOT_ERROR_FAULT	-3 // Co-processor fault
+#define EVE_SNAPSHOT_ERROR_STATE	-4 // Screenshot not started
+//@}
+
+/**
+ * @brief Display list fragments held in the display list cache.
+ */
+//@{
+#define EVE_DLCACHE_HEADER_BAR		0 // Header bar, keyed by options
+#define EVE_DLCACHE_KEYBOARD		1 // Keyboard and keypad layouts
+#define EVE_DLCACHE_ALL				0xff
+//@}
+
+/**
+ @brief Function to draw a cached display list fragment.
+ @details Called with the key passed to eve_ui_dlcache_draw when the
+ fragment is not in the cache.
+ */
+typedef void (*eve_ui_dlcache_draw_t)(uint32_t key);
+
+/**
+ @brief Functions to signal and wait for touch events.
+ @details The notify function is called from interrupt context when EVE
+ reports a touch or a change of tag. The wait function is called from
+ input loops and should block until notify is called or a timeout expires.
+ */
+//@{
+typedef void (*eve_ui_touch_notify_t)(void);
+typedef void (*eve_ui_touch_wait_t)(void);
+//@}
+
 
 /**
  @brief Structure to hold touchscreen calibration settings.
@@ -122,53 +228,83 @@ struct touchscreen_calibration {
 	uint32_t transform[6];
 };
 
+/**
+ @brief Statistics for streamed video playback.
+ @details Frames are counted as decoded when the co-processor has read
+ all of their data from the media FIFO. An underrun is counted each time
+ the media FIFO is found empty during playback.
+ */
+struct eve_ui_video_stats {
+	uint32_t frames; // Frames decoded
+	uint32_t total_frames; // Frames in the AVI header
+	uint32_t frame_us; // Frame period in the AVI header
+	uint32_t play_ms; // Time from the start of playback
+	uint32_t bytes; // Bytes written to the media FIFO
+	uint32_t underruns;
+	uint32_t min_level; // Least data in the media FIFO during playback
+};
+
 /**
  @brief Pointers to custom images in external C file.
+ @details JPEG images are in eve_ui_images.c and compressed RGB565 images
+ (_z) are in eve_ui_images_z.c. Only one set is compiled.
  */
 //@{
 extern const uint32_t img_bridgetek_logo_size;
 extern const uint8_t __flash__ *img_bridgetek_logo_data;
+extern const uint32_t img_bridgetek_logo_z_size;
+extern const uint8_t __flash__ *img_bridgetek_logo_z_data;
 /// Address in RAM_G
 extern uint32_t img_bridgetek_logo_width;
 extern uint32_t img_bridgetek_logo_height;
 
 extern const uint32_t img_settings_size;
 extern const uint8_t __flash__ *img_settings_data;
+extern const uint32_t img_settings_z_size;
+extern const uint8_t __flash__ *img_settings_z_data;
 /// Address in RAM_G
 extern uint32_t img_settings_width;
 extern uint32_t img_settings_height;
 
 extern const uint32_t img_cancel_size;
 extern const uint8_t __flash__ *img_cancel_data;
+extern const uint32_t img_cancel_z_size;
+extern const uint8_t __flash__ *img_cancel_z_data;
 /// Address in RAM_G
 extern uint32_t img_cancel_width;
 extern uint32_t img_cancel_height;
 
 extern const uint32_t img_save_size;
 extern const uint8_t __flash__ *img_save_data;
+extern const uint32_t img_save_z_size;
+extern const uint8_t __flash__ *img_save_z_data;
 /// Address in RAM_G
 extern uint32_t img_save_width;
 extern uint32_t img_save_height;
 
 extern const uint32_t img_refresh_size;
 extern const uint8_t __flash__ *img_refresh_data;
+extern const uint32_t img_refresh_z_size;
+extern const uint8_t __flash__ *img_refresh_z_data;
 /// Address in RAM_G
 extern uint32_t img_refresh_width;
 extern uint32_t img_refresh_height;
 
 extern const uint32_t img_keypad_size;
 extern const uint8_t __flash__ *img_keypad_data;
+extern const uint32_t img_keypad_z_size;
+extern const uint8_t __flash__ *img_keypad_z_data;
 /// Address in RAM_G
 extern uint32_t img_keypad_width;
 extern uint32_t img_keypad_height;
 
 extern const uint32_t img_keyboard_size;
 extern const uint8_t __flash__ *img_keyboard_data;
+extern const uint32_t img_keyboard_z_size;
+extern const uint8_t __flash__ *img_keyboard_z_data;
 /// Address in RAM_G
 extern uint32_t img_keyboard_width;
 extern uint32_t img_keyboard_height;
-
-extern uint32_t img_end_address;
 //@}
 
 void eve_ui_calibrate();
@@ -178,17 +314,58 @@ void eve_ui_play_sound(uint8_t sound, uint8_t volume);
 uint8_t eve_ui_read_tag(uint8_t *key);
 
 void eve_ui_splash(char *msg, uint32_t options);
-void eve_ui_multiline_init(char *toast, uint32_t options, uint32_t format);
+void eve_ui_multiline_init(char *toast, uint32_t options);
 void eve_ui_multiline_add(char *message, uint32_t format);
 void eve_ui_multiline_display(void);
+uint8_t eve_ui_multiline_update(void);
+void eve_ui_multiline_scroll(int32_t lines);
+void eve_ui_multiline_page(int32_t pages);
+void eve_ui_multiline_stats(uint32_t *lines, uint32_t *frames);
 uint16_t eve_ui_present_list(char *toast, uint32_t options, char **list, uint16_t count);
 uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list, uint32_t *list_options, uint16_t count);
+void eve_ui_present_list_preview(char *toast, uint32_t options, char **list, uint16_t count);
 uint16_t eve_ui_keyboard_line_input(char *toast, uint32_t options, char *buffer, uint16_t len);
 uint16_t eve_ui_keyboard_number_input(char *toast, uint32_t options, char *buffer, uint16_t len);
 uint16_t eve_ui_keyboard_ipaddr_input(char *toast, uint32_t options, char *buffer, uint16_t len);
 void eve_ui_screenshot(void);
+void eve_ui_copro_reset(void);
+
+int8_t eve_ui_image_start(void);
+int8_t eve_ui_image_write(const uint8_t *data, uint16_t length);
+int8_t eve_ui_image_end(void);
+void eve_ui_image_abort(void);
+void eve_ui_image_release(void);
+
+int8_t eve_ui_video_start(void);
+int8_t eve_ui_video_write(const uint8_t *data, uint16_t length);
+int8_t eve_ui_video_end(void);
+void eve_ui_video_abort(void);
+void eve_ui_video_stats(struct eve_ui_video_stats *stats);
+
+int8_t eve_ui_remote_start(uint32_t *address, uint32_t *size);
+int8_t eve_ui_remote_write(const uint8_t *data, uint16_t length, uint32_t left);
+int8_t eve_ui_remote_frame(uint8_t complete);
+void eve_ui_remote_end(void);
+
+int8_t eve_ui_snapshot_start(uint16_t *width, uint16_t *height);
+int8_t eve_ui_snapshot_read(uint8_t *buffer, uint16_t size, uint16_t *length);
+void eve_ui_snapshot_end(void);
 
 uint8_t eve_ui_key_check(void);
+void eve_ui_touch_int_init(eve_ui_touch_notify_t notify, eve_ui_touch_wait_t wait);
+uint8_t eve_ui_touch_event(void);
+void eve_ui_touch_wait(void);
+
+uint32_t eve_ui_ramg_arena_alloc(uint32_t size);
+void eve_ui_ramg_arena_reset(void);
+uint32_t eve_ui_ramg_alloc(uint32_t size);
+void eve_ui_ramg_free(uint32_t address);
+uint8_t eve_ui_handle_alloc(void);
+void eve_ui_handle_reserve(uint8_t handle);
+void eve_ui_handle_free(uint8_t handle);
+
+void eve_ui_dlcache_draw(uint8_t id, uint32_t key, eve_ui_dlcache_draw_t draw);
+void eve_ui_dlcache_invalidate(uint8_t id);
 
 /* Platform specific functions. */
 int8_t eve_ui_arch_flash_calib_init(void);
@@ -196,6 +373,7 @@ int8_t eve_ui_arch_flash_calib_write(struct touchscreen_calibration *calib);
 int8_t eve_ui_arch_flash_calib_read(struct touchscreen_calibration *calib);
 void eve_ui_arch_write_cmd_from_flash(const uint8_t __flash__ *ImgData, uint32_t length);
 void eve_ui_arch_write_ram_from_flash(const uint8_t __flash__ *ImgData, uint32_t length, uint32_t dest);
+void eve_ui_arch_yield(void);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,259 @@
+/**
+  @file eve_ui_alloc.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief RAM_G allocation.
+ @details The arena is allocated upwards from the bottom of RAM_G for data
+ kept until the next eve_ui_ramg_arena_reset, such as fonts and images.
+ Regions which can be freed are allocated downwards from RAMG_TOP.
+ Freed regions are kept in a list and reused or returned to the free
+ space between the two.
+ */
+//@{
+#define RAMG_ALIGN 16
+#define RAMG_REGIONS 8
+#define RAMG_ROUND(a) (((a) + (RAMG_ALIGN - 1)) & (~(RAMG_ALIGN - 1)))
+#ifdef FT81X_ENABLE
+// CMD_LOADIMAGE uses the top of RAM_G as working memory for PNG images.
+#define RAMG_TOP (RAM_G + RAM_G_SIZE - EVE_RAM_G_PNG_WORK_SIZE)
+#else
+#define RAMG_TOP (RAM_G + RAM_G_SIZE)
+#endif
+//@}
+
+/**
+ @brief Bitmap handles available for allocation.
+ @details Handle 15 is used by the co-processor for scratch and handles
+ 16 to 31 are the ROM fonts.
+ */
+#define HANDLE_COUNT 15
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Regions allocated downwards from RAMG_TOP.
+ @details Ordered from the highest address down. The last region starts
+ at ramg_heap_bottom.
+ */
+//@{
+static struct ramg_region
+{
+	uint32_t address;
+	uint32_t size;
+	uint8_t used;
+} ramg_regions[RAMG_REGIONS];
+static uint8_t ramg_region_count = 0;
+//@}
+
+static uint32_t ramg_arena_top = RAM_G;
+static uint32_t ramg_heap_bottom = RAMG_TOP;
+
+/**
+ @brief Bitmap handles in use. One bit per handle.
+ */
+static uint16_t handle_used = 0;
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static void ramg_region_remove(uint8_t i)
+{
+	memmove(&ramg_regions[i], &ramg_regions[i + 1],
+			(ramg_region_count - i - 1) * sizeof(struct ramg_region));
+	ramg_region_count--;
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+uint32_t eve_ui_ramg_arena_alloc(uint32_t size)
+{
+	uint32_t address = ramg_arena_top;
+
+	size = RAMG_ROUND(size);
+	if (size > ramg_heap_bottom - ramg_arena_top)
+	{
+		return EVE_RAMG_NONE;
+	}
+	ramg_arena_top += size;
+
+	return address;
+}
+
+void eve_ui_ramg_arena_reset(void)
+{
+	ramg_arena_top = RAM_G;
+}
+
+uint32_t eve_ui_ramg_alloc(uint32_t size)
+{
+	struct ramg_region *region;
+	uint8_t i;
+
+	size = RAMG_ROUND(size);
+	if (size == 0)
+	{
+		return EVE_RAMG_NONE;
+	}
+
+	// Reuse the first free region large enough.
+	for (i = 0; i < ramg_region_count; i++)
+	{
+		region = &ramg_regions[i];
+		if ((!region->used) && (region->size >= size))
+		{
+			if ((region->size > size) && (ramg_region_count < RAMG_REGIONS))
+			{
+				// Split the region and leave the lower part free.
+				memmove(&ramg_regions[i + 2], &ramg_regions[i + 1],
+						(ramg_region_count - i - 1) * sizeof(struct ramg_region));
+				ramg_region_count++;
+				ramg_regions[i + 1].address = region->address;
+				ramg_regions[i + 1].size = region->size - size;
+				ramg_regions[i + 1].used = 0;
+				region->address += region->size - size;
+				region->size = size;
+			}
+			region->used = 1;
+			return region->address;
+		}
+	}
+
+	// Take a new region from the free space above the arena.
+	if ((ramg_region_count == RAMG_REGIONS)
+			|| (size > ramg_heap_bottom - ramg_arena_top))
+	{
+		return EVE_RAMG_NONE;
+	}
+
+	ramg_heap_bottom -= size;
+	region = &ramg_regions[ramg_region_count++];
+	region->address = ramg_heap_bottom;
+	region->size = size;
+	region->used = 1;
+
+	return region->address;
+}
+
+void eve_ui_ramg_free(uint32_t address)
+{
+	uint8_t i;
+
+	for (i = 0; i < ramg_region_count; i++)
+	{
+		if ((ramg_regions[i].used) && (ramg_regions[i].address == address))
+		{
+			break;
+		}
+	}
+	if (i == ramg_region_count)
+	{
+		return;
+	}
+
+	ramg_regions[i].used = 0;
+
+	// Merge with a free region below.
+	if ((i + 1 < ramg_region_count) && (!ramg_regions[i + 1].used))
+	{
+		ramg_regions[i].address = ramg_regions[i + 1].address;
+		ramg_regions[i].size += ramg_regions[i + 1].size;
+		ramg_region_remove(i + 1);
+	}
+	// Merge with a free region above.
+	if ((i > 0) && (!ramg_regions[i - 1].used))
+	{
+		ramg_regions[i - 1].address = ramg_regions[i].address;
+		ramg_regions[i - 1].size += ramg_regions[i].size;
+		ramg_region_remove(i);
+	}
+
+	// Return a free region at the bottom to the free space.
+	if ((ramg_region_count) && (!ramg_regions[ramg_region_count - 1].used))
+	{
+		ramg_heap_bottom += ramg_regions[ramg_region_count - 1].size;
+		ramg_region_count--;
+	}
+}
+
+uint8_t eve_ui_handle_alloc(void)
+{
+	uint8_t handle;
+
+	for (handle = 0; handle < HANDLE_COUNT; handle++)
+	{
+		if (!(handle_used & (1 << handle)))
+		{
+			handle_used |= (1 << handle);
+			return handle;
+		}
+	}
+
+	return EVE_HANDLE_NONE;
+}
+
+void eve_ui_handle_reserve(uint8_t handle)
+{
+	if (handle < HANDLE_COUNT)
+	{
+		handle_used |= (1 << handle);
+	}
+}
+
+void eve_ui_handle_free(uint8_t handle)
+{
+	if (handle < HANDLE_COUNT)
+	{
+		handle_used &= (~(1 << handle));
+	}
+}
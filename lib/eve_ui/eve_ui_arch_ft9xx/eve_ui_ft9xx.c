@@ -51,6 +51,9 @@
 #include <ft900.h>
 #include <ft900_dlog.h>
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 #include "EVE_config.h"
 #include "EVE.h"
 #include "HAL.h"
@@ -142,53 +145,31 @@ int8_t eve_ui_arch_flash_calib_read(struct touchscreen_calibration *calib)
 }
 //@}
 
+/**
+ * @brief Functions used to send data from flash to EVE.
+ * @details Data is sent straight from program memory. The next block is
+ * read from flash while the SPI FIFO sends the current one so loading is
+ * limited by the SPI bus.
+ */
+//@{
 void eve_ui_arch_write_cmd_from_flash(const uint8_t __flash__ *ImgData, uint32_t length)
 {
-	uint32_t offset = 0;
-	uint8_t ramData[512];
-	uint32_t left;
-
-	while (offset < length)
-	{
-		memcpy_flash2dat(ramData, (uint32_t)ImgData, 512);
-
-		if (length - offset < 512)
-		{
-			left = length - offset;
-		}
-		else
-		{
-			left = 512;
-		}
-		EVE_LIB_WriteDataToCMD(ramData, left);
-		offset += left;
-		ImgData += left;
-	};
+	HAL_CmdStreamWriteFlash((uintptr_t)ImgData, (length + 3) & (~3));
 }
 
 void eve_ui_arch_write_ram_from_flash(const uint8_t __flash__ *ImgData, uint32_t length, uint32_t dest)
 {
-	uint32_t offset = 0;
-	uint8_t ramData[512];
-	uint32_t left;
+	HAL_MemWriteFlash(dest, (uintptr_t)ImgData, length);
+}
+//@}
 
-	while (offset < length)
-	{
-		memcpy_flash2dat(ramData, (uint32_t)ImgData, 512);
-
-		if (length - offset < 512)
-		{
-			left = length - offset;
-		}
-		else
-		{
-			left = 512;
-		}
-		EVE_LIB_WriteDataToRAMG(ramData, left, dest);
-		offset += left;
-		ImgData += left;
-		dest += left;
-	};
+/**
+ * @brief Let other tasks run while waiting for the co-processor.
+ * @details Only called from a task.
+ */
+void eve_ui_arch_yield(void)
+{
+	vTaskDelay(1);
 }
 
 /* FUNCTIONS ***********************************************************************/
@@ -0,0 +1,125 @@
+/**
+  @file eve_ui_host.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+// Guard against being used for incorrect CPU type.
+#ifndef __FT32__
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "../eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Key for identifying if touchscreen calibration values are valid.
+ */
+#define VALID_KEY_TOUCHSCREEN 0xd72f91a3
+
+/* GLOBAL VARIABLES ****************************************************************/
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Touchscreen calibration. Kept for the life of the program only.
+ */
+static struct touchscreen_calibration host_calib;
+
+/* MACROS **************************************************************************/
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+/**
+ * @brief Functions used to store calibration data.
+ */
+//@{
+int8_t eve_ui_arch_flash_calib_init(void)
+{
+	memset(&host_calib, 0, sizeof(host_calib));
+	return 0;
+}
+
+int8_t eve_ui_arch_flash_calib_write(struct touchscreen_calibration *calib)
+{
+	calib->key = VALID_KEY_TOUCHSCREEN;
+	memcpy(&host_calib, calib, sizeof(struct touchscreen_calibration));
+
+	return 0;
+}
+
+int8_t eve_ui_arch_flash_calib_read(struct touchscreen_calibration *calib)
+{
+	if (host_calib.key == VALID_KEY_TOUCHSCREEN)
+	{
+		memcpy(calib, &host_calib, sizeof(struct touchscreen_calibration));
+		return 0;
+	}
+	return -2;
+}
+//@}
+
+// Program memory is directly addressable on the host.
+void eve_ui_arch_write_cmd_from_flash(const uint8_t __flash__ *ImgData, uint32_t length)
+{
+	EVE_LIB_WriteDataToCMD(ImgData, length);
+}
+
+void eve_ui_arch_write_ram_from_flash(const uint8_t __flash__ *ImgData, uint32_t length, uint32_t dest)
+{
+	EVE_LIB_WriteDataToRAMG(ImgData, length, dest);
+}
+
+// The simulated co-processor runs when its registers are read.
+void eve_ui_arch_yield(void)
+{
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+#endif /* __FT32__ */
@@ -0,0 +1,55 @@
+/**
+    @file eve_ui_assets.h
+
+    @brief Image asset manifest.
+
+    Generated by Scripts/eve_assets.py from the Images directory.
+    Do not edit.
+**/
+/*
+ * ============================================================================
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ */
+
+#ifndef _EVE_UI_ASSETS_H
+#define _EVE_UI_ASSETS_H
+
+/**
+ @brief Decoded image sizes and offsets from the start of the image area.
+ */
+//@{
+// Bridgetek Logo.jpg
+#define EVE_ASSET_BRIDGETEK_LOGO_WIDTH 147
+#define EVE_ASSET_BRIDGETEK_LOGO_HEIGHT 60
+#define EVE_ASSET_BRIDGETEK_LOGO_OFFSET 0x00000
+// settings.jpg
+#define EVE_ASSET_SETTINGS_WIDTH 45
+#define EVE_ASSET_SETTINGS_HEIGHT 45
+#define EVE_ASSET_SETTINGS_OFFSET 0x044e8
+// cancel.jpg
+#define EVE_ASSET_CANCEL_WIDTH 45
+#define EVE_ASSET_CANCEL_HEIGHT 45
+#define EVE_ASSET_CANCEL_OFFSET 0x054bc
+// tick.jpg
+#define EVE_ASSET_SAVE_WIDTH 45
+#define EVE_ASSET_SAVE_HEIGHT 45
+#define EVE_ASSET_SAVE_OFFSET 0x06490
+// keypad.jpg
+#define EVE_ASSET_KEYPAD_WIDTH 45
+#define EVE_ASSET_KEYPAD_HEIGHT 45
+#define EVE_ASSET_KEYPAD_OFFSET 0x07464
+// keyboard.jpg
+#define EVE_ASSET_KEYBOARD_WIDTH 75
+#define EVE_ASSET_KEYBOARD_HEIGHT 45
+#define EVE_ASSET_KEYBOARD_OFFSET 0x08438
+// refresh.jpg
+#define EVE_ASSET_REFRESH_WIDTH 45
+#define EVE_ASSET_REFRESH_HEIGHT 45
+#define EVE_ASSET_REFRESH_OFFSET 0x09e98
+
+// Total size of the image area.
+#define EVE_ASSET_IMAGES_SIZE 0x0ae6c
+//@}
+
+#endif /* _EVE_UI_ASSETS_H */
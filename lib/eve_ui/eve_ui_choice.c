@@ -125,8 +125,10 @@ static int16_t present_list_main(uint16_t count)
 
 	EVE_DISPLAY();
 	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
+
+	// REG_TOUCH_TAG follows the list on screen. Tags read before the new
+	// list has been swapped in belong to the previous screen.
+	EVE_LIB_AwaitFence(EVE_LIB_EndCoProList());
 
 	// Wait for any presses to be released before waiting for
 	// a new screen press. Can happen with screens that are updated
@@ -134,7 +136,10 @@ static int16_t present_list_main(uint16_t count)
 	// as on other screens.
 	key_pressed = 0;
 
-	while (eve_ui_read_tag(&selection) != 0);
+	while (eve_ui_read_tag(&selection) != 0)
+	{
+		eve_ui_touch_wait();
+	}
 
 	do {
 		if (eve_ui_read_tag(&selection) != 0)
@@ -190,12 +195,15 @@ static int16_t present_list_main(uint16_t count)
 				}
 			}
 		}
+
+		// Block until the touch state changes.
+		eve_ui_touch_wait();
 	} while (1);
 
 	return (selection - 1);
 }
 
-uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list, uint32_t *list_options, uint16_t count)
+static void present_list_items(char **list, uint32_t *list_options, uint16_t count, uint8_t tagged)
 {
 	uint16_t i;
 	uint8_t col;
@@ -210,8 +218,6 @@ uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list,
 		cols = (count / (LIST_ROWS + 1)) + 1;
 	}
 
-	present_list_top(toast);
-
 	// Draw
 	col = 0;
 	row = 0;
@@ -219,23 +225,15 @@ uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list,
 	{
 		if (*label[0] != '\0')
 		{
-			if (opt)
+			if ((opt) && (*opt & EVE_OPTIONS_READ_ONLY))
 			{
-				if (*opt & EVE_OPTIONS_READ_ONLY)
-				{
-					EVE_COLOR(CHOICE_COLOUR_DISABLED);
-					EVE_TAG(0);
-				}
-				else
-				{
-					EVE_COLOR(CHOICE_COLOUR_ENABLED);
-					EVE_TAG(i + 1);
-				}
+				EVE_COLOR(CHOICE_COLOUR_DISABLED);
+				EVE_TAG(0);
 			}
 			else
 			{
 				EVE_COLOR(CHOICE_COLOUR_ENABLED);
-				EVE_TAG(i + 1);
+				EVE_TAG(tagged ? (i + 1) : 0);
 			}
 			EVE_BEGIN(RECTS);
 			EVE_VERTEX2F(LIST_COL(col, cols) * 16, LIST_ROW(row + 1) * 16);
@@ -258,12 +256,35 @@ uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list,
 	}
 
 	EVE_TAG(0);
+}
+
+uint16_t eve_ui_present_options_list(char *toast, uint32_t options, char **list, uint32_t *list_options, uint16_t count)
+{
+	present_list_top(toast);
+
+	present_list_items(list, list_options, count, 1);
 
 	eve_ui_header_bar(options);
 
 	return present_list_main(count);
 }
 
+void eve_ui_present_list_preview(char *toast, uint32_t options, char **list, uint16_t count)
+{
+	// Same layout as eve_ui_present_list but the choices cannot be
+	// selected and there is no wait for a touch. Used to show a list
+	// while it is still being filled in.
+	present_list_top(toast);
+
+	present_list_items(list, NULL, count, 0);
+
+	eve_ui_header_bar(options);
+
+	EVE_DISPLAY();
+	EVE_CMD_SWAP();
+	EVE_LIB_EndCoProList();
+}
+
 uint16_t eve_ui_present_list(char *toast, uint32_t options, char **list, uint16_t count)
 {
 	return eve_ui_present_options_list(toast, options, list, NULL, count);
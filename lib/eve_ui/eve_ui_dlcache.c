@@ -0,0 +1,177 @@
+/**
+  @file eve_ui_dlcache.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Display list cache storage.
+ @details Each entry holds one display list fragment. A fragment can be no
+ larger than the display list memory itself. The entries are allocated
+ from RAM_G when the cache is first used.
+ */
+//@{
+#define DLCACHE_ENTRIES 4
+#define DLCACHE_BLOCK_SIZE (EVE_RAM_G_DLCACHE_SIZE / DLCACHE_ENTRIES)
+//@}
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Cache entries.
+ */
+static struct dlcache_entry
+{
+	uint8_t valid;
+	uint8_t id;
+	uint32_t key;
+	uint32_t length;
+	uint32_t last_used;
+} dlcache[DLCACHE_ENTRIES];
+
+/**
+ @brief Counter used to find the least recently used entry.
+ */
+static uint32_t dlcache_clock = 0;
+
+/**
+ @brief Address of cache entries in RAM_G.
+ */
+static uint32_t dlcache_address = EVE_RAMG_NONE;
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static uint32_t dlcache_dl_offset(void)
+{
+	// Let the coprocessor catch up with the list so far and find where
+	// it will write the next display list entry.
+	EVE_LIB_AwaitFence(EVE_LIB_FlushCoProList());
+
+	return HAL_MemRead32(REG_CMD_DL);
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+void eve_ui_dlcache_draw(uint8_t id, uint32_t key, eve_ui_dlcache_draw_t draw)
+{
+	struct dlcache_entry *entry = NULL;
+	uint32_t start, end;
+	int i;
+
+	if (dlcache_address == EVE_RAMG_NONE)
+	{
+		dlcache_address = eve_ui_ramg_alloc(EVE_RAM_G_DLCACHE_SIZE);
+		if (dlcache_address == EVE_RAMG_NONE)
+		{
+			// No room for the cache so draw every time.
+			draw(key);
+			return;
+		}
+	}
+
+	dlcache_clock++;
+
+	for (i = 0; i < DLCACHE_ENTRIES; i++)
+	{
+		if ((dlcache[i].valid) && (dlcache[i].id == id) && (dlcache[i].key == key))
+		{
+			// Replay the fragment from RAM_G.
+			dlcache[i].last_used = dlcache_clock;
+			EVE_CMD_APPEND(dlcache_address + (i * DLCACHE_BLOCK_SIZE), dlcache[i].length);
+			return;
+		}
+	}
+
+	// Replace an unused entry or else the least recently used.
+	for (i = 0; i < DLCACHE_ENTRIES; i++)
+	{
+		if ((entry == NULL)
+				|| (!dlcache[i].valid)
+				|| ((entry->valid) && (dlcache[i].last_used < entry->last_used)))
+		{
+			entry = &dlcache[i];
+		}
+	}
+	i = entry - dlcache;
+
+	// Draw the fragment into the current display list and then copy the
+	// entries generated to RAM_G.
+	start = dlcache_dl_offset();
+	draw(key);
+	end = dlcache_dl_offset();
+
+	// A fragment too large for an entry is drawn every time.
+	entry->valid = 0;
+	if ((end > start) && (end - start <= DLCACHE_BLOCK_SIZE))
+	{
+		EVE_CMD_MEMCPY(dlcache_address + (i * DLCACHE_BLOCK_SIZE), RAM_DL + start, end - start);
+
+		entry->valid = 1;
+		entry->id = id;
+		entry->key = key;
+		entry->length = end - start;
+		entry->last_used = dlcache_clock;
+	}
+}
+
+void eve_ui_dlcache_invalidate(uint8_t id)
+{
+	int i;
+
+	for (i = 0; i < DLCACHE_ENTRIES; i++)
+	{
+		if ((id == EVE_DLCACHE_ALL) || (dlcache[i].id == id))
+		{
+			dlcache[i].valid = 0;
+		}
+	}
+}
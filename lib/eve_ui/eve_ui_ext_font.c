@@ -43,11 +43,11 @@
 
 #include <stdint.h>
 
-#include <ft900.h>
-
 #include "EVE_config.h"
 #include "EVE.h"
 
+#include "eve_ui.h"
+
 // Size taken from "The expected raw bitmap size is xxxx Bytes" comment.
 #define FONT0_SIZE (6392 + sizeof(EVE_GPU_FONT_HEADER))
 
@@ -0,0 +1,461 @@
+/**
+  @file eve_ui_image.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Image header parser states.
+ @details The header is checked before CMD_LOADIMAGE is sent so that an
+ image the co-processor cannot decode, or which is larger than the image
+ area, is rejected without a co-processor fault.
+ */
+//@{
+#define HEADER_SIGNATURE 0 // First two bytes of the file
+#define HEADER_MARKER 1 // JPEG 0xff before a marker code
+#define HEADER_CODE 2 // JPEG marker code
+#define HEADER_LENGTH 3 // JPEG segment length
+#define HEADER_SKIP 4 // JPEG segment before the frame header
+#define HEADER_FRAME 5 // JPEG frame header
+#define HEADER_PNG 6 // PNG signature and IHDR chunk
+#define HEADER_DONE 7
+//@}
+
+/**
+ @brief Image header fields.
+ @details A baseline JPEG frame header holds the segment length, precision,
+ height and width. A PNG file has the IHDR chunk data from offset 16 with
+ the width, height, bit depth, colour type, compression, filter and
+ interlace method.
+ */
+//@{
+#define JPEG_FRAME_LENGTH 7
+#define PNG_IHDR_OFFSET 16
+#define PNG_IHDR_LENGTH 13
+//@}
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Image being streamed.
+ */
+static struct
+{
+	uint8_t active; // Between eve_ui_image_start and end or abort
+	uint8_t loading; // CMD_LOADIMAGE has been sent
+	uint8_t header; // Header parser state
+	uint8_t count; // Bytes of the current header field
+	uint32_t offset; // Bytes parsed from the start of the file
+	uint32_t skip; // JPEG segment bytes left to skip
+	uint8_t field[PNG_IHDR_LENGTH];
+	uint32_t width;
+	uint32_t height;
+	uint32_t fifo; // Media FIFO in RAM_G
+	uint32_t fence; // End of the co-processor list with CMD_LOADIMAGE
+} image;
+
+/**
+ @brief Decoded image area and bitmap handle.
+ @details Allocated for the first image and kept for the next one.
+ */
+//@{
+static uint32_t image_address = EVE_RAMG_NONE;
+static uint8_t image_handle = EVE_HANDLE_NONE;
+//@}
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static uint32_t image_be16(const uint8_t *p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+static uint32_t image_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int8_t image_header(const uint8_t *data, uint16_t length)
+{
+	uint8_t b;
+
+	while ((length) && (image.header != HEADER_DONE))
+	{
+		if (image.header == HEADER_SKIP)
+		{
+			// Segments such as tables and EXIF data are not needed.
+			if (image.skip > length)
+			{
+				image.skip -= length;
+				image.offset += length;
+				return EVE_IMAGE_OK;
+			}
+			data += image.skip;
+			length -= image.skip;
+			image.offset += image.skip;
+			image.header = HEADER_MARKER;
+			continue;
+		}
+
+		b = *data++;
+		length--;
+		image.offset++;
+
+		switch (image.header)
+		{
+		case HEADER_SIGNATURE:
+			image.field[image.count++] = b;
+			if (image.count < 2)
+			{
+				break;
+			}
+			if ((image.field[0] == 0xff) && (image.field[1] == 0xd8))
+			{
+				image.header = HEADER_MARKER;
+			}
+			else if ((image.field[0] == 0x89) && (image.field[1] == 'P'))
+			{
+				image.header = HEADER_PNG;
+			}
+			else
+			{
+				return EVE_IMAGE_ERROR_FORMAT;
+			}
+			image.count = 0;
+			break;
+
+		case HEADER_MARKER:
+			if (b != 0xff)
+			{
+				return EVE_IMAGE_ERROR_FORMAT;
+			}
+			image.header = HEADER_CODE;
+			break;
+
+		case HEADER_CODE:
+			if ((b == 0xff) || ((b >= 0xd0) && (b <= 0xd7)) || (b == 0x01))
+			{
+				// Fill bytes and markers without a segment.
+				image.header = (b == 0xff) ? HEADER_CODE : HEADER_MARKER;
+			}
+			else if ((b == 0xc0) || (b == 0xc1))
+			{
+				image.header = HEADER_FRAME;
+			}
+			else if ((((b & 0xf0) == 0xc0) && (b != 0xc4) && (b != 0xc8) && (b != 0xcc))
+					|| (b == 0xd9) || (b == 0xda))
+			{
+				// Progressive and other frame types are not decoded by
+				// the co-processor. Image data must follow a frame header.
+				return EVE_IMAGE_ERROR_FORMAT;
+			}
+			else
+			{
+				image.header = HEADER_LENGTH;
+			}
+			image.count = 0;
+			break;
+
+		case HEADER_LENGTH:
+			image.field[image.count++] = b;
+			if (image.count == 2)
+			{
+				image.skip = image_be16(image.field);
+				if (image.skip < 2)
+				{
+					return EVE_IMAGE_ERROR_FORMAT;
+				}
+				// The length includes itself.
+				image.skip -= 2;
+				image.header = (image.skip) ? HEADER_SKIP : HEADER_MARKER;
+			}
+			break;
+
+		case HEADER_FRAME:
+			image.field[image.count++] = b;
+			if (image.count == JPEG_FRAME_LENGTH)
+			{
+				image.height = image_be16(&image.field[3]);
+				image.width = image_be16(&image.field[5]);
+				image.header = HEADER_DONE;
+			}
+			break;
+
+		case HEADER_PNG:
+			if (image.offset > PNG_IHDR_OFFSET)
+			{
+				image.field[image.count++] = b;
+			}
+			if (image.count == PNG_IHDR_LENGTH)
+			{
+				image.width = image_be32(&image.field[0]);
+				image.height = image_be32(&image.field[4]);
+				// Only 8 bit samples without interlace are decoded.
+				if ((image.field[8] != 8) || (image.field[12] != 0))
+				{
+					return EVE_IMAGE_ERROR_FORMAT;
+				}
+				image.header = HEADER_DONE;
+			}
+			break;
+		}
+	}
+
+	if (image.header == HEADER_DONE)
+	{
+		if ((image.width == 0) || (image.height == 0)
+				|| (image.width > EVE_DISP_WIDTH) || (image.height > EVE_DISP_HEIGHT))
+		{
+			return EVE_IMAGE_ERROR_SIZE;
+		}
+	}
+
+	return EVE_IMAGE_OK;
+}
+
+static void image_load(void)
+{
+	uint32_t top = EVE_DISP_HEIGHT / 8;
+	uint32_t y;
+
+	// Centre the image below the header bar if there is room.
+	if (image.height <= EVE_DISP_HEIGHT - top)
+	{
+		y = top + ((EVE_DISP_HEIGHT - top - image.height) / 2);
+	}
+	else
+	{
+		y = (EVE_DISP_HEIGHT - image.height) / 2;
+	}
+
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_DLSTART();
+	EVE_CLEAR_COLOR_RGB(0, 0, 0);
+	EVE_CLEAR(1,1,1);
+	// The header bar may wait for the co-processor so must be drawn before
+	// it is held in CMD_LOADIMAGE.
+	eve_ui_header_bar(EVE_HEADER_LOGO | EVE_HEADER_CANCEL_BUTTON);
+	EVE_TAG(TAG_NO_ACTION);
+	EVE_COLOR_RGB(255, 255, 255);
+	// The co-processor sets the bitmap format and size for this handle in
+	// the display list. A PNG file may decode to one of several formats.
+	EVE_BITMAP_HANDLE(image_handle);
+	EVE_CMD_LOADIMAGE(image_address, OPT_MEDIAFIFO);
+	EVE_BEGIN(BITMAPS);
+	EVE_VERTEX2F(((EVE_DISP_WIDTH - image.width) / 2) * 16, y * 16);
+	EVE_DISPLAY();
+	EVE_CMD_SWAP();
+	image.fence = EVE_LIB_EndCoProList();
+
+	image.loading = 1;
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int8_t eve_ui_image_start(void)
+{
+	if (image.active)
+	{
+		eve_ui_image_abort();
+	}
+
+	// Large enough for the display in any format decoded from a file.
+	if (image_address == EVE_RAMG_NONE)
+	{
+		image_address = eve_ui_ramg_alloc(EVE_DISP_WIDTH * EVE_DISP_HEIGHT * 2);
+	}
+	if (image_handle == EVE_HANDLE_NONE)
+	{
+		image_handle = eve_ui_handle_alloc();
+	}
+	if ((image_address == EVE_RAMG_NONE) || (image_handle == EVE_HANDLE_NONE))
+	{
+		return EVE_IMAGE_ERROR_MEMORY;
+	}
+
+	memset(&image, 0, sizeof(image));
+	image.fifo = eve_ui_ramg_alloc(EVE_RAM_G_MEDIAFIFO_SIZE);
+	if (image.fifo == EVE_RAMG_NONE)
+	{
+		return EVE_IMAGE_ERROR_MEMORY;
+	}
+	image.active = 1;
+
+	EVE_LIB_MediaFifoStart(image.fifo, EVE_RAM_G_MEDIAFIFO_SIZE);
+
+	return EVE_IMAGE_OK;
+}
+
+int8_t eve_ui_image_write(const uint8_t *data, uint16_t length)
+{
+	uint32_t written;
+	int8_t err;
+
+	if (!image.active)
+	{
+		return EVE_IMAGE_ERROR_DECODE;
+	}
+
+	if (!image.loading)
+	{
+		err = image_header(data, length);
+		if (err != EVE_IMAGE_OK)
+		{
+			eve_ui_image_abort();
+			return err;
+		}
+
+		// The start of the file is held in the media FIFO until the header
+		// has been checked.
+		written = EVE_LIB_MediaFifoWrite(data, length);
+		data += written;
+		length -= written;
+
+		if (image.header == HEADER_DONE)
+		{
+			image_load();
+		}
+		else if (length)
+		{
+			eve_ui_image_abort();
+			return EVE_IMAGE_ERROR_HEADER;
+		}
+	}
+
+	// The co-processor decodes the data as it is written.
+	while (length)
+	{
+		written = EVE_LIB_MediaFifoWrite(data, length);
+		data += written;
+		length -= written;
+
+		if ((written == 0) && (EVE_LIB_CheckFence(image.fence)))
+		{
+			// The image is complete or the co-processor has faulted. The
+			// rest of the data is not needed.
+			break;
+		}
+	}
+
+	return EVE_IMAGE_OK;
+}
+
+int8_t eve_ui_image_end(void)
+{
+	uint8_t status;
+
+	if (!image.active)
+	{
+		return EVE_IMAGE_ERROR_DECODE;
+	}
+
+	if (!image.loading)
+	{
+		// The data ended before the image header.
+		eve_ui_image_abort();
+		return EVE_IMAGE_ERROR_FORMAT;
+	}
+
+	EVE_LIB_MediaFifoFlush();
+
+	status = EVE_LIB_AwaitFenceFrames(image.fence, EVE_COPRO_WAIT_FRAMES);
+
+	if (status != 1)
+	{
+		eve_ui_image_abort();
+		return EVE_IMAGE_ERROR_DECODE;
+	}
+
+	eve_ui_ramg_free(image.fifo);
+	image.active = 0;
+
+	return EVE_IMAGE_OK;
+}
+
+void eve_ui_image_abort(void)
+{
+	if (!image.active)
+	{
+		return;
+	}
+
+	if ((image.loading) && (HAL_CheckCmdFence(image.fence) != 1))
+	{
+		// The co-processor is waiting for data which will not arrive or
+		// has faulted. The display list with the image is never shown.
+		eve_ui_copro_reset();
+	}
+
+	eve_ui_ramg_free(image.fifo);
+	image.active = 0;
+}
+
+void eve_ui_image_release(void)
+{
+	if (image.active)
+	{
+		eve_ui_image_abort();
+	}
+
+	// The decoded image area is most of RAM_G. It is allocated again for
+	// the next image.
+	if (image_address != EVE_RAMG_NONE)
+	{
+		eve_ui_ramg_free(image_address);
+		image_address = EVE_RAMG_NONE;
+	}
+	if (image_handle != EVE_HANDLE_NONE)
+	{
+		eve_ui_handle_free(image_handle);
+		image_handle = EVE_HANDLE_NONE;
+	}
+}
@@ -42,7 +42,11 @@
  */
 
 #include <stdint.h>
-#include <ft900.h>
+
+#include "eve_ui.h"
+
+// Compressed images in eve_ui_images_z.c are used by default.
+#ifdef EVE_UI_ASSETS_JPEG
 
 #define IMG_BRIDGETEK_LOGO_SIZE (0xE18)
 
@@ -1037,3 +1041,4 @@ const uint8_t __flash__ img_keyboard[IMG_KEYBOARD_SIZE]  __attribute__((aligned(
 	    /*A40:*/ 0xD9,
 };
 
+#endif // EVE_UI_ASSETS_JPEG
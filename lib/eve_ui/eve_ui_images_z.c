@@ -0,0 +1,755 @@
+/**
+    @file eve_ui_images_z.c
+
+    @brief Compressed RGB565 images for CMD_INFLATE.
+
+    Generated by Scripts/eve_assets.py from the Images directory.
+    Do not edit.
+**/
+/*
+ * ============================================================================
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ */
+
+#include <stdint.h>
+
+#include "eve_ui.h"
+
+// JPEG images in eve_ui_images.c are used instead.
+#ifndef EVE_UI_ASSETS_JPEG
+
+// Bridgetek Logo.jpg
+#define IMG_BRIDGETEK_LOGO_Z_SIZE (0x147F)
+
+const uint32_t img_bridgetek_logo_z_size = IMG_BRIDGETEK_LOGO_Z_SIZE;
+const uint8_t __flash__ img_bridgetek_logo_z[]; // forward declaration.
+const uint8_t __flash__ *img_bridgetek_logo_z_data = img_bridgetek_logo_z;
+
+const uint8_t __flash__ img_bridgetek_logo_z[IMG_BRIDGETEK_LOGO_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0xED, 0x5A, 0x6D, 0x4C, 0x5B, 0x57, 0x9A, 0xFE, 0x51, 0x46, 0x1B, 0xA9, 0xD5, 0x0E,
+    /*010:*/ 0x15, 0x09, 0x98, 0x5E, 0xB2, 0x80, 0x2E, 0x95, 0x6A, 0xDD, 0xAC, 0x54, 0x74, 0x49, 0x03, 0xBD,
+    /*020:*/ 0x4E, 0x50, 0x63, 0x90, 0x26, 0x40, 0x47, 0x85, 0x38, 0x5F, 0xC4, 0x4C, 0xA4, 0x06, 0xA4, 0xED,
+    /*030:*/ 0x40, 0x46, 0xEA, 0x80, 0x69, 0x12, 0xC7, 0xE1, 0x47, 0x20, 0xD2, 0x66, 0x30, 0xD2, 0x66, 0x6C,
+    /*040:*/ 0x93, 0x66, 0xC0, 0x48, 0x9D, 0xE2, 0x95, 0x5A, 0x41, 0x35, 0x09, 0xF7, 0x9A, 0x24, 0xB5, 0x2D,
+    /*050:*/ 0x6D, 0xA6, 0xA0, 0xB6, 0xBB, 0x78, 0x77, 0x02, 0xBE, 0x24, 0xB4, 0x3E, 0x3F, 0x12, 0xF5, 0x4A,
+    /*060:*/ 0xDB, 0xD1, 0xDE, 0x48, 0x0D, 0x5C, 0x5A, 0x3E, 0xEE, 0xBE, 0xEF, 0xB9, 0x06, 0x6C, 0x30, 0x49,
+    /*070:*/ 0x47, 0xFB, 0x67, 0xA5, 0xFA, 0x58, 0x21, 0xF6, 0xFD, 0x3A, 0xE7, 0x3C, 0xE7, 0x79, 0x9F, 0xE7,
+    /*080:*/ 0x3D, 0xE7, 0x5C, 0x5D, 0xCF, 0x94, 0x4C, 0xC9, 0x94, 0x4C, 0xC9, 0x94, 0x4C, 0xC9, 0x94, 0x4C,
+    /*090:*/ 0xC9, 0x94, 0xFF, 0x5B, 0x21, 0x49, 0x7F, 0xB7, 0x1E, 0xCF, 0xA0, 0xB3, 0x51, 0x76, 0x0E, 0x87,
+    /*0A0:*/ 0xB5, 0xAD, 0xB8, 0xE0, 0xB1, 0x4C, 0x59, 0x43, 0x2B, 0xBB, 0xBB, 0xA4, 0x78, 0xCF, 0xE9, 0x64,
+    /*0B0:*/ 0x9C, 0xD2, 0x61, 0xF6, 0x53, 0x2D, 0x06, 0x57, 0x4C, 0x13, 0xD5, 0xE6, 0x92, 0xE2, 0x87, 0xA6,
+    /*0C0:*/ 0x6F, 0x1B, 0xF1, 0xF7, 0x52, 0x3C, 0xEA, 0x8C, 0x3A, 0x33, 0x31, 0x67, 0xF4, 0x3E, 0x59, 0x8D,
+    /*0D0:*/ 0xDE, 0xED, 0xCD, 0x02, 0x94, 0x54, 0xC0, 0x66, 0x2E, 0xFE, 0xCA, 0xC1, 0x92, 0x62, 0xA5, 0x22,
+    /*0E0:*/ 0xA3, 0x4D, 0xC9, 0x68, 0x5D, 0xF5, 0x94, 0x4F, 0x20, 0x12, 0xF5, 0xBD, 0xD9, 0xDD, 0x44, 0xBF,
+    /*0F0:*/ 0x1D, 0x53, 0x2A, 0xB2, 0x8A, 0xB3, 0x8A, 0xDF, 0xA9, 0xC9, 0xE0, 0xB3, 0x56, 0xFC, 0xDA, 0xAB,
+    /*100:*/ 0xDD, 0x0F, 0x4D, 0x97, 0x4B, 0xE7, 0xE2, 0xC6, 0xEF, 0xA5, 0xF8, 0x24, 0xC5, 0xA8, 0xDA, 0x2C,
+    /*110:*/ 0x87, 0x32, 0x5C, 0x5A, 0xEB, 0x79, 0x81, 0x52, 0x52, 0x5C, 0x42, 0x51, 0x29, 0x50, 0x74, 0xE0,
+    /*120:*/ 0xD1, 0x8E, 0x83, 0x77, 0x4D, 0x25, 0xC5, 0x2D, 0x49, 0x18, 0xFD, 0x14, 0x51, 0x21, 0x5B, 0x8E,
+    /*130:*/ 0x9E, 0x98, 0x6A, 0x31, 0x97, 0x98, 0x51, 0xAB, 0x6F, 0xC7, 0x02, 0x15, 0x25, 0xC5, 0x8F, 0x8A,
+    /*140:*/ 0xAA, 0xCD, 0xDA, 0x67, 0x4F, 0x61, 0x90, 0x06, 0x1F, 0x95, 0x7E, 0xB4, 0xA4, 0x0F, 0x94, 0xB8,
+    /*150:*/ 0xBE, 0x0A, 0x9F, 0x6D, 0xF8, 0xA7, 0xD1, 0xEB, 0xB7, 0x7B, 0x1E, 0x7D, 0x02, 0x49, 0x3E, 0x96,
+    /*160:*/ 0xEE, 0x29, 0xEB, 0xF5, 0x6C, 0xBE, 0x6E, 0xD3, 0xD1, 0xA4, 0x63, 0xAB, 0xA9, 0x08, 0x24, 0xB5,
+    /*170:*/ 0x96, 0x6C, 0x9B, 0x13, 0x92, 0xA4, 0xFC, 0x87, 0xE8, 0xAA, 0xF3, 0xAA, 0x87, 0x50, 0x7F, 0x2B,
+    /*180:*/ 0xED, 0x45, 0x8C, 0x26, 0x01, 0xA3, 0xBB, 0xA6, 0x6A, 0x73, 0xF9, 0x04, 0x9E, 0xB7, 0x28, 0xFE,
+    /*190:*/ 0xB4, 0x6D, 0xFD, 0x61, 0x78, 0xC9, 0x5B, 0xE0, 0x9B, 0x73, 0xCF, 0xB9, 0x19, 0xDF, 0x03, 0xEF,
+    /*1A0:*/ 0x03, 0x2F, 0xE3, 0x0F, 0x4B, 0x84, 0xE8, 0x1A, 0x59, 0x6F, 0xEB, 0x96, 0x5A, 0x35, 0x26, 0x50,
+    /*1B0:*/ 0xE0, 0x9F, 0x73, 0x3F, 0x18, 0xDC, 0xBF, 0x05, 0xBC, 0x93, 0xE1, 0xA5, 0xE1, 0x39, 0x2F, 0x13,
+    /*1C0:*/ 0x58, 0x99, 0xD8, 0x8C, 0x61, 0xFA, 0x3C, 0x0D, 0xC7, 0x21, 0x9E, 0x8A, 0xEF, 0x53, 0xCA, 0xEA,
+    /*1D0:*/ 0xA6, 0xDF, 0xA1, 0x89, 0xA5, 0xC1, 0x3B, 0xDE, 0xB9, 0xC1, 0x93, 0xE1, 0x54, 0xDC, 0xB7, 0x3A,
+    /*1E0:*/ 0xDA, 0x9A, 0x1E, 0x45, 0x9D, 0x59, 0x10, 0x6B, 0x06, 0x4E, 0xA8, 0x47, 0x97, 0x4B, 0x31, 0xF2,
+    /*1F0:*/ 0x2E, 0x97, 0x2E, 0x52, 0x1E, 0xED, 0x1C, 0x7E, 0xE5, 0x60, 0x5A, 0x4E, 0xAA, 0x4F, 0x6A, 0x45,
+    /*200:*/ 0xDE, 0xCB, 0xC5, 0xB8, 0x05, 0x3E, 0x06, 0x7F, 0x65, 0xF8, 0xE7, 0xE1, 0x5E, 0xB3, 0x55, 0x4E,
+    /*210:*/ 0xAE, 0xE1, 0xB4, 0x81, 0xCD, 0xFA, 0x57, 0x35, 0xB7, 0xCA, 0x54, 0xA6, 0x71, 0xF3, 0xC2, 0x40,
+    /*220:*/ 0x78, 0x13, 0x37, 0x14, 0x5F, 0xF3, 0x8C, 0x20, 0xF2, 0xD3, 0xD6, 0x3B, 0x6E, 0x5D, 0x31, 0xFA,
+    /*230:*/ 0xB5, 0xB9, 0xA5, 0xE4, 0xA9, 0xFD, 0xDE, 0xDA, 0xDB, 0xD5, 0xF4, 0xD7, 0xE0, 0x79, 0x75, 0xCE,
+    /*240:*/ 0x3B, 0x6F, 0x95, 0xF8, 0x05, 0xAB, 0xD4, 0x01, 0xCC, 0xDE, 0x96, 0x85, 0x24, 0x51, 0x67, 0x18,
+    /*250:*/ 0x7A, 0xF4, 0x65, 0xE3, 0x5D, 0xD3, 0xCB, 0xE6, 0xAC, 0x62, 0xD3, 0x84, 0x11, 0x6B, 0xF8, 0xBD,
+    /*260:*/ 0xC5, 0xAC, 0x85, 0xF0, 0x2A, 0xC7, 0x48, 0x56, 0xF1, 0x95, 0x06, 0x92, 0x2E, 0x72, 0xD4, 0x79,
+    /*270:*/ 0x41, 0x62, 0x83, 0xF0, 0xF1, 0x31, 0x41, 0x66, 0x96, 0xE9, 0xCF, 0x99, 0x85, 0xFF, 0x35, 0x7E,
+    /*280:*/ 0xB6, 0x99, 0xD6, 0x9B, 0x2E, 0x7A, 0x00, 0xD9, 0x7D, 0x55, 0x32, 0x2B, 0xB3, 0x22, 0x3F, 0x20,
+    /*290:*/ 0x6D, 0x46, 0x29, 0x68, 0x8F, 0x71, 0x12, 0x1B, 0xE3, 0x77, 0xF7, 0x25, 0x47, 0x64, 0x9C, 0xF6,
+    /*2A0:*/ 0x36, 0x9E, 0x06, 0xA7, 0xD5, 0x34, 0xFD, 0x5A, 0x99, 0x3A, 0x15, 0xAD, 0x9C, 0x44, 0x36, 0x92,
+    /*2B0:*/ 0x94, 0xFB, 0xB6, 0xA2, 0xF4, 0x95, 0x3B, 0xC6, 0xFB, 0x98, 0x18, 0xAB, 0x35, 0xA7, 0x8F, 0x7F,
+    /*2C0:*/ 0x92, 0xC6, 0xDD, 0xBE, 0x6D, 0x7C, 0x68, 0x7A, 0x37, 0x11, 0x6B, 0x98, 0x2B, 0x55, 0x53, 0x8C,
+    /*2D0:*/ 0x74, 0xFD, 0xC8, 0x08, 0xBA, 0xDC, 0x95, 0x86, 0x74, 0x9C, 0x27, 0xCA, 0xBE, 0x3A, 0x8D, 0x75,
+    /*2E0:*/ 0xE4, 0x04, 0x59, 0x89, 0xB2, 0xA9, 0x13, 0x90, 0x1A, 0x87, 0x7F, 0x22, 0x17, 0x21, 0x6B, 0x3A,
+    /*2F0:*/ 0x41, 0xD6, 0xC7, 0x73, 0x8D, 0x3A, 0x8B, 0x17, 0x8E, 0xD9, 0xCF, 0xDA, 0x82, 0x6D, 0x03, 0x13,
+    /*300:*/ 0x29, 0x5C, 0x03, 0xAD, 0x1A, 0x6F, 0x93, 0xF8, 0x7E, 0x78, 0xD6, 0x8A, 0x7B, 0x7D, 0x74, 0xB5,
+    /*310:*/ 0x1F, 0x37, 0x8B, 0x8C, 0x24, 0xAE, 0x3E, 0x20, 0xDF, 0xA8, 0xF5, 0x70, 0x22, 0x77, 0xD3, 0x7A,
+    /*320:*/ 0x6A, 0x32, 0xF9, 0xDE, 0x0D, 0xB4, 0x56, 0xD7, 0x51, 0x5A, 0x76, 0x6B, 0xBC, 0xCC, 0xC8, 0x2C,
+    /*330:*/ 0x8C, 0xA9, 0xA2, 0x6B, 0x46, 0xF4, 0xC6, 0xB7, 0x68, 0xB6, 0xC1, 0xA5, 0xBE, 0xF6, 0x2F, 0x1B,
+    /*340:*/ 0x5D, 0xD0, 0xA6, 0xFD, 0xAA, 0x43, 0x04, 0x8C, 0x30, 0xD6, 0xCC, 0x7F, 0x34, 0xB5, 0x98, 0x4F,
+    /*350:*/ 0x4C, 0xE1, 0x15, 0x7B, 0x01, 0xA3, 0x47, 0x45, 0x88, 0xD2, 0xE6, 0xD8, 0xC1, 0x68, 0x88, 0x90,
+    /*360:*/ 0x7D, 0x55, 0xFD, 0xC0, 0x1E, 0x89, 0xBD, 0x6F, 0x27, 0x93, 0x91, 0xC8, 0x03, 0x3B, 0x70, 0x2A,
+    /*370:*/ 0x67, 0x3C, 0x47, 0xE3, 0x2B, 0xA3, 0x46, 0xAB, 0x23, 0x6A, 0xEA, 0x78, 0x1A, 0xAA, 0x49, 0x14,
+    /*380:*/ 0x1D, 0x3F, 0x5A, 0x12, 0x42, 0x14, 0xA5, 0x60, 0x9B, 0xC4, 0xC9, 0x6C, 0x8C, 0x03, 0x2E, 0x69,
+    /*390:*/ 0x9B, 0xD5, 0x7C, 0x1B, 0xFD, 0x36, 0xBC, 0x63, 0xFD, 0xC9, 0x43, 0xD1, 0x69, 0x41, 0xE3, 0xFA,
+    /*3A0:*/ 0x19, 0x1B, 0x3B, 0x34, 0x89, 0x0C, 0x21, 0x5A, 0xFA, 0x48, 0xA4, 0x5C, 0xEA, 0x89, 0x71, 0x41,
+    /*3B0:*/ 0x40, 0xE9, 0xFB, 0x04, 0x4A, 0xDB, 0xB3, 0x29, 0xEA, 0x04, 0xEF, 0x37, 0xBF, 0x70, 0xBA, 0x49,
+    /*3C0:*/ 0xC5, 0x63, 0xD7, 0x63, 0x81, 0xD2, 0x97, 0xCD, 0x77, 0x4D, 0x81, 0x52, 0x13, 0xCD, 0x2C, 0x1D,
+    /*3D0:*/ 0x22, 0xAA, 0xD3, 0x1A, 0x4A, 0x5B, 0x5D, 0x47, 0x57, 0x8E, 0x57, 0x2D, 0xB2, 0xE3, 0x8C, 0xC4,
+    /*3E0:*/ 0xF9, 0xB0, 0x26, 0xE5, 0x7C, 0x4F, 0x8C, 0x0F, 0x02, 0x4E, 0x31, 0x03, 0xA5, 0xE4, 0x1E, 0xAA,
+    /*3F0:*/ 0x89, 0xCF, 0x86, 0xC7, 0xA9, 0x49, 0x3D, 0x45, 0xCC, 0x54, 0x5D, 0x99, 0x6D, 0x83, 0xF8, 0x65,
+    /*400:*/ 0x62, 0xDC, 0xB2, 0x97, 0x68, 0x09, 0x64, 0xD7, 0xFD, 0x93, 0xAC, 0xB9, 0xA8, 0x81, 0x39, 0x3E,
+    /*410:*/ 0xC1, 0xB8, 0xCB, 0x38, 0x0F, 0x6C, 0xC2, 0xF6, 0x75, 0x4D, 0xEE, 0xB2, 0xF8, 0x18, 0x88, 0x23,
+    /*420:*/ 0x3E, 0x32, 0x99, 0x14, 0x47, 0xDA, 0x7A, 0xFD, 0xEA, 0x7A, 0x8B, 0xB4, 0x65, 0xAF, 0xC8, 0xFB,
+    /*430:*/ 0x58, 0x99, 0x0B, 0x36, 0x6F, 0x38, 0x34, 0x51, 0xD3, 0x8D, 0x08, 0x9D, 0x89, 0x00, 0x0A, 0x8E,
+    /*440:*/ 0x11, 0x02, 0x73, 0x91, 0xC9, 0x8A, 0x47, 0x45, 0x8F, 0x8A, 0x5A, 0x4A, 0xD1, 0xFB, 0x31, 0xD6,
+    /*450:*/ 0xAA, 0xCD, 0x78, 0x0E, 0x3F, 0x1F, 0x35, 0xA4, 0x5D, 0x4D, 0x51, 0x16, 0x78, 0x88, 0xB1, 0x9C,
+    /*460:*/ 0x18, 0xA2, 0x04, 0x2D, 0x38, 0xE7, 0x86, 0x88, 0x61, 0x82, 0x6C, 0x07, 0x77, 0x8A, 0xA2, 0x74,
+    /*470:*/ 0x52, 0x5A, 0x1A, 0xB4, 0x04, 0x4E, 0x8E, 0x0E, 0x11, 0x4B, 0xC0, 0xE4, 0xA8, 0x70, 0xEC, 0xF7,
+    /*480:*/ 0x63, 0x7B, 0x9C, 0xE1, 0x97, 0x02, 0x4B, 0x83, 0xC2, 0x68, 0x93, 0x62, 0xB4, 0xDF, 0x1E, 0x28,
+    /*490:*/ 0x77, 0x94, 0xBB, 0x2C, 0x7E, 0x12, 0x7D, 0xFD, 0xCC, 0x22, 0x45, 0x69, 0xC9, 0x6B, 0x44, 0xC6,
+    /*4A0:*/ 0xCA, 0xC4, 0x75, 0xF7, 0x62, 0xC7, 0x6D, 0xF7, 0xA9, 0x68, 0x44, 0x6E, 0x02, 0x67, 0x64, 0x02,
+    /*4B0:*/ 0x5F, 0x4F, 0x25, 0xFA, 0x40, 0xC8, 0xE8, 0xED, 0x9E, 0x0A, 0xC7, 0xF7, 0x1D, 0xF9, 0x8E, 0xDB,
+    /*4C0:*/ 0x3D, 0xA1, 0x51, 0x03, 0x91, 0x53, 0x64, 0x77, 0x9F, 0x97, 0x95, 0x58, 0x1F, 0xEB, 0x65, 0x3F,
+    /*4D0:*/ 0x85, 0x27, 0xAE, 0x4C, 0xD1, 0xE3, 0x6A, 0x3C, 0x7C, 0xDB, 0x5D, 0xE1, 0xC8, 0x3F, 0x53, 0xE1,
+    /*4E0:*/ 0x98, 0x73, 0xBB, 0x46, 0x91, 0x39, 0x84, 0xA2, 0x24, 0xF1, 0x9D, 0x30, 0xC2, 0xB3, 0x6D, 0xBA,
+    /*4F0:*/ 0x52, 0x19, 0x65, 0x46, 0xE1, 0xF9, 0xFE, 0xC1, 0x70, 0x7A, 0x85, 0xBA, 0x37, 0x50, 0x62, 0xCE,
+    /*500:*/ 0xEE, 0xD6, 0x81, 0x47, 0x46, 0x9E, 0xDD, 0x42, 0xBD, 0x9F, 0xE8, 0x9D, 0x22, 0x72, 0xE8, 0x51,
+    /*510:*/ 0x02, 0xA5, 0x8D, 0x88, 0x4B, 0x45, 0x69, 0x9F, 0x05, 0x51, 0x0A, 0xB2, 0xE3, 0x76, 0xB8, 0x45,
+    /*520:*/ 0x69, 0x74, 0x01, 0x87, 0xA1, 0x85, 0x63, 0x02, 0xE8, 0x92, 0x4A, 0xC8, 0xBD, 0xDA, 0x05, 0x01,
+    /*530:*/ 0x5C, 0x8F, 0xBF, 0x6F, 0x8F, 0xF1, 0x18, 0x4B, 0x0B, 0x42, 0x58, 0xD2, 0x95, 0x5D, 0x36, 0x49,
+    /*540:*/ 0x88, 0xF1, 0x63, 0x56, 0x41, 0xC2, 0x1E, 0x9C, 0x70, 0x2D, 0x08, 0x0E, 0xD6, 0xCB, 0x2F, 0x08,
+    /*550:*/ 0x67, 0x6D, 0x67, 0xAB, 0xEE, 0xB3, 0xD7, 0x72, 0xD6, 0x22, 0x6E, 0x35, 0x3C, 0x26, 0xC8, 0x9C,
+    /*560:*/ 0x06, 0x6A, 0x3E, 0xC3, 0x2F, 0xC1, 0x13, 0x44, 0x7E, 0xBE, 0x56, 0xBB, 0x80, 0x23, 0x3E, 0x44,
+    /*570:*/ 0x3A, 0x6D, 0xF3, 0xFC, 0x0C, 0x38, 0xAA, 0x97, 0x97, 0x78, 0x19, 0x70, 0xB9, 0x65, 0xEB, 0x02,
+    /*580:*/ 0xEE, 0x84, 0xC2, 0xF3, 0x82, 0x83, 0xF1, 0x01, 0x4A, 0x3E, 0x66, 0x81, 0x9F, 0x17, 0xCA, 0x5D,
+    /*590:*/ 0xBA, 0x42, 0x48, 0x7F, 0xF3, 0x82, 0x20, 0x71, 0x1A, 0x87, 0xEA, 0xA9, 0xF1, 0x22, 0x77, 0x0C,
+    /*5A0:*/ 0x3D, 0x18, 0xCA, 0xB2, 0x5B, 0xE2, 0xC6, 0x99, 0x20, 0x45, 0x69, 0xB1, 0x63, 0x8C, 0xFA, 0xDD,
+    /*5B0:*/ 0xFB, 0xDE, 0x54, 0x25, 0xDC, 0x60, 0x45, 0xC5, 0x14, 0xA1, 0x18, 0x3D, 0x2A, 0xBA, 0x0B, 0xB3,
+    /*5C0:*/ 0x13, 0x74, 0xB9, 0xB0, 0x86, 0xBE, 0x86, 0x3C, 0x7A, 0x68, 0x32, 0xD8, 0xB4, 0x19, 0xA5, 0x84,
+    /*5D0:*/ 0x22, 0x83, 0x5F, 0xCD, 0x32, 0xD7, 0x72, 0xF2, 0x4B, 0xDE, 0xAF, 0xEB, 0x0A, 0x56, 0x06, 0x41,
+    /*5E0:*/ 0x93, 0xD9, 0x4E, 0x66, 0x5E, 0xF0, 0x35, 0x13, 0x8C, 0x05, 0xF2, 0x9A, 0xCD, 0x07, 0xF1, 0x18,
+    /*5F0:*/ 0x04, 0x56, 0xFB, 0xD8, 0x45, 0x76, 0x16, 0xF4, 0x0B, 0x58, 0xA2, 0x1C, 0xAF, 0x9B, 0x05, 0xC6,
+    /*600:*/ 0xCC, 0xF0, 0x83, 0x80, 0x12, 0x91, 0x77, 0xD5, 0x61, 0x94, 0x05, 0x39, 0x1F, 0x17, 0x13, 0x44,
+    /*610:*/ 0xD0, 0x89, 0x6B, 0x8C, 0xCC, 0x1D, 0x40, 0x8F, 0x53, 0xCF, 0x03, 0xE6, 0xE3, 0xA0, 0x72, 0x90,
+    /*620:*/ 0x5F, 0xF0, 0x32, 0x78, 0x9F, 0xC4, 0xCE, 0xF0, 0x8B, 0xE0, 0xDA, 0x44, 0x39, 0xEF, 0x9E, 0xE1,
+    /*630:*/ 0x25, 0x70, 0x27, 0xE0, 0x0D, 0xEF, 0xE3, 0x66, 0x99, 0xD9, 0x1C, 0x99, 0xFD, 0xA1, 0x19, 0x51,
+    /*640:*/ 0xEA, 0x00, 0x34, 0x7C, 0x2C, 0x3A, 0xA5, 0xC8, 0xC6, 0x84, 0x3F, 0x00, 0x4A, 0xB7, 0xDD, 0x0B,
+    /*650:*/ 0x42, 0x27, 0xDB, 0x9F, 0x13, 0xCC, 0x59, 0x84, 0x33, 0x50, 0x13, 0x70, 0x35, 0xD8, 0x8C, 0x91,
+    /*660:*/ 0xB5, 0xE2, 0x96, 0xF1, 0x5E, 0x36, 0xFF, 0x0C, 0x89, 0xCE, 0x00, 0x8E, 0x80, 0x22, 0x5F, 0x39,
+    /*670:*/ 0xB9, 0xBD, 0xDB, 0xA1, 0xAF, 0x21, 0x1E, 0x97, 0x4B, 0x2B, 0xA6, 0xD6, 0x7C, 0xAD, 0xC4, 0x8C,
+    /*680:*/ 0x18, 0x95, 0x24, 0xD8, 0x94, 0x8A, 0x12, 0x62, 0xB4, 0x82, 0xFA, 0x00, 0xB9, 0x4F, 0x90, 0xC5,
+    /*690:*/ 0x0C, 0xC0, 0xC1, 0x78, 0xB1, 0xCD, 0xD0, 0x0E, 0xA8, 0xAD, 0xB9, 0x4B, 0xA6, 0x31, 0xAE, 0xEC,
+    /*6A0:*/ 0xB5, 0x23, 0x02, 0x12, 0x7B, 0xCE, 0xB2, 0x64, 0x73, 0xC0, 0xF8, 0xE6, 0x59, 0x6E, 0x79, 0x75,
+    /*6B0:*/ 0xF5, 0x6C, 0x1D, 0xE6, 0x0B, 0x22, 0xA2, 0xA4, 0x0E, 0x45, 0xC7, 0x78, 0x8D, 0x0D, 0xC2, 0xFD,
+    /*6C0:*/ 0x79, 0x96, 0xC5, 0xE6, 0x76, 0xDE, 0xC1, 0x62, 0x96, 0xF0, 0x0F, 0x97, 0x11, 0xA5, 0xBD, 0x36,
+    /*6D0:*/ 0x54, 0xD7, 0x20, 0x33, 0x6E, 0x1B, 0x70, 0x69, 0x82, 0x0F, 0xF0, 0x8F, 0xF1, 0x8D, 0x2E, 0x54,
+    /*6E0:*/ 0xA3, 0xF9, 0xC3, 0x0B, 0x80, 0x92, 0xC8, 0x3A, 0xCF, 0x14, 0x06, 0x07, 0x5C, 0xFD, 0x70, 0x7F,
+    /*6F0:*/ 0x10, 0x32, 0x0B, 0x5D, 0x3D, 0x20, 0x7F, 0xDF, 0xEC, 0xE0, 0x70, 0x4C, 0x3A, 0x80, 0x5D, 0xDF,
+    /*700:*/ 0xB7, 0x35, 0xF9, 0x75, 0x72, 0xC4, 0x2E, 0x02, 0xC6, 0x32, 0xC7, 0x34, 0x55, 0x06, 0x57, 0x7A,
+    /*710:*/ 0xBC, 0x2C, 0xEA, 0xF5, 0x61, 0x0E, 0x46, 0x51, 0xDB, 0x7D, 0x59, 0x63, 0x67, 0x73, 0x82, 0xCC,
+    /*720:*/ 0x80, 0xA3, 0xCB, 0x27, 0x72, 0x58, 0xEF, 0xB8, 0x2D, 0x39, 0x73, 0x4A, 0xD5, 0x98, 0x3B, 0xF1,
+    /*730:*/ 0x40, 0xA9, 0x11, 0x6B, 0x26, 0xEA, 0xCD, 0x65, 0xC3, 0xA8, 0xD9, 0x77, 0x4D, 0x0F, 0x4D, 0x78,
+    /*740:*/ 0xB4, 0xA4, 0x78, 0x3B, 0x2E, 0xAD, 0x26, 0x50, 0x42, 0x97, 0x93, 0x91, 0x2F, 0xA0, 0x9A, 0x1A,
+    /*750:*/ 0x77, 0xAE, 0x8A, 0x04, 0xA8, 0x7F, 0x69, 0x11, 0xE5, 0xBB, 0xC3, 0xC0, 0x73, 0x40, 0x49, 0xF7,
+    /*760:*/ 0xEB, 0x51, 0x11, 0x46, 0x6B, 0x5E, 0xB8, 0x35, 0xA8, 0x2B, 0x67, 0xAB, 0x10, 0xA5, 0x19, 0x0E,
+    /*770:*/ 0x14, 0x42, 0x8D, 0x44, 0x77, 0x41, 0xF6, 0xD4, 0x9F, 0x53, 0x5E, 0x16, 0xF1, 0xE9, 0xF2, 0x6C,
+    /*780:*/ 0xB3, 0x08, 0x4F, 0x59, 0x64, 0xBF, 0x76, 0x20, 0x4A, 0xAF, 0x51, 0x96, 0xC9, 0x5C, 0x24, 0xA0,
+    /*790:*/ 0x93, 0x4F, 0x1D, 0x79, 0x65, 0xA0, 0xC9, 0x1C, 0xA0, 0x44, 0x22, 0xB2, 0xC7, 0x8A, 0xEA, 0x93,
+    /*7A0:*/ 0x5B, 0x16, 0xF1, 0x43, 0x44, 0x49, 0x32, 0xC4, 0xDC, 0x38, 0x3B, 0x23, 0xC0, 0xD8, 0xA8, 0x43,
+    /*7B0:*/ 0x93, 0xC0, 0x2E, 0x18, 0x2F, 0x11, 0xD5, 0x1B, 0x34, 0x40, 0x27, 0x4F, 0x6A, 0xBD, 0xDC, 0x11,
+    /*7C0:*/ 0xB8, 0xB3, 0xCB, 0xA7, 0x93, 0xC2, 0x20, 0x75, 0x17, 0xD6, 0x83, 0xBA, 0xA9, 0x2E, 0xBB, 0x16,
+    /*7D0:*/ 0x38, 0x60, 0x21, 0x23, 0x34, 0xDD, 0xB7, 0x69, 0x74, 0x34, 0x31, 0xD2, 0x57, 0xB7, 0xC9, 0x99,
+    /*7E0:*/ 0x7E, 0xDD, 0x60, 0x60, 0x74, 0x3D, 0x86, 0x47, 0x8F, 0xD0, 0x58, 0x2B, 0x31, 0x3F, 0x2A, 0x32,
+    /*7F0:*/ 0xB0, 0xBA, 0x6B, 0x7A, 0xAA, 0x2E, 0x55, 0x41, 0x36, 0xC9, 0x76, 0xE6, 0x48, 0xD0, 0x32, 0x1F,
+    /*800:*/ 0xAB, 0x71, 0x0E, 0xA8, 0xCB, 0xCB, 0x39, 0x5D, 0xD4, 0x85, 0x15, 0x47, 0xB3, 0x83, 0xC5, 0x2C,
+    /*810:*/ 0xB3, 0xF2, 0x5F, 0x75, 0xF9, 0xB7, 0xC2, 0x18, 0x3F, 0x6F, 0x05, 0x2E, 0x91, 0xB3, 0x88, 0x0B,
+    /*820:*/ 0x23, 0xF1, 0x61, 0xD0, 0xD1, 0x48, 0x74, 0x4C, 0x30, 0x54, 0x64, 0x08, 0x7A, 0x31, 0xDE, 0x3C,
+    /*830:*/ 0x0B, 0x31, 0xA6, 0xB1, 0x2B, 0x3D, 0xA8, 0x58, 0xEF, 0xD5, 0x01, 0x8F, 0xE0, 0x79, 0x7E, 0x40,
+    /*840:*/ 0xDD, 0xE9, 0x00, 0x9E, 0x82, 0xD2, 0x56, 0xA0, 0xD2, 0x44, 0x17, 0xAC, 0xE0, 0x4C, 0x4C, 0x07,
+    /*850:*/ 0x0B, 0xF7, 0x28, 0x17, 0x03, 0x22, 0x2F, 0xB1, 0x9D, 0xAC, 0x28, 0x74, 0x11, 0x44, 0x1D, 0x70,
+    /*860:*/ 0x00, 0x04, 0x0F, 0x73, 0x34, 0x13, 0x80, 0xA8, 0xCF, 0xAD, 0x03, 0x26, 0x61, 0x0E, 0xD6, 0xA3,
+    /*870:*/ 0xCB, 0x85, 0x41, 0x89, 0xB2, 0x73, 0x06, 0x23, 0x4B, 0x5D, 0xEE, 0x59, 0xE0, 0x24, 0x46, 0x66,
+    /*880:*/ 0xCA, 0xCB, 0xF2, 0xCA, 0xFA, 0x61, 0x84, 0x73, 0xAB, 0x2A, 0x23, 0xE9, 0xF2, 0x79, 0x44, 0xEA,
+    /*890:*/ 0xDC, 0x14, 0xAE, 0x4B, 0xB6, 0x98, 0xCF, 0x4D, 0xE1, 0xAF, 0x27, 0x1F, 0x1A, 0x18, 0x19, 0x7A,
+    /*8A0:*/ 0x84, 0x08, 0x55, 0x9B, 0xB7, 0x45, 0x49, 0xD3, 0xC9, 0x3E, 0x8B, 0xCC, 0x74, 0x82, 0x72, 0x1C,
+    /*8B0:*/ 0xAB, 0x1B, 0x0A, 0x56, 0x7E, 0xF2, 0x7E, 0x1D, 0xE4, 0xE1, 0xCC, 0x22, 0x64, 0x75, 0xD8, 0x0A,
+    /*8C0:*/ 0x42, 0xF6, 0xDA, 0x31, 0x66, 0xBC, 0x1C, 0x8E, 0xF9, 0xA0, 0xE4, 0x0A, 0xD8, 0x03, 0x90, 0x21,
+    /*8D0:*/ 0x28, 0x67, 0xEB, 0xC6, 0x29, 0x4A, 0xFE, 0x51, 0x1A, 0x71, 0x56, 0x54, 0x04, 0x91, 0xEF, 0x32,
+    /*8E0:*/ 0x50, 0x62, 0xD1, 0x0B, 0xF6, 0xFB, 0x10, 0xA5, 0x63, 0xA0, 0x5F, 0xB3, 0xA0, 0xC5, 0x71, 0x50,
+    /*8F0:*/ 0xFC, 0x3F, 0xB8, 0x8C, 0x4C, 0xCA, 0xE4, 0x40, 0x64, 0xE7, 0xAD, 0x9D, 0x34, 0x72, 0xF2, 0x2C,
+    /*900:*/ 0x47, 0x6D, 0xD3, 0xC0, 0x15, 0xD0, 0x1B, 0xAE, 0x83, 0xC7, 0x28, 0xAA, 0x8C, 0xCC, 0x08, 0xE8,
+    /*910:*/ 0xEE, 0xED, 0x86, 0xC2, 0x40, 0x8E, 0xB1, 0x50, 0x2B, 0xE3, 0x28, 0x72, 0x0B, 0xC2, 0x51, 0xDB,
+    /*920:*/ 0xBC, 0xD5, 0xC1, 0x04, 0xD7, 0x3C, 0x58, 0x2D, 0xE8, 0x9B, 0xE7, 0x31, 0xBF, 0x83, 0x7F, 0xD0,
+    /*930:*/ 0x9E, 0x18, 0xD7, 0x6F, 0xC7, 0x79, 0xD1, 0x6A, 0xDA, 0x88, 0x3B, 0x37, 0x85, 0x58, 0x28, 0x15,
+    /*940:*/ 0x17, 0x69, 0xCE, 0x51, 0xDF, 0x8B, 0x31, 0x06, 0xD1, 0x56, 0x54, 0x6D, 0x36, 0x58, 0xF4, 0x14,
+    /*950:*/ 0x2E, 0x25, 0x50, 0x02, 0x8D, 0xE1, 0x82, 0x6D, 0xA8, 0x17, 0xFB, 0x7D, 0x10, 0x61, 0x39, 0xFD,
+    /*960:*/ 0x90, 0x55, 0x36, 0x05, 0x30, 0x9F, 0xD9, 0x69, 0xC3, 0x38, 0x04, 0x67, 0x1B, 0x4D, 0xCA, 0x9D,
+    /*970:*/ 0x40, 0xBD, 0x65, 0x16, 0x75, 0x89, 0x46, 0x9C, 0x3C, 0x6F, 0x05, 0xAD, 0x05, 0x24, 0x87, 0x40,
+    /*980:*/ 0x43, 0x66, 0x9B, 0xB1, 0xBD, 0x12, 0x57, 0x90, 0x84, 0x92, 0xC4, 0x5D, 0x00, 0xFD, 0x72, 0xBA,
+    /*990:*/ 0x90, 0x05, 0x8B, 0xDC, 0x09, 0xE4, 0x92, 0x3C, 0x6D, 0xED, 0xE7, 0xAE, 0x31, 0xEF, 0x3D, 0xBF,
+    /*9A0:*/ 0xC8, 0xEC, 0x2B, 0x83, 0xD9, 0x23, 0xDC, 0x33, 0xCB, 0xDB, 0xF8, 0x03, 0xA0, 0x86, 0x5D, 0x93,
+    /*9B0:*/ 0x33, 0x56, 0xF4, 0x38, 0x0F, 0x7F, 0x2A, 0x81, 0x12, 0xBA, 0x03, 0x44, 0x38, 0x1C, 0x2B, 0xB7,
+    /*9C0:*/ 0xA0, 0x03, 0x43, 0xAE, 0x0D, 0x6C, 0x2F, 0xC4, 0x88, 0x03, 0x0F, 0x40, 0xB6, 0x62, 0x9D, 0xE3,
+    /*9D0:*/ 0x80, 0xF3, 0x51, 0x1B, 0x3C, 0x5B, 0x4B, 0xBF, 0x86, 0x12, 0xD6, 0x76, 0x1C, 0x44, 0xC7, 0x37,
+    /*9E0:*/ 0xD7, 0x58, 0xA8, 0x72, 0x65, 0x77, 0x23, 0x9B, 0x10, 0x23, 0x8C, 0x38, 0x43, 0x9B, 0xB2, 0x8A,
+    /*9F0:*/ 0x7F, 0xBD, 0x6D, 0x26, 0x20, 0xD3, 0xB1, 0x91, 0xDB, 0x10, 0x95, 0x26, 0x3F, 0x7A, 0x6B, 0xC2,
+    /*A00:*/ 0xCB, 0xE0, 0xF7, 0x11, 0x3B, 0xEA, 0xC7, 0x18, 0x0F, 0x6C, 0xD0, 0xD6, 0xF3, 0x6F, 0xE8, 0x7D,
+    /*A10:*/ 0x70, 0xDD, 0xE3, 0x86, 0x64, 0xE0, 0x12, 0x5C, 0x23, 0xF2, 0x88, 0x92, 0xDC, 0x8C, 0x91, 0x14,
+    /*A20:*/ 0xE3, 0xE7, 0xDC, 0x78, 0xDD, 0x71, 0x1A, 0x71, 0x74, 0xBE, 0x07, 0x28, 0x69, 0x7C, 0x3F, 0x70,
+    /*A30:*/ 0xF6, 0x75, 0x03, 0xA5, 0xDA, 0x20, 0x0F, 0x7C, 0xCC, 0xB9, 0x6E, 0xB9, 0x55, 0x77, 0xDF, 0xF6,
+    /*A40:*/ 0xA0, 0xEE, 0x81, 0xED, 0xB6, 0x7D, 0xB6, 0x6D, 0x48, 0xC1, 0xDC, 0x7B, 0x4C, 0xC0, 0xE7, 0xB5,
+    /*A50:*/ 0xF3, 0x5D, 0x46, 0x56, 0x09, 0x28, 0x05, 0x51, 0x1B, 0x99, 0xE3, 0x96, 0x5B, 0xB6, 0xFB, 0xF6,
+    /*A60:*/ 0xFB, 0xF6, 0xF7, 0x6D, 0xB7, 0xEB, 0x7E, 0x68, 0x3E, 0x05, 0x88, 0xE2, 0x3C, 0x0E, 0x6B, 0x38,
+    /*A70:*/ 0x6F, 0x31, 0x95, 0xF5, 0x23, 0xB2, 0x42, 0x7A, 0x87, 0x33, 0x8A, 0x14, 0xAA, 0x36, 0xA3, 0x93,
+    /*A80:*/ 0x1D, 0xAA, 0x29, 0xA0, 0x33, 0x71, 0xF5, 0x12, 0x44, 0x5C, 0x91, 0x91, 0x01, 0x3C, 0x2C, 0x32,
+    /*A90:*/ 0xB8, 0xB4, 0x1D, 0x4A, 0xB9, 0x16, 0xCC, 0x56, 0x80, 0x4B, 0x34, 0x5F, 0x72, 0x05, 0x66, 0x90,
+    /*AA0:*/ 0xC3, 0x06, 0x1B, 0x68, 0x26, 0x80, 0x5C, 0x12, 0x05, 0xFF, 0x68, 0xD2, 0x9C, 0x57, 0x39, 0x56,
+    /*AB0:*/ 0x47, 0x75, 0x89, 0x1B, 0xA4, 0x5C, 0x42, 0x94, 0x64, 0x88, 0x17, 0x54, 0x1F, 0xE4, 0xD2, 0x38,
+    /*AC0:*/ 0x13, 0x13, 0xE6, 0xBC, 0xC8, 0xD4, 0x7D, 0x55, 0xF7, 0x11, 0x25, 0x6E, 0x70, 0x8D, 0x4B, 0xAC,
+    /*AD0:*/ 0xC6, 0xE7, 0x3B, 0x10, 0x25, 0x23, 0x4A, 0x63, 0x18, 0xA5, 0x98, 0x7F, 0xCB, 0x54, 0xA7, 0x55,
+    /*AE0:*/ 0xE4, 0x01, 0x7A, 0x26, 0xCC, 0x97, 0x01, 0xA5, 0x04, 0x97, 0xC8, 0x5E, 0x3A, 0x26, 0x22, 0xB7,
+    /*AF0:*/ 0xBF, 0xCF, 0xC8, 0xEF, 0x51, 0xD1, 0x0D, 0x77, 0xA1, 0x28, 0xC1, 0x39, 0x7B, 0x53, 0x41, 0xD3,
+    /*B00:*/ 0x2C, 0x44, 0xED, 0x18, 0x7F, 0xBD, 0x67, 0xAB, 0xC7, 0x6D, 0x14, 0xC7, 0x48, 0x35, 0xF5, 0xFD,
+    /*B10:*/ 0x43, 0xC0, 0x27, 0x3C, 0xF7, 0x6A, 0x2F, 0xCD, 0x03, 0x8A, 0x90, 0x4F, 0x55, 0xE6, 0x74, 0x28,
+    /*B20:*/ 0x19, 0x2B, 0x5A, 0x44, 0xC9, 0x05, 0x25, 0x96, 0x80, 0x3B, 0xDF, 0xDB, 0xB1, 0xAD, 0x77, 0x7A,
+    /*B30:*/ 0x50, 0x49, 0xB1, 0x4D, 0x16, 0xC8, 0xB2, 0x89, 0x7C, 0x14, 0xF2, 0x25, 0x9C, 0xFD, 0x03, 0x02,
+    /*B40:*/ 0x1B, 0x63, 0x04, 0xBA, 0x84, 0x6D, 0x8B, 0xF1, 0x80, 0x92, 0x32, 0x04, 0xD1, 0x13, 0x64, 0x8F,
+    /*B50:*/ 0xE6, 0xCC, 0xF0, 0xE8, 0x64, 0xF7, 0x9B, 0x31, 0x93, 0x92, 0x78, 0x40, 0x09, 0xE6, 0x0A, 0xE7,
+    /*B60:*/ 0xEA, 0xC6, 0x01, 0xA5, 0x18, 0x87, 0x99, 0xE8, 0x05, 0xC7, 0x22, 0xE4, 0xC9, 0x31, 0xAA, 0xDE,
+    /*B70:*/ 0x43, 0xD1, 0x5C, 0x74, 0x3F, 0xE8, 0x15, 0x22, 0x4B, 0x48, 0x41, 0x5F, 0x41, 0x1F, 0xE3, 0xBF,
+    /*B80:*/ 0x3F, 0x12, 0xC1, 0x7C, 0x13, 0x32, 0x9F, 0x20, 0xEB, 0x60, 0x3C, 0xFC, 0x9A, 0x7A, 0xEF, 0xA2,
+    /*B90:*/ 0xF1, 0x9D, 0x67, 0x59, 0xEE, 0x81, 0x6B, 0x95, 0x97, 0x02, 0x0F, 0x06, 0x0B, 0xFC, 0xB7, 0xBC,
+    /*BA0:*/ 0x30, 0xBF, 0xD4, 0x8C, 0x35, 0x01, 0x99, 0xBD, 0x70, 0x66, 0xA8, 0x4F, 0xC2, 0x0C, 0x8B, 0xDB,
+    /*BB0:*/ 0x5B, 0x17, 0x91, 0xD3, 0xCF, 0xAF, 0xC3, 0x9A, 0x4B, 0x8D, 0xE8, 0x3E, 0x11, 0xF5, 0xE8, 0x21,
+    /*BC0:*/ 0xC6, 0x1D, 0xE5, 0xD3, 0xAB, 0xDD, 0x25, 0xC5, 0x1F, 0x64, 0xE3, 0xFA, 0xEE, 0x07, 0xD9, 0x59,
+    /*BD0:*/ 0xF9, 0x59, 0xF9, 0x9B, 0x75, 0x29, 0xB4, 0xEE, 0x71, 0x32, 0xD5, 0xD1, 0x72, 0x4B, 0xDC, 0x15,
+    /*BE0:*/ 0x72, 0xE5, 0x55, 0x21, 0x17, 0x50, 0x89, 0xEC, 0x54, 0x97, 0xE6, 0x6B, 0xD1, 0xE5, 0x17, 0x78,
+    /*BF0:*/ 0x92, 0xCC, 0x25, 0xE8, 0x7D, 0x90, 0xE6, 0x4B, 0x21, 0x88, 0xB8, 0x08, 0x19, 0xB3, 0xF6, 0x33,
+    /*C00:*/ 0xF9, 0x05, 0x12, 0x1B, 0x72, 0x14, 0x7E, 0x82, 0xB1, 0x88, 0x4A, 0x74, 0x00, 0x99, 0xA8, 0x18,
+    /*C10:*/ 0x19, 0xAB, 0xCC, 0xFD, 0x0A, 0x72, 0x84, 0xA6, 0x96, 0x71, 0x38, 0x93, 0x57, 0x46, 0xD5, 0x1B,
+    /*C20:*/ 0xB4, 0x2C, 0x48, 0x9F, 0x0B, 0x67, 0x08, 0x09, 0xE4, 0x95, 0xC9, 0xA0, 0x43, 0xF5, 0x56, 0x8C,
+    /*C30:*/ 0xB8, 0xAE, 0xA8, 0x17, 0xE7, 0x48, 0x38, 0x8F, 0x0B, 0x10, 0x82, 0x4F, 0x79, 0xCD, 0x26, 0x71,
+    /*C40:*/ 0x38, 0x6B, 0x8A, 0x3B, 0xD0, 0xE3, 0xC6, 0x04, 0x0F, 0xEF, 0xE1, 0x6F, 0xD6, 0x2E, 0xC7, 0x20,
+    /*C50:*/ 0x5F, 0xF2, 0x41, 0xAE, 0x0B, 0x6D, 0xCF, 0x6F, 0xD1, 0xA3, 0x12, 0x7F, 0x14, 0xBE, 0xE5, 0x96,
+    /*C60:*/ 0xE9, 0x69, 0x66, 0x28, 0xD8, 0x6E, 0x39, 0x14, 0x28, 0xF5, 0x89, 0x44, 0xD7, 0x42, 0x0F, 0x4D,
+    /*C70:*/ 0x8F, 0x8A, 0x5E, 0x36, 0xEF, 0x38, 0x68, 0x21, 0x78, 0xE5, 0xBB, 0xBD, 0xD5, 0xE6, 0x0F, 0xB2,
+    /*C80:*/ 0xAB, 0x01, 0xA7, 0x12, 0x44, 0xA9, 0x26, 0x1D, 0xC2, 0x84, 0x60, 0xBE, 0x84, 0xE3, 0x41, 0xF3,
+    /*C90:*/ 0x5D, 0xC8, 0x09, 0x31, 0xC3, 0x94, 0xB8, 0x06, 0x1E, 0xF3, 0xCA, 0x08, 0x8C, 0xA3, 0xA9, 0x0C,
+    /*CA0:*/ 0x3D, 0x6E, 0x28, 0x90, 0xC4, 0x64, 0xC8, 0x97, 0x16, 0x59, 0xEC, 0x97, 0x7D, 0x14, 0xAF, 0x99,
+    /*CB0:*/ 0xB6, 0x2E, 0x72, 0xEF, 0x3D, 0x8F, 0x1E, 0xD3, 0xC1, 0x89, 0xBC, 0x83, 0xE9, 0x84, 0x0C, 0x09,
+    /*CC0:*/ 0x5C, 0x1B, 0xA2, 0xE3, 0x9A, 0x6D, 0x11, 0x14, 0xC5, 0xC7, 0x78, 0x84, 0x19, 0xEB, 0x11, 0x16,
+    /*CD0:*/ 0x75, 0x48, 0x62, 0x4F, 0x60, 0x4C, 0xA8, 0x3E, 0xD0, 0xAF, 0x59, 0xA8, 0x73, 0x8C, 0x1B, 0xB7,
+    /*CE0:*/ 0xE5, 0x5A, 0xFA, 0x73, 0x80, 0x71, 0xFC, 0x93, 0x5A, 0xCC, 0xA7, 0x87, 0x64, 0x51, 0x08, 0x82,
+    /*CF0:*/ 0x36, 0x76, 0x32, 0x88, 0x45, 0x38, 0xAC, 0x2B, 0xFD, 0x6D, 0x31, 0xBE, 0x1F, 0x22, 0x3C, 0xBF,
+    /*D00:*/ 0xEC, 0x44, 0x95, 0xC9, 0x02, 0x39, 0x3E, 0xC4, 0xED, 0x34, 0x22, 0xAA, 0xAE, 0xB8, 0x4D, 0x65,
+    /*D10:*/ 0xEF, 0x41, 0xD6, 0x5E, 0x01, 0xF8, 0xDD, 0x82, 0xBA, 0x30, 0x9F, 0x01, 0x77, 0x48, 0xC3, 0x25,
+    /*D20:*/ 0x9F, 0x88, 0xB1, 0x56, 0x52, 0x2C, 0x87, 0x88, 0x2E, 0x89, 0x2D, 0xA5, 0x7F, 0x84, 0x18, 0x3B,
+    /*D30:*/ 0x74, 0xD0, 0x4E, 0xF0, 0x8A, 0xFA, 0xDE, 0x47, 0x09, 0x55, 0x4A, 0x45, 0x29, 0x69, 0xBD, 0x9B,
+    /*D40:*/ 0xEC, 0xAB, 0x42, 0xAD, 0x44, 0xFE, 0xC3, 0x5F, 0x60, 0x2D, 0x68, 0x37, 0xE4, 0x77, 0x15, 0x2E,
+    /*D50:*/ 0xE3, 0xFC, 0x4E, 0x1B, 0xF4, 0x9C, 0x9B, 0x11, 0x52, 0xB9, 0x04, 0x39, 0x16, 0x5C, 0x3B, 0x2D,
+    /*D60:*/ 0xA0, 0x7A, 0xEB, 0x4A, 0x10, 0x7B, 0x4C, 0xFD, 0xD9, 0xCB, 0xE5, 0x82, 0x0B, 0x89, 0x9C, 0x26,
+    /*D70:*/ 0x7C, 0x85, 0xF9, 0x92, 0x36, 0x07, 0x73, 0x76, 0xF4, 0xA4, 0x19, 0x5E, 0x14, 0x64, 0xAA, 0x20,
+    /*D80:*/ 0x31, 0xF4, 0x38, 0xC0, 0xC2, 0x3E, 0x3A, 0x03, 0xF1, 0xE7, 0x63, 0xF3, 0xCA, 0x44, 0x4E, 0xE2,
+    /*D90:*/ 0x70, 0x86, 0xBC, 0x80, 0x75, 0x52, 0xB5, 0xEE, 0xB7, 0x83, 0x03, 0xB0, 0xF8, 0xB4, 0x99, 0x5A,
+    /*DA0:*/ 0xFF, 0x28, 0xCC, 0x8A, 0x25, 0xB8, 0x9B, 0x43, 0x8E, 0x03, 0xE6, 0xE8, 0x86, 0xD0, 0xD2, 0x97,
+    /*DB0:*/ 0x5A, 0x70, 0x14, 0xBE, 0x72, 0x63, 0x06, 0x0A, 0xDA, 0xD4, 0xAC, 0x93, 0xCA, 0x3E, 0x8D, 0x5F,
+    /*DC0:*/ 0x84, 0x7C, 0x6F, 0xDA, 0x1A, 0x21, 0x5B, 0x77, 0x72, 0xF7, 0x9C, 0x46, 0x1C, 0x26, 0x2B, 0xCE,
+    /*DD0:*/ 0xC5, 0x0C, 0x1D, 0xC7, 0xFC, 0xE8, 0xE5, 0xE2, 0x1D, 0xAF, 0x37, 0xA9, 0xC6, 0x9E, 0x5C, 0x89,
+    /*DE0:*/ 0x39, 0x31, 0xDB, 0xAD, 0x49, 0xB3, 0x3E, 0xAB, 0xE1, 0x4C, 0x72, 0x5A, 0x98, 0xB7, 0xCE, 0x08,
+    /*DF0:*/ 0xB9, 0x55, 0xF3, 0xD6, 0x69, 0xEB, 0xAE, 0xAA, 0x3C, 0xCB, 0x59, 0xDB, 0x57, 0xEE, 0xC4, 0xCA,
+    /*E00:*/ 0x8E, 0xE6, 0x68, 0x7B, 0x52, 0xBB, 0xAB, 0xEE, 0xC9, 0xE1, 0x01, 0x29, 0x69, 0x84, 0xD4, 0xD9,
+    /*E10:*/ 0xB6, 0xDC, 0xAA, 0x69, 0x6B, 0x8E, 0xFD, 0x24, 0xB2, 0x5B, 0x2B, 0x9C, 0xBC, 0x66, 0x93, 0x78,
+    /*E20:*/ 0x2F, 0xCC, 0x5B, 0xBF, 0x76, 0xAD, 0xB8, 0xA7, 0xAD, 0x4F, 0x6A, 0xC7, 0xAC, 0x8C, 0x9F, 0xAE,
+    /*E30:*/ 0x85, 0x10, 0xA7, 0x2B, 0xCF, 0xE2, 0x85, 0x96, 0xAF, 0xB8, 0x07, 0x1D, 0x90, 0x13, 0x41, 0x8F,
+    /*E40:*/ 0x60, 0x1E, 0x47, 0x33, 0x0A, 0x57, 0x60, 0xDC, 0xEE, 0x01, 0xF4, 0xDA, 0x61, 0x2E, 0xED, 0xE5,
+    /*E50:*/ 0x8E, 0x55, 0xDD, 0xE9, 0x41, 0x45, 0xA1, 0x2B, 0x55, 0xE1, 0xF7, 0xEC, 0x5E, 0x98, 0xD3, 0x76,
+    /*E60:*/ 0xF0, 0x57, 0xAD, 0x10, 0xD3, 0xC0, 0xBC, 0x8B, 0x81, 0x6B, 0x76, 0x5A, 0x03, 0x20, 0xEA, 0xE5,
+    /*E70:*/ 0xF2, 0x2C, 0x03, 0x0E, 0x12, 0xC5, 0x16, 0x16, 0x04, 0x6E, 0x5A, 0x8F, 0xDA, 0xEE, 0xD5, 0xE6,
+    /*E80:*/ 0x01, 0x73, 0x4F, 0x41, 0x06, 0x31, 0x2F, 0x4C, 0x0B, 0xF7, 0x0E, 0x7F, 0x1D, 0xDE, 0xBA, 0xF6,
+    /*E90:*/ 0x1D, 0xD6, 0x3E, 0x6A, 0x98, 0xAC, 0xB8, 0x43, 0x6D, 0x1A, 0xD7, 0xDD, 0xE4, 0xD0, 0xC3, 0xA2,
+    /*EA0:*/ 0x47, 0x45, 0x3F, 0x33, 0x9B, 0x6B, 0x96, 0xBF, 0xD1, 0x29, 0x4E, 0xC6, 0x3C, 0x6E, 0x1B, 0x8F,
+    /*EB0:*/ 0x83, 0xD9, 0x39, 0x51, 0x22, 0x04, 0xE7, 0xB6, 0x84, 0x7E, 0x52, 0x57, 0x70, 0x22, 0x0A, 0xAA,
+    /*EC0:*/ 0x6B, 0x44, 0x49, 0x8D, 0xD3, 0x88, 0x12, 0x51, 0x88, 0x1A, 0x51, 0x37, 0x56, 0x3C, 0x2B, 0xA3,
+    /*ED0:*/ 0x85, 0x93, 0x38, 0xBF, 0xA0, 0x4E, 0x05, 0x67, 0x13, 0xF3, 0x04, 0x8D, 0xFA, 0x17, 0x75, 0xB0,
+    /*EE0:*/ 0x4F, 0x7B, 0x50, 0x5D, 0x34, 0x8E, 0x32, 0x26, 0x71, 0x0E, 0xEE, 0x98, 0x28, 0x9C, 0x2C, 0x9C,
+    /*EF0:*/ 0x1C, 0x8A, 0x02, 0x42, 0x74, 0x4D, 0x2F, 0xD1, 0x41, 0x0D, 0xD7, 0x74, 0x0B, 0x23, 0x07, 0xE4,
+    /*F00:*/ 0xB5, 0xD1, 0x44, 0x2F, 0x2D, 0x8C, 0xC0, 0x67, 0x12, 0xB2, 0xC9, 0xF5, 0xF5, 0x3F, 0xA2, 0x0D,
+    /*F10:*/ 0x41, 0x2B, 0x22, 0x89, 0xB5, 0x25, 0x6C, 0x13, 0x49, 0x69, 0x57, 0x32, 0x9B, 0xFC, 0x9A, 0x81,
+    /*F20:*/ 0x47, 0xD4, 0x59, 0x6D, 0x3E, 0x32, 0x82, 0x38, 0x65, 0x99, 0x7F, 0x66, 0xFE, 0x73, 0xD1, 0x8E,
+    /*F30:*/ 0x9A, 0xDD, 0x2A, 0xA1, 0x71, 0x97, 0xDE, 0xE3, 0xF4, 0xB4, 0x7B, 0x39, 0x3F, 0x7E, 0x67, 0x93,
+    /*F40:*/ 0xA4, 0xAC, 0xF2, 0xD2, 0x76, 0xAF, 0xAF, 0x25, 0x1A, 0xEB, 0x6C, 0xA1, 0x09, 0xED, 0x42, 0x85,
+    /*F50:*/ 0xC3, 0xE4, 0x80, 0xCC, 0x87, 0x9C, 0x3C, 0x43, 0x33, 0x29, 0xCE, 0x94, 0xAC, 0x1B, 0x5A, 0xCA,
+    /*F60:*/ 0xDA, 0xBA, 0x96, 0xB4, 0x56, 0xB1, 0x7E, 0x74, 0x55, 0xFF, 0xDA, 0x70, 0x63, 0x75, 0xFD, 0x1A,
+    /*F70:*/ 0x6D, 0x63, 0x65, 0x97, 0x24, 0xBC, 0x3A, 0xFE, 0x23, 0xF7, 0xE7, 0x46, 0xDB, 0x8D, 0xC8, 0x32,
+    /*F80:*/ 0xF8, 0x94, 0x65, 0xC6, 0xD5, 0xB8, 0x57, 0x6A, 0x9A, 0x54, 0x83, 0x4F, 0xD5, 0xE6, 0x1D, 0x35,
+    /*F90:*/ 0x24, 0xED, 0xFE, 0x4E, 0x78, 0x83, 0x97, 0xDA, 0xF6, 0x3B, 0x3C, 0xAB, 0x7F, 0x13, 0x8E, 0x89,
+    /*FA0:*/ 0xA7, 0xAB, 0x05, 0xFE, 0x19, 0x6B, 0x8C, 0x8F, 0x71, 0x79, 0x65, 0xCC, 0x91, 0x7E, 0xE6, 0x1A,
+    /*FB0:*/ 0x83, 0x6B, 0x28, 0x77, 0xBC, 0x74, 0xB5, 0x41, 0x4B, 0xF3, 0xB6, 0x95, 0x96, 0xBC, 0x67, 0x40,
+    /*FC0:*/ 0xB4, 0xF4, 0x3B, 0x4F, 0xAB, 0x4F, 0x7D, 0x47, 0xE2, 0x59, 0x3B, 0xDF, 0x1F, 0xD1, 0x19, 0x6F,
+    /*FD0:*/ 0xD4, 0x69, 0xEC, 0xBA, 0x01, 0x4E, 0x30, 0xB3, 0xCB, 0xCA, 0xDF, 0xF1, 0xBA, 0x5D, 0x31, 0x78,
+    /*FE0:*/ 0x86, 0x28, 0x25, 0xF6, 0xD8, 0x20, 0x1A, 0x36, 0x42, 0xF7, 0x2F, 0x03, 0x6F, 0xF5, 0x62, 0x2E,
+    /*FF0:*/ 0xDA, 0xA4, 0xFC, 0xBE, 0x77, 0xDA, 0x03, 0xCE, 0xA1, 0x2F, 0xC5, 0xA5, 0x10, 0xA2, 0x57, 0x36,
+    /*1000:*/ 0xF2, 0x6A, 0xEF, 0x6D, 0x83, 0x14, 0x9F, 0x4D, 0x5D, 0xBA, 0x1E, 0x33, 0xF2, 0xB2, 0x30, 0x75,
+    /*1010:*/ 0x0C, 0xD3, 0x44, 0xF9, 0x04, 0x64, 0x37, 0xFA, 0x6E, 0xF9, 0x71, 0x3B, 0xF2, 0x37, 0xED, 0xEC,
+    /*1020:*/ 0x47, 0x3D, 0x35, 0xE9, 0xB1, 0x82, 0x3A, 0xB3, 0xB8, 0x62, 0x34, 0x8B, 0x73, 0x0B, 0x98, 0x8B,
+    /*1030:*/ 0x15, 0x1A, 0xB9, 0xA2, 0xBE, 0x1C, 0x2F, 0xED, 0xAE, 0xEF, 0xC5, 0xF5, 0x7A, 0x2D, 0x54, 0xDF,
+    /*1040:*/ 0x6B, 0x9A, 0xC2, 0xE7, 0xDE, 0xF3, 0x64, 0x5F, 0xC0, 0x78, 0x39, 0x3E, 0x55, 0x3E, 0x21, 0x8D,
+    /*1050:*/ 0x40, 0xFC, 0x68, 0x27, 0x26, 0x24, 0x31, 0x6F, 0xC2, 0xAE, 0xE2, 0x7E, 0xE2, 0xCF, 0xBB, 0x73,
+    /*1060:*/ 0x86, 0xE3, 0x94, 0xA2, 0x27, 0xE8, 0xEA, 0x90, 0x5F, 0x7D, 0xB7, 0xF7, 0xAA, 0xC7, 0xF8, 0xA6,
+    /*1070:*/ 0x3A, 0x9F, 0x0C, 0x20, 0x52, 0x92, 0x78, 0x3D, 0x16, 0x0C, 0x6D, 0xCF, 0x7D, 0xDC, 0x43, 0x79,
+    /*1080:*/ 0xB3, 0x15, 0xBF, 0x17, 0x28, 0xB8, 0xDF, 0xAD, 0x89, 0x6C, 0x3E, 0xFB, 0x62, 0x49, 0xFE, 0x2F,
+    /*1090:*/ 0x0E, 0x32, 0xC6, 0xB2, 0xFB, 0x67, 0x24, 0xCD, 0xFE, 0xA3, 0x5F, 0xDD, 0xD3, 0xFA, 0x42, 0x6B,
+    /*10A0:*/ 0xD9, 0x08, 0xDE, 0xF5, 0xD7, 0xC6, 0xDF, 0xB4, 0xFA, 0xA0, 0xC7, 0xE7, 0x62, 0xEE, 0x76, 0x3C,
+    /*10B0:*/ 0xEB, 0x76, 0xAA, 0xC6, 0xFB, 0x3C, 0xDA, 0x2F, 0x4F, 0xEF, 0x1C, 0x3C, 0x0F, 0x2D, 0x6B, 0x52,
+    /*10C0:*/ 0x5F, 0x38, 0x8D, 0xA3, 0x50, 0xDF, 0x7D, 0xA5, 0x26, 0xBB, 0x1B, 0xB0, 0xD5, 0xE6, 0x3D, 0xA5,
+    /*10D0:*/ 0x17, 0x16, 0x43, 0x5B, 0xF9, 0x9E, 0x88, 0x0C, 0x4D, 0x18, 0xDD, 0x6B, 0xFB, 0x3D, 0x28, 0xF4,
+    /*10E0:*/ 0x8C, 0xD0, 0x21, 0x4C, 0xD7, 0xEE, 0xB5, 0x85, 0xA5, 0xB5, 0x7D, 0x3E, 0xBF, 0xF6, 0x8F, 0xA7,
+    /*10F0:*/ 0x6F, 0x78, 0xF0, 0xCE, 0xA9, 0x4B, 0x37, 0x06, 0x96, 0xFE, 0x07, 0xF7, 0x35, 0xEA, 0x5A, 0xCB,
+    /*1100:*/ 0x86, 0x71, 0x27, 0xB4, 0xBE, 0xF7, 0xBB, 0x0F, 0xA3, 0xCE, 0xDD, 0x30, 0x62, 0x57, 0x3D, 0x87,
+    /*1110:*/ 0x6A, 0xEA, 0x7B, 0xF1, 0xAD, 0x87, 0x7B, 0x1F, 0xF6, 0x39, 0x47, 0x9D, 0x88, 0x6A, 0x7D, 0xB7,
+    /*1120:*/ 0x63, 0x04, 0x6B, 0x28, 0x9F, 0xF8, 0xA4, 0xFD, 0x37, 0xAD, 0xD8, 0xAE, 0xA3, 0xC3, 0x8F, 0xDB,
+    /*1130:*/ 0x67, 0x43, 0x11, 0x0D, 0xDF, 0x24, 0xB9, 0xD2, 0x20, 0x85, 0x9E, 0xA6, 0x11, 0x06, 0x8B, 0x9A,
+    /*1140:*/ 0x54, 0x7C, 0x0F, 0xA7, 0x6C, 0x18, 0xE6, 0x07, 0xE1, 0xE6, 0xE2, 0xAA, 0xFC, 0xE7, 0xF2, 0x0F,
+    /*1150:*/ 0xD5, 0x60, 0x2D, 0x69, 0x77, 0x88, 0x81, 0xF9, 0xDF, 0xBE, 0xFD, 0x4E, 0x43, 0x39, 0xD4, 0xB4,
+    /*1160:*/ 0xFC, 0xCD, 0x95, 0x86, 0x17, 0x4E, 0x2E, 0xC5, 0xC3, 0xFA, 0xF1, 0x98, 0x7A, 0x09, 0x4F, 0x8E,
+    /*1170:*/ 0x3A, 0x25, 0xF1, 0xB1, 0x13, 0xFB, 0xFA, 0x9F, 0xAD, 0xBB, 0x06, 0x4D, 0x61, 0x6C, 0x45, 0x5F,
+    /*1180:*/ 0x3B, 0xB6, 0xF3, 0x89, 0xE7, 0xCB, 0x06, 0x37, 0xFD, 0x76, 0xB3, 0xF7, 0xA6, 0x67, 0xE7, 0x70,
+    /*1190:*/ 0x78, 0xBB, 0x1D, 0x33, 0x43, 0xD9, 0x27, 0x75, 0x49, 0x97, 0x88, 0x44, 0xD5, 0x5D, 0xDB, 0x50,
+    /*11A0:*/ 0xB3, 0x1B, 0x1E, 0xCC, 0x5E, 0x70, 0x9E, 0xF0, 0xED, 0xDB, 0x0F, 0xE2, 0x38, 0x3A, 0x46, 0xBD,
+    /*11B0:*/ 0xF8, 0x16, 0xDF, 0xA1, 0x86, 0x8F, 0x1B, 0xB1, 0x3F, 0x7B, 0x47, 0x3E, 0x6E, 0x3C, 0xD3, 0xDE,
+    /*11C0:*/ 0xA4, 0xF9, 0xF5, 0xEF, 0x3E, 0xDC, 0x39, 0x9C, 0xDD, 0xBD, 0x1F, 0x90, 0xBB, 0xE9, 0x91, 0x44,
+    /*11D0:*/ 0x1A, 0x2F, 0xE2, 0x4D, 0x4F, 0x69, 0xB7, 0x09, 0x1E, 0xD5, 0x39, 0x52, 0xDA, 0xFD, 0xE4, 0x43,
+    /*11E0:*/ 0x3F, 0x1C, 0x2B, 0x9F, 0x50, 0xDE, 0xF0, 0x6B, 0xCF, 0x52, 0x53, 0x8B, 0xB2, 0xE3, 0x60, 0x95,
+    /*11F0:*/ 0x99, 0x85, 0xFC, 0x89, 0x51, 0xE2, 0xBA, 0xFC, 0x19, 0xCE, 0xE7, 0x9E, 0x2B, 0xFE, 0x45, 0x0D,
+    /*1200:*/ 0xB3, 0x0E, 0x8D, 0x3F, 0xA5, 0x27, 0x44, 0x1B, 0x75, 0x8E, 0x38, 0xEF, 0x0D, 0x84, 0x75, 0x8B,
+    /*1210:*/ 0xFA, 0x51, 0xE3, 0x0B, 0x27, 0x31, 0x6F, 0x3F, 0x3E, 0x85, 0x0C, 0x8A, 0xC3, 0x6C, 0xB0, 0x6C,
+    /*1220:*/ 0xB8, 0x0F, 0x59, 0x05, 0x28, 0xDD, 0xEC, 0x7D, 0xEC, 0x24, 0xFA, 0xA0, 0xF6, 0x66, 0xEB, 0x45,
+    /*1230:*/ 0x8A, 0x52, 0xF6, 0x05, 0xE5, 0x0D, 0x3B, 0xB4, 0xE6, 0xB7, 0xBD, 0xF7, 0x06, 0xF6, 0x9C, 0x1E,
+    /*1240:*/ 0xD4, 0xE2, 0x69, 0x95, 0x9D, 0x6C, 0xEC, 0xE6, 0xAB, 0x6B, 0xBB, 0x1B, 0x1B, 0x8A, 0xF8, 0x6A,
+    /*1250:*/ 0xB7, 0x11, 0xAB, 0xD9, 0xBD, 0x3B, 0x07, 0xE1, 0x9C, 0x7E, 0x62, 0xE2, 0xF1, 0xA5, 0x02, 0x65,
+    /*1260:*/ 0x10, 0xAE, 0xF9, 0x97, 0x01, 0xF5, 0x77, 0x7D, 0xCE, 0x26, 0x0D, 0xD7, 0xCA, 0x3E, 0xB9, 0xA4,
+    /*1270:*/ 0xBC, 0x81, 0xB3, 0xF8, 0xAB, 0x03, 0xF7, 0x06, 0x3E, 0x71, 0xEE, 0x57, 0x08, 0xD4, 0x69, 0xDC,
+    /*1280:*/ 0x27, 0x8B, 0x57, 0x3D, 0x8F, 0x2F, 0x9D, 0x9F, 0x8A, 0x68, 0x3B, 0x07, 0x6F, 0x78, 0xDE, 0x6C,
+    /*1290:*/ 0x5F, 0xFA, 0x06, 0xD5, 0xE2, 0x4C, 0xFB, 0xB3, 0x15, 0xCA, 0xA2, 0x5E, 0x69, 0xC0, 0xF9, 0x9C,
+    /*12A0:*/ 0x43, 0x8C, 0xE8, 0x11, 0x7D, 0x48, 0x0F, 0xCE, 0x94, 0x94, 0x3E, 0x2C, 0x2A, 0xC9, 0xFF, 0xBB,
+    /*12B0:*/ 0xD7, 0xE7, 0x62, 0xE9, 0xBC, 0xCC, 0xAF, 0xBA, 0x9D, 0xFF, 0xFD, 0x36, 0xEE, 0x26, 0x30, 0xCA,
+    /*12C0:*/ 0x5B, 0xD0, 0x5A, 0xFC, 0x76, 0x2E, 0x66, 0xEC, 0xA3, 0xBF, 0xD5, 0xFB, 0x45, 0x63, 0xA7, 0x88,
+    /*12D0:*/ 0xDF, 0xAE, 0xF6, 0xFE, 0xB5, 0xD1, 0x27, 0x22, 0x5B, 0x1F, 0x5F, 0x42, 0x35, 0x3A, 0x32, 0xEC,
+    /*12E0:*/ 0x18, 0xA9, 0x6B, 0xBF, 0x00, 0x4F, 0x29, 0x9F, 0xD8, 0x73, 0xFA, 0x5D, 0xCF, 0x56, 0x2E, 0x85,
+    /*12F0:*/ 0x0D, 0x57, 0x4A, 0xDD, 0xD3, 0x4C, 0xCC, 0x8C, 0xE2, 0x89, 0xDA, 0x6F, 0x78, 0xF2, 0xE8, 0x6E,
+    /*1300:*/ 0xD8, 0x55, 0xCF, 0x2F, 0x4F, 0x9F, 0xC7, 0x9D, 0x5C, 0xAD, 0xAF, 0xFD, 0xF9, 0xD3, 0x38, 0xBA,
+    /*1310:*/ 0x65, 0x23, 0x0E, 0xB1, 0xBE, 0x17, 0x57, 0x82, 0x7C, 0xA2, 0x4F, 0x3C, 0xD3, 0x6E, 0x87, 0x51,
+    /*1320:*/ 0x38, 0x31, 0xF5, 0x71, 0xC3, 0x8B, 0xDD, 0x18, 0xC9, 0x3B, 0x87, 0xF7, 0xB4, 0xE6, 0x41, 0x3B,
+    /*1330:*/ 0x0B, 0xC8, 0x9B, 0xAD, 0x7B, 0x5A, 0x8D, 0x77, 0x6B, 0xBE, 0x6D, 0x1C, 0xBD, 0xE4, 0xA7, 0x2C,
+    /*1340:*/ 0xA9, 0xEF, 0x7D, 0x96, 0x27, 0xE3, 0xFF, 0x17, 0xB5, 0x33, 0xAD, 0x36, 0xD0, 0x99, 0x2E, 0xFD,
+    /*1350:*/ 0xD8, 0x7C, 0xEE, 0xFC, 0x01, 0xBD, 0xF3, 0x3F, 0x5A, 0xCC, 0xEC, 0x8B, 0x3D, 0x74, 0x07, 0x9C,
+    /*1360:*/ 0x6C, 0xDE, 0xB1, 0x87, 0x3A, 0xED, 0xAA, 0x7F, 0x03, 0x39, 0x2D, 0x42, 0x59, 0x11, 0xA1, 0x1E,
+    /*1370:*/ 0xE4, 0x52, 0xED, 0xEA, 0x1A, 0xA2, 0x38, 0x4E, 0x61, 0xF8, 0xB6, 0xB6, 0x3F, 0x1C, 0xD6, 0x06,
+    /*1380:*/ 0x13, 0x6E, 0xB3, 0x14, 0x27, 0x69, 0x30, 0x5A, 0x5D, 0xF3, 0xA8, 0x24, 0x57, 0xDA, 0xEC, 0xA1,
+    /*1390:*/ 0xF1, 0x75, 0x0F, 0x69, 0x52, 0x2E, 0xD2, 0xDD, 0x44, 0x97, 0x6A, 0xAC, 0xFD, 0x60, 0x76, 0x63,
+    /*13A0:*/ 0x28, 0x1B, 0x64, 0x43, 0xEB, 0x3C, 0xB5, 0x10, 0xE3, 0x09, 0x61, 0x50, 0x07, 0x23, 0xAA, 0x0A,
+    /*13B0:*/ 0xE8, 0x7D, 0x58, 0x04, 0xD5, 0x95, 0x18, 0x8B, 0x88, 0x1E, 0x7E, 0x4A, 0xB4, 0xA5, 0xEE, 0xBE,
+    /*13C0:*/ 0xBB, 0xF4, 0x63, 0x2B, 0x5F, 0xFC, 0xE9, 0x8B, 0x3F, 0x2D, 0x2C, 0xFB, 0xF5, 0x85, 0x50, 0x4F,
+    /*13D0:*/ 0xF1, 0x73, 0x2F, 0x9A, 0x6B, 0x48, 0x9A, 0xB7, 0x1A, 0x88, 0xF6, 0xAC, 0x5C, 0x23, 0x44, 0x63,
+    /*13E0:*/ 0x64, 0x75, 0x3B, 0xB7, 0x7F, 0x5A, 0x79, 0xC6, 0x1B, 0x24, 0xFA, 0xDF, 0x70, 0x7F, 0x7C, 0xCB,
+    /*13F0:*/ 0x6E, 0xFA, 0xB3, 0xDF, 0x09, 0x78, 0x56, 0x59, 0xD5, 0x8F, 0xAF, 0x7E, 0x7E, 0xEB, 0x9D, 0xFF,
+    /*1400:*/ 0xFA, 0xA7, 0xCF, 0x7F, 0xF7, 0x6F, 0x17, 0xF0, 0xD7, 0xC4, 0x47, 0x0D, 0xFF, 0xDE, 0x98, 0x79,
+    /*1410:*/ 0x5F, 0x70, 0x33, 0x4A, 0x0F, 0x56, 0xFF, 0x7E, 0xEE, 0x9F, 0x3F, 0x6F, 0xFB, 0x4B, 0xE3, 0xEA,
+    /*1420:*/ 0x60, 0x22, 0x27, 0xFC, 0x95, 0xF6, 0xF4, 0xB1, 0xF8, 0x29, 0x16, 0xF0, 0x2C, 0xFD, 0xEA, 0x57,
+    /*1430:*/ 0xEF, 0xAF, 0x63, 0xB4, 0xB6, 0x0B, 0x9F, 0x29, 0xA9, 0x31, 0x1A, 0xA7, 0x1A, 0xBA, 0xF9, 0x1D,
+    /*1440:*/ 0x29, 0xF2, 0xA3, 0xE7, 0x3C, 0x3F, 0x85, 0x62, 0x30, 0x67, 0x0D, 0xA1, 0xB8, 0xB6, 0x55, 0xE1,
+    /*1450:*/ 0x33, 0x25, 0x19, 0x8D, 0xB8, 0x96, 0xF2, 0x16, 0x55, 0x86, 0x49, 0x29, 0x28, 0x45, 0x28, 0x77,
+    /*1460:*/ 0x22, 0x29, 0x9E, 0x9A, 0x61, 0xD3, 0xD6, 0xFC, 0x89, 0x6C, 0x52, 0xEC, 0x0C, 0x42, 0x99, 0x92,
+    /*1470:*/ 0x29, 0x99, 0xF2, 0xFF, 0xA0, 0xFC, 0xA4, 0x73, 0xED, 0xFF, 0x05, 0xA7, 0x41, 0x9A, 0xF3,
+};
+
+// settings.jpg
+#define IMG_SETTINGS_Z_SIZE (0x344)
+
+const uint32_t img_settings_z_size = IMG_SETTINGS_Z_SIZE;
+const uint8_t __flash__ img_settings_z[]; // forward declaration.
+const uint8_t __flash__ *img_settings_z_data = img_settings_z;
+
+const uint8_t __flash__ img_settings_z[IMG_SETTINGS_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0xAD, 0x57, 0x3D, 0x68, 0xDB, 0x50, 0x10, 0xD6, 0xE0, 0x41, 0x43, 0x07, 0x0D, 0x19,
+    /*010:*/ 0x3C, 0x74, 0x38, 0x81, 0x87, 0x1A, 0x3A, 0x58, 0xD0, 0x21, 0x86, 0x2C, 0x2E, 0x74, 0x68, 0xA1,
+    /*020:*/ 0x43, 0x3B, 0x06, 0x32, 0x88, 0xE0, 0xC9, 0x64, 0x28, 0xA6, 0x43, 0x10, 0x59, 0x82, 0xF1, 0x14,
+    /*030:*/ 0x3C, 0x18, 0x93, 0xA1, 0x98, 0x0C, 0x01, 0x67, 0x28, 0x34, 0x43, 0xC1, 0x19, 0x0C, 0xF1, 0x62,
+    /*040:*/ 0x70, 0xB7, 0x78, 0x08, 0x38, 0x43, 0x21, 0x1A, 0x32, 0x68, 0xC8, 0xA0, 0x21, 0x83, 0x86, 0x0E,
+    /*050:*/ 0x6A, 0x5E, 0x9E, 0x5F, 0xDF, 0xDF, 0xBD, 0x67, 0x9B, 0xE6, 0x42, 0x64, 0xF1, 0xDE, 0xBD, 0xD3,
+    /*060:*/ 0xE9, 0xEE, 0xBB, 0xEF, 0x4E, 0x79, 0x2E, 0x4B, 0x2C, 0x5C, 0xB9, 0x1C, 0x0F, 0x67, 0x51, 0x1A,
+    /*070:*/ 0x91, 0xFF, 0x34, 0xDA, 0xBF, 0x52, 0xF5, 0x54, 0x6D, 0x26, 0xE3, 0x8C, 0xEC, 0x91, 0x2B, 0xD5,
+    /*080:*/ 0xD1, 0xB5, 0x5F, 0x26, 0xCE, 0x93, 0xD4, 0x5C, 0xFA, 0xCB, 0xD6, 0x0F, 0x52, 0x9B, 0x5D, 0x5C,
+    /*090:*/ 0x98, 0xF5, 0xF8, 0xE9, 0xEE, 0xC5, 0xAE, 0x23, 0x49, 0xA5, 0x65, 0x3B, 0xA5, 0xAE, 0x50, 0xCF,
+    /*0A0:*/ 0xF1, 0x7D, 0x6E, 0x13, 0x16, 0x57, 0x4C, 0x37, 0x5E, 0xE2, 0xAB, 0xAE, 0xFB, 0xE9, 0x88, 0x59,
+    /*0B0:*/ 0xE4, 0xF2, 0xD0, 0x97, 0x63, 0xB7, 0x4A, 0x4C, 0x26, 0xC5, 0xD0, 0xFD, 0xD8, 0x10, 0x57, 0xEA,
+    /*0C0:*/ 0x65, 0x6E, 0x31, 0x74, 0xA9, 0xCF, 0xED, 0x80, 0xEF, 0xEF, 0x5F, 0x95, 0x7C, 0x78, 0xDC, 0xB1,
+    /*0D0:*/ 0xDB, 0x3D, 0xF4, 0x98, 0x7F, 0x05, 0xFF, 0xEB, 0x0F, 0xB2, 0xF2, 0xD0, 0x57, 0x63, 0x41, 0xE5,
+    /*0E0:*/ 0xBA, 0x4F, 0x22, 0xD8, 0xED, 0x9D, 0x7A, 0xB0, 0x58, 0x57, 0x6D, 0x8B, 0x6F, 0x51, 0x73, 0xE5,
+    /*0F0:*/ 0xB7, 0x3E, 0xF4, 0xC8, 0x93, 0x4C, 0x02, 0x0E, 0xDD, 0xE5, 0x67, 0x6A, 0x2E, 0x45, 0x98, 0x1C,
+    /*100:*/ 0xDB, 0x71, 0xC6, 0x30, 0xB5, 0x8A, 0x80, 0x71, 0x8D, 0xDB, 0x66, 0x39, 0xBE, 0xEE, 0x2F, 0xB7,
+    /*110:*/ 0x03, 0xA8, 0x45, 0xA6, 0x01, 0x4F, 0x5E, 0x1F, 0xA4, 0xAA, 0x6D, 0x82, 0x2D, 0xB3, 0x27, 0xBA,
+    /*120:*/ 0x4D, 0x5C, 0x17, 0x1C, 0x31, 0x1E, 0x0C, 0x3B, 0x24, 0x17, 0x76, 0x8F, 0x65, 0xFF, 0x30, 0xAD,
+    /*130:*/ 0xB3, 0x00, 0xC3, 0xC5, 0xE6, 0x14, 0xD6, 0x8A, 0x2D, 0x16, 0x9B, 0x93, 0x4C, 0xC5, 0x06, 0x7D,
+    /*140:*/ 0x07, 0x0C, 0x09, 0x80, 0x44, 0x05, 0x0C, 0xCF, 0x2B, 0xF9, 0xA6, 0x9A, 0xEF, 0xF6, 0xC0, 0x92,
+    /*150:*/ 0x1D, 0xB3, 0x45, 0x26, 0x1B, 0x03, 0xDC, 0x6E, 0x9C, 0xFF, 0xB9, 0xC5, 0xE3, 0x10, 0xBA, 0xC7,
+    /*160:*/ 0xC3, 0x93, 0x05, 0xAF, 0x9C, 0x64, 0x37, 0x97, 0x26, 0x94, 0x7F, 0x9B, 0x9B, 0x2A, 0xF0, 0x2C,
+    /*170:*/ 0xC0, 0xF4, 0x5F, 0xEF, 0xEA, 0x9A, 0x9D, 0x26, 0xE6, 0x37, 0xCB, 0x9F, 0xCC, 0x3D, 0x3F, 0x7B,
+    /*180:*/ 0xBF, 0xAA, 0x58, 0x6C, 0x3B, 0x4D, 0x9C, 0x75, 0xD2, 0x08, 0xF3, 0xE2, 0xAE, 0x38, 0x8B, 0x38,
+    /*190:*/ 0x6B, 0x6F, 0x25, 0xE7, 0x4D, 0x5D, 0x87, 0x56, 0x7A, 0xC1, 0x57, 0x51, 0xCF, 0x19, 0x97, 0xF0,
+    /*1A0:*/ 0x90, 0x9C, 0x8B, 0x70, 0x51, 0xC5, 0x49, 0xF5, 0x62, 0x98, 0xE7, 0xB3, 0x88, 0xF7, 0x0B, 0x35,
+    /*1B0:*/ 0x4F, 0xE0, 0x8C, 0xE6, 0x22, 0x73, 0xCB, 0x32, 0x9A, 0xDB, 0xEA, 0x31, 0xA9, 0xDA, 0x2A, 0xCF,
+    /*1C0:*/ 0x71, 0x62, 0x25, 0x12, 0xB1, 0x14, 0x13, 0x70, 0x54, 0x7E, 0x35, 0xD7, 0xB0, 0x2C, 0xF5, 0xB2,
+    /*1D0:*/ 0xDE, 0x31, 0xC5, 0xE7, 0xBC, 0x2B, 0x83, 0xD4, 0x1F, 0x4D, 0x98, 0xD4, 0x7D, 0x7F, 0xF5, 0x56,
+    /*1E0:*/ 0xB7, 0x26, 0x66, 0xFD, 0x7E, 0xDB, 0x5E, 0xB1, 0x60, 0x44, 0x7E, 0x3B, 0xB0, 0x77, 0x60, 0x8A,
+    /*1F0:*/ 0x52, 0x58, 0xDB, 0xAE, 0xD8, 0xFF, 0x63, 0xB4, 0xB3, 0xDB, 0x39, 0xBC, 0x1D, 0x00, 0xCA, 0x0F,
+    /*200:*/ 0x34, 0x7E, 0x0C, 0x1B, 0xD8, 0x94, 0xB2, 0x95, 0xE8, 0x48, 0xE5, 0xF7, 0x7B, 0x0D, 0x32, 0xFF,
+    /*210:*/ 0x24, 0x55, 0x53, 0x4E, 0x29, 0xC7, 0xC4, 0x0A, 0xDF, 0x52, 0x29, 0xF9, 0x22, 0x56, 0xC5, 0x08,
+    /*220:*/ 0xDC, 0x6F, 0xFF, 0xBE, 0x65, 0x5A, 0x5B, 0x49, 0xA7, 0x39, 0x29, 0x8A, 0x7A, 0xCC, 0x87, 0x59,
+    /*230:*/ 0x84, 0x47, 0xA3, 0xD2, 0xC2, 0x70, 0x55, 0xF0, 0xBF, 0x1C, 0x61, 0x59, 0xA9, 0x97, 0x41, 0xC3,
+    /*240:*/ 0x09, 0x3C, 0xDA, 0xA6, 0xB5, 0x22, 0xCE, 0x2E, 0xB4, 0xB6, 0x39, 0x43, 0x53, 0x9F, 0x28, 0x6F,
+    /*250:*/ 0x8C, 0x33, 0x9D, 0x0D, 0x68, 0x55, 0xE9, 0x5D, 0x2F, 0x74, 0x8B, 0x53, 0xCE, 0x75, 0x9B, 0x53,
+    /*260:*/ 0x53, 0xF7, 0xB9, 0xB9, 0x54, 0xB3, 0xC2, 0x6C, 0x5F, 0x0C, 0xED, 0x5D, 0x85, 0xB1, 0x27, 0x48,
+    /*270:*/ 0x71, 0x05, 0x69, 0x06, 0x51, 0xB3, 0xC1, 0x73, 0xE2, 0x58, 0xBA, 0x1D, 0x58, 0x3A, 0x17, 0x91,
+    /*280:*/ 0x49, 0x11, 0x9F, 0x63, 0x96, 0xE1, 0x73, 0x15, 0xC9, 0x2E, 0x31, 0xFC, 0xBF, 0xFF, 0x00, 0x06,
+    /*290:*/ 0x5C, 0x9B, 0xD9, 0x45, 0x9E, 0xAA, 0xC0, 0x39, 0xF5, 0xF4, 0x4E, 0x95, 0xE7, 0xA1, 0x2B, 0xC6,
+    /*2A0:*/ 0x00, 0x9B, 0x98, 0x60, 0x85, 0x19, 0x49, 0xF7, 0x78, 0x27, 0xD5, 0xAB, 0x09, 0x0C, 0xB3, 0x85,
+    /*2B0:*/ 0x69, 0x12, 0x21, 0x77, 0xDD, 0x9E, 0x9C, 0x41, 0x82, 0x95, 0xFF, 0x8D, 0x31, 0xF5, 0x66, 0x27,
+    /*2C0:*/ 0xD5, 0xEB, 0x6A, 0x9C, 0x85, 0xAE, 0xCC, 0x51, 0xA1, 0x5B, 0x73, 0x55, 0x46, 0x17, 0x63, 0xCD,
+    /*2D0:*/ 0xA6, 0x69, 0x6E, 0x9B, 0xF5, 0x40, 0xB5, 0x56, 0xC6, 0x19, 0xFC, 0x3B, 0x79, 0xE8, 0x9D, 0x37,
+    /*2E0:*/ 0x69, 0xB5, 0xD5, 0x50, 0xDB, 0x95, 0x16, 0x39, 0xF5, 0x66, 0x50, 0xF0, 0x39, 0xDA, 0xE9, 0x84,
+    /*2F0:*/ 0xA4, 0x33, 0x18, 0x7D, 0x12, 0xC9, 0xF6, 0x5D, 0x71, 0x73, 0xCA, 0xD7, 0xDB, 0x81, 0x9E, 0xB7,
+    /*300:*/ 0x82, 0xC4, 0x54, 0xF7, 0xDB, 0xC4, 0x93, 0x71, 0xB6, 0xEA, 0x37, 0x0B, 0x93, 0x8D, 0x81, 0x8E,
+    /*310:*/ 0x36, 0xAF, 0xB5, 0xEE, 0xD7, 0x1A, 0x2E, 0xA0, 0x21, 0xF9, 0x79, 0xEC, 0x92, 0x79, 0x4F, 0x8E,
+    /*320:*/ 0xC7, 0xF7, 0xCF, 0x79, 0x6E, 0x9E, 0x16, 0xD6, 0x13, 0x39, 0x83, 0xA3, 0xF9, 0xF3, 0x78, 0x4C,
+    /*330:*/ 0xBF, 0xCC, 0xF6, 0x1A, 0x7B, 0x8D, 0x4E, 0x93, 0xFC, 0xF1, 0x89, 0x33, 0xB6, 0xFA, 0xFC, 0x17,
+    /*340:*/ 0x30, 0x9F, 0x3F, 0x58,
+};
+
+// cancel.jpg
+#define IMG_CANCEL_Z_SIZE (0x407)
+
+const uint32_t img_cancel_z_size = IMG_CANCEL_Z_SIZE;
+const uint8_t __flash__ img_cancel_z[]; // forward declaration.
+const uint8_t __flash__ *img_cancel_z_data = img_cancel_z;
+
+const uint8_t __flash__ img_cancel_z[IMG_CANCEL_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0x95, 0x57, 0x21, 0x6C, 0xDB, 0x40, 0x14, 0x3D, 0x50, 0x70, 0xD0, 0x60, 0x20, 0x60,
+    /*010:*/ 0xE0, 0x22, 0x0D, 0x24, 0xAC, 0x96, 0x4A, 0x2C, 0x85, 0xD8, 0x52, 0x41, 0x0C, 0x23, 0x95, 0x4C,
+    /*020:*/ 0x0A, 0x30, 0x28, 0x08, 0xAE, 0x86, 0xAA, 0x90, 0xA8, 0x0A, 0x28, 0x18, 0x1C, 0xA8, 0x26, 0x83,
+    /*030:*/ 0x48, 0x0D, 0xA8, 0x94, 0xB1, 0x14, 0x54, 0x6A, 0x48, 0xA5, 0x06, 0x8C, 0x67, 0xA0, 0x52, 0x0C,
+    /*040:*/ 0x0A, 0x0C, 0x0D, 0x06, 0x0C, 0x02, 0x6E, 0xF9, 0xFE, 0xFE, 0xB9, 0x3B, 0xC7, 0x76, 0xBD, 0x8B,
+    /*050:*/ 0x62, 0x25, 0xF6, 0xBF, 0x77, 0xFF, 0xFE, 0xFD, 0xFF, 0xDE, 0xB7, 0x94, 0x61, 0x2A, 0xF3, 0xB1,
+    /*060:*/ 0xDB, 0xF6, 0x7D, 0x97, 0xCF, 0xAC, 0xD3, 0x9B, 0x55, 0x76, 0x2F, 0x92, 0xFA, 0x88, 0xF2, 0xFF,
+    /*070:*/ 0xF0, 0x0C, 0x7F, 0xE1, 0xCC, 0x55, 0x9A, 0x5C, 0x9F, 0xB4, 0x05, 0xEB, 0x78, 0x4F, 0x1B, 0x35,
+    /*080:*/ 0x8B, 0x6C, 0xC1, 0xFA, 0x62, 0x21, 0x18, 0x0C, 0xB8, 0x8E, 0xFC, 0x28, 0x9B, 0x17, 0x19, 0x98,
+    /*090:*/ 0x88, 0x2A, 0x35, 0x54, 0xB8, 0xD3, 0xF1, 0x26, 0x56, 0x36, 0x91, 0xB9, 0xFC, 0xD3, 0xBD, 0xB2,
+    /*0A0:*/ 0xA2, 0x39, 0xE9, 0xF3, 0xEC, 0xF0, 0x1C, 0xAE, 0x73, 0x5B, 0x6A, 0xD8, 0x38, 0xC6, 0x89, 0x94,
+    /*0B0:*/ 0xA6, 0x57, 0xE3, 0x64, 0xED, 0xA0, 0x2F, 0x8C, 0x05, 0xFB, 0x79, 0x33, 0xEB, 0x62, 0x11, 0xE5,
+    /*0C0:*/ 0x96, 0x68, 0xD5, 0x7A, 0x55, 0x4F, 0xF1, 0x2A, 0xD8, 0xDA, 0x51, 0xFB, 0x5E, 0xA5, 0x91, 0x34,
+    /*0D0:*/ 0x57, 0x8A, 0xB2, 0xEF, 0xC8, 0x27, 0x6F, 0x70, 0x3E, 0x60, 0x3F, 0x2E, 0xC1, 0x0E, 0xFD, 0x7E,
+    /*0E0:*/ 0x5C, 0xC2, 0x7E, 0xD0, 0x57, 0x1C, 0xB8, 0xBF, 0xDB, 0xC1, 0xDB, 0x56, 0xCA, 0x61, 0x12, 0x19,
+    /*0F0:*/ 0x3B, 0x54, 0x6B, 0x75, 0x3C, 0x1D, 0x93, 0x46, 0xC0, 0x1F, 0x97, 0x68, 0x73, 0x76, 0x8F, 0x38,
+    /*100:*/ 0x14, 0x0D, 0xDD, 0x72, 0x6E, 0x03, 0x36, 0xA2, 0x52, 0x2C, 0xE8, 0xFF, 0xDC, 0x56, 0x76, 0x62,
+    /*110:*/ 0x8F, 0xE7, 0x72, 0x9C, 0x2B, 0xF6, 0x1F, 0x88, 0xC9, 0xD3, 0x46, 0xF7, 0x55, 0x68, 0x96, 0xF8,
+    /*120:*/ 0xAB, 0xEF, 0x03, 0xA2, 0x8A, 0x30, 0xFA, 0x3F, 0x4E, 0xB8, 0x27, 0xF2, 0x5D, 0x9A, 0x3E, 0x8B,
+    /*130:*/ 0x3C, 0x3A, 0x77, 0x9B, 0xBE, 0x5F, 0xDC, 0x4D, 0xD1, 0xB6, 0xEF, 0xF7, 0x62, 0x3D, 0x0E, 0x80,
+    /*140:*/ 0x0C, 0xF1, 0x15, 0x87, 0xF3, 0x56, 0x39, 0x25, 0x0E, 0xB3, 0x8B, 0xB8, 0xC7, 0xAB, 0x60, 0x4C,
+    /*150:*/ 0x54, 0x24, 0x00, 0x17, 0xF2, 0xA1, 0xCC, 0x5F, 0x1D, 0x23, 0xE0, 0xEF, 0x2D, 0x15, 0x79, 0x56,
+    /*160:*/ 0x31, 0x44, 0x96, 0xDF, 0xE8, 0xF3, 0x30, 0x21, 0x6F, 0x5C, 0xEE, 0x56, 0xCE, 0x60, 0xEC, 0xA5,
+    /*170:*/ 0x75, 0x7A, 0xF3, 0x11, 0x2A, 0xC5, 0x04, 0xB1, 0x1F, 0x06, 0xBA, 0xB5, 0xA8, 0x9C, 0x63, 0xDD,
+    /*180:*/ 0x8C, 0x13, 0xB0, 0xAD, 0xDB, 0x1D, 0xDD, 0xFF, 0xD2, 0x0E, 0x53, 0xCC, 0x07, 0x8C, 0xAD, 0xA8,
+    /*190:*/ 0xF1, 0x63, 0xE4, 0x63, 0xAE, 0x9E, 0x77, 0xC1, 0xB6, 0x6A, 0x6F, 0x74, 0x9F, 0xD6, 0x56, 0xA7,
+    /*1A0:*/ 0x24, 0x4A, 0x7D, 0x99, 0x59, 0x97, 0x5D, 0xAA, 0x81, 0x30, 0xE5, 0x5E, 0x95, 0x5D, 0x70, 0xD8,
+    /*1B0:*/ 0x8B, 0xCA, 0x02, 0x15, 0x0F, 0x51, 0x72, 0xF6, 0xDC, 0x0B, 0x53, 0xAA, 0x5E, 0x60, 0xA4, 0xDB,
+    /*1C0:*/ 0x01, 0xAB, 0x19, 0xE8, 0x2F, 0x56, 0x94, 0x28, 0x64, 0xBC, 0x69, 0x17, 0x3B, 0xC3, 0x84, 0x58,
+    /*1D0:*/ 0x00, 0x59, 0x6B, 0x98, 0xE8, 0x35, 0x55, 0x86, 0x1B, 0x18, 0x11, 0x13, 0xEC, 0x38, 0x7E, 0x01,
+    /*1E0:*/ 0x3F, 0x69, 0x23, 0x5A, 0x68, 0x70, 0x41, 0x2F, 0xEE, 0xFB, 0x66, 0x46, 0xB2, 0x06, 0x43, 0xAF,
+    /*1F0:*/ 0x17, 0x38, 0x37, 0x9D, 0xCF, 0x15, 0xDF, 0x8E, 0x13, 0xE4, 0x2E, 0xC1, 0x8A, 0x0C, 0x56, 0x37,
+    /*200:*/ 0x5E, 0xF2, 0x8A, 0x88, 0x9D, 0x5E, 0x6C, 0x6A, 0x85, 0xEE, 0xFB, 0x6E, 0x3B, 0xB5, 0xD1, 0xDF,
+    /*210:*/ 0x26, 0x98, 0xBA, 0xDF, 0x53, 0x5B, 0xA9, 0x82, 0x34, 0x54, 0x05, 0x7E, 0x41, 0x0D, 0x23, 0x27,
+    /*220:*/ 0xFC, 0x0F, 0x2A, 0x44, 0x82, 0x7B, 0x58, 0xFF, 0xD1, 0x91, 0xC7, 0x91, 0xC1, 0xBF, 0x94, 0x83,
+    /*230:*/ 0x4D, 0x47, 0xC7, 0x1B, 0x26, 0xBA, 0xA6, 0x15, 0x35, 0x08, 0x91, 0x71, 0x85, 0xF3, 0x2E, 0xC6,
+    /*240:*/ 0x83, 0x14, 0xAE, 0xCE, 0xE7, 0xCB, 0x2E, 0x60, 0x86, 0x85, 0x58, 0x28, 0xCD, 0x8C, 0x34, 0x1D,
+    /*250:*/ 0x02, 0x3B, 0xC6, 0xAA, 0xAB, 0xD2, 0x1C, 0x77, 0x1B, 0xA5, 0x38, 0xE5, 0xB1, 0xD6, 0xF5, 0x0D,
+    /*260:*/ 0xCE, 0x31, 0xE0, 0x4D, 0x62, 0x22, 0xF6, 0x1C, 0x3B, 0x4C, 0xE4, 0x11, 0xA6, 0xD9, 0x3F, 0x60,
+    /*270:*/ 0x5C, 0xC2, 0xF4, 0xF7, 0xD7, 0xA6, 0xFE, 0xE2, 0xDA, 0xB7, 0x03, 0xD0, 0x86, 0xAA, 0x41, 0x71,
+    /*280:*/ 0x0A, 0x0D, 0xBD, 0x10, 0x8D, 0xCF, 0x10, 0xD5, 0x9D, 0xD8, 0x22, 0x92, 0xC7, 0xFD, 0x43, 0xEC,
+    /*290:*/ 0x10, 0xA7, 0x8B, 0x86, 0xF9, 0x81, 0x76, 0xD0, 0x9F, 0x90, 0xAA, 0x99, 0xDA, 0x26, 0x8D, 0xFE,
+    /*2A0:*/ 0xA1, 0x39, 0xAE, 0xE2, 0x8C, 0xA9, 0x1D, 0x16, 0xFA, 0x13, 0xB3, 0x7F, 0x08, 0xF8, 0x47, 0xAA,
+    /*2B0:*/ 0x58, 0xC6, 0x1B, 0xD8, 0x51, 0x3C, 0x64, 0xFD, 0xC9, 0x58, 0xEB, 0x4F, 0xF0, 0x3A, 0xB5, 0x15,
+    /*2C0:*/ 0x5B, 0x28, 0x76, 0x6B, 0x12, 0x0B, 0xA5, 0x47, 0x6B, 0x67, 0xB7, 0x35, 0x23, 0x12, 0xA6, 0xB1,
+    /*2D0:*/ 0x63, 0x72, 0x7B, 0xBD, 0x7A, 0x55, 0x77, 0x11, 0xFD, 0x8C, 0xEF, 0x54, 0xF5, 0x01, 0xEF, 0x0B,
+    /*2E0:*/ 0x83, 0x13, 0x9B, 0xD7, 0xB7, 0xA9, 0x5E, 0x90, 0x27, 0x70, 0x92, 0x98, 0xCB, 0xC0, 0xF9, 0x98,
+    /*2F0:*/ 0x61, 0xD5, 0x59, 0x5C, 0xEC, 0xA4, 0xEA, 0xD6, 0x9D, 0xDA, 0x88, 0x1C, 0x1F, 0xFA, 0x92, 0x72,
+    /*300:*/ 0x5C, 0xD2, 0x92, 0xCB, 0xEE, 0xE7, 0x18, 0x6C, 0xF5, 0xB5, 0x44, 0x85, 0x07, 0xB1, 0x13, 0xC9,
+    /*310:*/ 0xE4, 0x5A, 0x75, 0x24, 0x2E, 0x2F, 0xF7, 0x75, 0x62, 0x89, 0x3D, 0x4F, 0x82, 0x17, 0x9F, 0xE3,
+    /*320:*/ 0x91, 0x4F, 0x0A, 0x58, 0x57, 0xA5, 0x01, 0xFF, 0x75, 0xA5, 0x7A, 0xA4, 0x6A, 0xF6, 0x05, 0xFE,
+    /*330:*/ 0x1D, 0x26, 0xA4, 0x0D, 0xD8, 0x9F, 0x60, 0x9E, 0x55, 0xA3, 0xBF, 0xB7, 0x44, 0x49, 0x3D, 0x15,
+    /*340:*/ 0xD1, 0xD7, 0x0E, 0x55, 0xD7, 0x2A, 0xEB, 0xB9, 0x4F, 0xDA, 0x33, 0xAB, 0x0E, 0x95, 0x4E, 0x92,
+    /*350:*/ 0x69, 0xBB, 0x73, 0x79, 0x59, 0xFF, 0x40, 0x9C, 0xA5, 0x6A, 0x8A, 0x7B, 0xF5, 0xD1, 0x70, 0xF9,
+    /*360:*/ 0xDC, 0xDE, 0x6D, 0xEB, 0xFB, 0x23, 0xD0, 0x0B, 0x9D, 0x05, 0x88, 0x71, 0x14, 0x6F, 0x95, 0x6B,
+    /*370:*/ 0x39, 0x54, 0xE3, 0xC5, 0x62, 0x66, 0x95, 0xE7, 0x92, 0xEA, 0x1F, 0x8A, 0x23, 0xCA, 0xB9, 0xAB,
+    /*380:*/ 0x3C, 0x16, 0x13, 0xEB, 0xEF, 0x4F, 0xB4, 0xFB, 0xB6, 0x28, 0xAA, 0x12, 0xAE, 0xB0, 0x76, 0xC2,
+    /*390:*/ 0x0A, 0x3E, 0x87, 0x2F, 0xF4, 0xBB, 0xC7, 0x3D, 0x0D, 0xFC, 0x83, 0x77, 0x37, 0x8A, 0x5C, 0xEB,
+    /*3A0:*/ 0xF5, 0x45, 0xEB, 0xA3, 0x31, 0x3E, 0xC0, 0xB9, 0xC7, 0x4A, 0x41, 0x6B, 0xE1, 0x3B, 0x86, 0xDE,
+    /*3B0:*/ 0xB3, 0xD1, 0x7E, 0xFF, 0x3C, 0x9B, 0x6F, 0x90, 0x3F, 0x96, 0x66, 0x5F, 0x7C, 0xDE, 0xED, 0xC5,
+    /*3C0:*/ 0xAB, 0xB4, 0x5C, 0x25, 0x54, 0x07, 0xB0, 0xDB, 0xC6, 0x8E, 0x30, 0xE2, 0x47, 0x71, 0x50, 0x67,
+    /*3D0:*/ 0x8E, 0xD8, 0x94, 0xC1, 0x23, 0x9F, 0xBA, 0xBD, 0x3A, 0x05, 0x42, 0xBF, 0xE7, 0xF6, 0xC4, 0xA2,
+    /*3E0:*/ 0x77, 0x80, 0xB3, 0x7B, 0x93, 0x3F, 0xC9, 0x8B, 0xBB, 0x0D, 0xEC, 0x6E, 0x62, 0x25, 0xD7, 0x3A,
+    /*3F0:*/ 0xC7, 0x96, 0xEB, 0xA6, 0xFE, 0xD6, 0xF9, 0xFD, 0x0A, 0x72, 0x60, 0xED, 0xBC, 0x6D, 0x23, 0x4D,
+    /*400:*/ 0x57, 0xFF, 0x01, 0xB5, 0x89, 0x87, 0x63,
+};
+
+// tick.jpg
+#define IMG_SAVE_Z_SIZE (0x249)
+
+const uint32_t img_save_z_size = IMG_SAVE_Z_SIZE;
+const uint8_t __flash__ img_save_z[]; // forward declaration.
+const uint8_t __flash__ *img_save_z_data = img_save_z;
+
+const uint8_t __flash__ img_save_z[IMG_SAVE_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0xED, 0x56, 0xAF, 0x6F, 0xC2, 0x40, 0x14, 0xAE, 0xAC, 0x98, 0xA8, 0x3C, 0xF9, 0xFE,
+    /*010:*/ 0x80, 0x19, 0x1C, 0x4B, 0x66, 0xF8, 0x03, 0x30, 0xB8, 0xD5, 0x35, 0xC8, 0x06, 0x85, 0x5A, 0x70,
+    /*020:*/ 0xC8, 0x09, 0xE4, 0x04, 0x21, 0x88, 0x09, 0x04, 0x02, 0x07, 0xAE, 0x33, 0x24, 0x35, 0x4D, 0x98,
+    /*030:*/ 0x58, 0x02, 0xF2, 0x04, 0x02, 0x31, 0x31, 0x31, 0x51, 0xD9, 0xED, 0x72, 0x39, 0xEE, 0xDD, 0xAF,
+    /*040:*/ 0x02, 0xA5, 0x13, 0x4B, 0xF6, 0x12, 0x5A, 0x20, 0xC7, 0xC7, 0xD7, 0xF7, 0xBE, 0xF7, 0xBD, 0x57,
+    /*050:*/ 0x14, 0x75, 0x04, 0x35, 0xAE, 0xF5, 0xA0, 0x62, 0xAC, 0xD7, 0xBC, 0x5E, 0x74, 0xCC, 0x9D, 0xD6,
+    /*060:*/ 0x84, 0x4B, 0xD1, 0xEB, 0x37, 0x39, 0x4B, 0xEC, 0xFA, 0xAA, 0xF7, 0xB8, 0x19, 0xF5, 0xB3, 0xF0,
+    /*070:*/ 0x6B, 0xC2, 0x70, 0xEB, 0x64, 0x9C, 0x27, 0x6B, 0xE2, 0xFD, 0x04, 0x78, 0xB7, 0x5D, 0x5A, 0x1B,
+    /*080:*/ 0x6B, 0x5A, 0xEC, 0x92, 0x61, 0xE0, 0x1D, 0xE3, 0xA6, 0x6B, 0x7B, 0xA6, 0x2A, 0x99, 0x5C, 0x2D,
+    /*090:*/ 0x5B, 0xBE, 0xA7, 0x44, 0x2F, 0xBE, 0x26, 0xAF, 0xE2, 0xBE, 0x5A, 0x0E, 0x03, 0xF0, 0xF4, 0x68,
+    /*0A0:*/ 0xC7, 0x6E, 0xC5, 0x9F, 0xC7, 0x3A, 0x4F, 0xF6, 0x84, 0x63, 0xA9, 0xE8, 0x50, 0x89, 0xB7, 0xEC,
+    /*0B0:*/ 0xE1, 0x3C, 0x79, 0x09, 0x30, 0x2E, 0x46, 0x5F, 0x93, 0xCB, 0xB3, 0x2D, 0xFA, 0x62, 0x97, 0xB0,
+    /*0C0:*/ 0xFC, 0xC2, 0x91, 0xA5, 0xCA, 0x5A, 0x22, 0x5F, 0xAA, 0x41, 0xAE, 0x87, 0xC8, 0xC7, 0x4C, 0x41,
+    /*0D0:*/ 0xAB, 0xA2, 0xC4, 0x9C, 0xE6, 0x97, 0xEA, 0x17, 0x63, 0x62, 0x5C, 0xA6, 0x6A, 0xC9, 0xF8, 0xFE,
+    /*0E0:*/ 0xF0, 0xBC, 0x24, 0xE9, 0x79, 0xB8, 0x7B, 0xE2, 0x59, 0x98, 0x8A, 0x77, 0x8B, 0x3E, 0x3E, 0xFD,
+    /*0F0:*/ 0xB0, 0x19, 0x06, 0x91, 0x1F, 0xF9, 0x4F, 0x9D, 0x72, 0x97, 0x64, 0x79, 0x88, 0x7C, 0xAF, 0x24,
+    /*100:*/ 0x16, 0x7D, 0xEC, 0xD3, 0xCD, 0x14, 0x8E, 0x4F, 0x34, 0xEF, 0x94, 0x69, 0x70, 0x97, 0x70, 0x66,
+    /*110:*/ 0xA2, 0x3B, 0x70, 0x1E, 0xD8, 0xFD, 0x23, 0xC4, 0x55, 0xCB, 0x13, 0x7E, 0x0E, 0xB4, 0x2C, 0x99,
+    /*120:*/ 0x15, 0x60, 0x3A, 0xD3, 0x55, 0x80, 0x33, 0x91, 0x85, 0x98, 0x13, 0xAF, 0x32, 0x28, 0x27, 0xD4,
+    /*130:*/ 0xDE, 0x17, 0x7E, 0xFE, 0xB0, 0x59, 0x13, 0xB0, 0xF6, 0x05, 0xBF, 0xCA, 0xCE, 0x63, 0x4C, 0x58,
+    /*140:*/ 0x7E, 0x5B, 0xBE, 0xC9, 0x20, 0x0B, 0x75, 0x2D, 0x92, 0x54, 0x9C, 0x93, 0xE7, 0xC1, 0xA8, 0x9B,
+    /*150:*/ 0xFC, 0xC5, 0xAC, 0x21, 0xFF, 0x53, 0x65, 0x32, 0xEF, 0xA8, 0x7A, 0x60, 0x78, 0x38, 0xBB, 0x32,
+    /*160:*/ 0xD8, 0xB7, 0xBC, 0x9B, 0xF1, 0x44, 0x01, 0xAB, 0x76, 0x44, 0x4E, 0x84, 0x3F, 0x90, 0x34, 0xF2,
+    /*170:*/ 0x41, 0x41, 0x52, 0x9F, 0x90, 0xB3, 0x50, 0x3D, 0xF0, 0x70, 0xA7, 0x67, 0x0B, 0x7F, 0xE6, 0x9D,
+    /*180:*/ 0x44, 0x52, 0xB5, 0x2F, 0x74, 0xCE, 0xBA, 0xB3, 0xF1, 0xEB, 0x78, 0x2B, 0x55, 0x6F, 0xAB, 0x79,
+    /*190:*/ 0x3B, 0xB6, 0xF5, 0x9B, 0x4D, 0xBF, 0xA6, 0x43, 0x08, 0x46, 0xE0, 0x50, 0x7E, 0xE4, 0xBB, 0xFC,
+    /*1A0:*/ 0x8C, 0xC5, 0xA8, 0xAF, 0x4F, 0x6F, 0x55, 0xFD, 0xFA, 0xD3, 0xBA, 0x1D, 0xC1, 0x54, 0x90, 0x6B,
+    /*1B0:*/ 0x33, 0x12, 0x93, 0xC1, 0x8D, 0xDD, 0x72, 0xF6, 0x32, 0x57, 0xA6, 0xAC, 0x1B, 0xB5, 0x7A, 0x6E,
+    /*1C0:*/ 0x33, 0xDD, 0x13, 0xB7, 0x17, 0xE8, 0x3D, 0xCC, 0xE2, 0x6D, 0x20, 0x71, 0xCB, 0xA7, 0x75, 0x33,
+    /*1D0:*/ 0xB5, 0xF1, 0x86, 0x12, 0xDF, 0xA1, 0x27, 0xA7, 0x9C, 0xF4, 0x0F, 0xDB, 0xB4, 0x04, 0x4B, 0xBE,
+    /*1E0:*/ 0x79, 0x1E, 0x30, 0xDB, 0xF2, 0x29, 0xCA, 0x37, 0x07, 0xF0, 0x4E, 0x85, 0xD9, 0xF9, 0xE7, 0x4C,
+    /*1F0:*/ 0x24, 0xAE, 0xC1, 0x32, 0xF4, 0x76, 0x5C, 0x75, 0xE7, 0x11, 0xB5, 0x04, 0x47, 0x7E, 0xAF, 0xD9,
+    /*200:*/ 0x09, 0x45, 0xEF, 0x98, 0xFE, 0xA0, 0xCE, 0xB7, 0x6A, 0x1B, 0x20, 0xDE, 0xD4, 0x84, 0xAE, 0x79,
+    /*210:*/ 0x7E, 0xA7, 0x57, 0xEE, 0x83, 0xA6, 0x0B, 0x71, 0xBE, 0xD4, 0xB2, 0x81, 0x5D, 0xBA, 0xB7, 0xA9,
+    /*220:*/ 0xBD, 0xF3, 0x39, 0x30, 0xFD, 0x81, 0x56, 0xDC, 0xAF, 0xD8, 0xBC, 0x11, 0xD8, 0xBD, 0x98, 0x55,
+    /*230:*/ 0x4D, 0x6E, 0xDD, 0xD7, 0xEF, 0xDE, 0xE3, 0x6D, 0x16, 0xCE, 0x1A, 0xEF, 0x93, 0xA2, 0x26, 0xBC,
+    /*240:*/ 0xFF, 0xF8, 0x4B, 0xF1, 0x0D, 0xAE, 0x78, 0x0D, 0x60,
+};
+
+// keypad.jpg
+#define IMG_KEYPAD_Z_SIZE (0x2CE)
+
+const uint32_t img_keypad_z_size = IMG_KEYPAD_Z_SIZE;
+const uint8_t __flash__ img_keypad_z[]; // forward declaration.
+const uint8_t __flash__ *img_keypad_z_data = img_keypad_z;
+
+const uint8_t __flash__ img_keypad_z[IMG_KEYPAD_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0xAD, 0x57, 0x21, 0x6C, 0xDB, 0x40, 0x14, 0x35, 0x18, 0x30, 0x0C, 0x34, 0x18, 0xB8,
+    /*010:*/ 0xB1, 0x96, 0xCD, 0x6C, 0x95, 0x42, 0x1C, 0xB6, 0x4A, 0x03, 0x1B, 0x9C, 0x14, 0x50, 0x50, 0x30,
+    /*020:*/ 0x0D, 0x15, 0x0C, 0x86, 0x44, 0x53, 0x50, 0x51, 0x64, 0x18, 0x05, 0x14, 0x04, 0x54, 0x2A, 0x89,
+    /*030:*/ 0xD4, 0xB2, 0x84, 0x58, 0xEA, 0xC0, 0x60, 0xC0, 0x40, 0x25, 0x7F, 0x50, 0x60, 0x18, 0x30, 0x70,
+    /*040:*/ 0x20, 0xE0, 0xEA, 0x9F, 0xD3, 0xDD, 0x3F, 0xFB, 0x6C, 0x9F, 0xE3, 0xE4, 0xAC, 0x5C, 0x92, 0xEF,
+    /*050:*/ 0x7F, 0xEF, 0xBE, 0xFF, 0x7F, 0xFF, 0xDF, 0x37, 0x08, 0x21, 0x82, 0xE7, 0xBF, 0xDF, 0xDF, 0x7D,
+    /*060:*/ 0x18, 0xF7, 0x5E, 0x83, 0xBB, 0xDE, 0xE1, 0x57, 0x12, 0x24, 0xF9, 0xBA, 0x2B, 0x1F, 0xE7, 0x71,
+    /*070:*/ 0xFE, 0xFF, 0xFE, 0xDB, 0xAF, 0x07, 0xB1, 0x1F, 0xCB, 0x98, 0x79, 0x38, 0xE4, 0xDC, 0x7D, 0x30,
+    /*080:*/ 0xE3, 0xD7, 0x97, 0x9F, 0x42, 0xFC, 0x5B, 0x29, 0xE9, 0xB1, 0xC8, 0xC5, 0xB1, 0x99, 0xFD, 0xB8,
+    /*090:*/ 0x3C, 0x05, 0x0E, 0xB3, 0xEC, 0x7E, 0x0D, 0x98, 0xC7, 0x4E, 0x66, 0x71, 0x1D, 0xC6, 0x70, 0x7B,
+    /*0A0:*/ 0xDC, 0x35, 0xDA, 0xF6, 0xB3, 0xA7, 0x47, 0xDA, 0x81, 0x66, 0x71, 0xF4, 0x00, 0xF1, 0xF4, 0x28,
+    /*0B0:*/ 0xF1, 0x22, 0xDF, 0xB4, 0x79, 0xCD, 0xBB, 0xE2, 0xD1, 0xCC, 0x57, 0x55, 0x5E, 0x21, 0xDD, 0x24,
+    /*0C0:*/ 0xB0, 0x77, 0x23, 0x2B, 0x40, 0xEB, 0xD1, 0x5A, 0x25, 0x93, 0x4C, 0xF3, 0x6A, 0x91, 0xAF, 0x34,
+    /*0D0:*/ 0xCA, 0x68, 0x5B, 0x96, 0x45, 0x3E, 0xFE, 0xC3, 0x1D, 0x41, 0x28, 0xFB, 0xA4, 0x0C, 0x25, 0x9F,
+    /*0E0:*/ 0x9E, 0x9B, 0x90, 0x41, 0xA3, 0xB0, 0x3C, 0xAA, 0x65, 0x64, 0xE6, 0xCD, 0xB9, 0xD2, 0xB3, 0xD7,
+    /*0F0:*/ 0xCA, 0x08, 0xD6, 0xDB, 0x3C, 0xEE, 0xD9, 0x36, 0x2B, 0x09, 0xD9, 0x87, 0xC8, 0x2A, 0xFE, 0x4A,
+    /*100:*/ 0x8B, 0x37, 0x7A, 0x63, 0xCD, 0xD1, 0xA7, 0xCC, 0x40, 0x46, 0x2F, 0x32, 0x1D, 0x17, 0x51, 0xF2,
+    /*110:*/ 0x33, 0xD3, 0x7E, 0x86, 0xBC, 0x02, 0x35, 0xDB, 0xAC, 0x76, 0x28, 0xC6, 0x1F, 0xAC, 0x7B, 0x60,
+    /*120:*/ 0xE9, 0xB9, 0x22, 0x08, 0x05, 0x2E, 0xC1, 0x7E, 0x36, 0xB1, 0x44, 0x69, 0x1F, 0xD0, 0x31, 0xE5,
+    /*130:*/ 0x2B, 0x97, 0xCD, 0xE0, 0x60, 0x6F, 0xDD, 0x1D, 0x97, 0x37, 0x3E, 0x5F, 0x4E, 0xC2, 0xEB, 0xF3,
+    /*140:*/ 0x49, 0x38, 0x09, 0xD7, 0x9A, 0x07, 0xFE, 0x60, 0xB1, 0x97, 0xFD, 0xB9, 0x20, 0xEC, 0xEC, 0x02,
+    /*150:*/ 0x75, 0x50, 0xA6, 0x90, 0x79, 0x07, 0x3E, 0x47, 0x9A, 0x75, 0xE4, 0x29, 0x73, 0xAD, 0xF4, 0x5B,
+    /*160:*/ 0xB3, 0x9F, 0x25, 0x9F, 0x59, 0x4D, 0xA6, 0x98, 0x7A, 0x36, 0xEB, 0x5C, 0xDE, 0xB8, 0xEB, 0x29,
+    /*170:*/ 0xFB, 0x14, 0xF2, 0x9A, 0x2B, 0x8E, 0x2B, 0x3E, 0xA3, 0xAC, 0xC8, 0x3A, 0xF4, 0x9C, 0x8B, 0x1B,
+    /*180:*/ 0x91, 0xCF, 0x74, 0x65, 0x55, 0xCF, 0x4E, 0x75, 0x9C, 0xB8, 0x13, 0x95, 0x9E, 0x63, 0xCE, 0x9B,
+    /*190:*/ 0xB2, 0x1B, 0x57, 0xF4, 0xB3, 0x5D, 0x8A, 0x1F, 0xF2, 0x05, 0x88, 0xD1, 0x76, 0x97, 0xEE, 0xD2,
+    /*1A0:*/ 0xF7, 0x59, 0x3F, 0x23, 0xFE, 0xF6, 0xB3, 0xE1, 0x5E, 0x4A, 0x35, 0xC0, 0x95, 0xDD, 0xD0, 0xB9,
+    /*1B0:*/ 0x42, 0xB7, 0xC9, 0x41, 0x68, 0x60, 0x72, 0xFD, 0xCE, 0x2E, 0xD6, 0xFD, 0x9F, 0x4D, 0xE3, 0x69,
+    /*1C0:*/ 0x7C, 0x73, 0x3B, 0x8D, 0x09, 0x63, 0x33, 0x43, 0xC9, 0xCD, 0xED, 0x32, 0x26, 0xF4, 0xCD, 0x0C,
+    /*1D0:*/ 0x75, 0xBE, 0x6A, 0x99, 0x0B, 0x19, 0x2A, 0x6A, 0x1D, 0x54, 0xB0, 0x4E, 0x71, 0xC3, 0x94, 0xB9,
+    /*1E0:*/ 0x33, 0x45, 0x71, 0x63, 0xCE, 0xAB, 0x32, 0xA5, 0xBE, 0x3E, 0xBB, 0xFC, 0x4C, 0x36, 0x0F, 0x2D,
+    /*1F0:*/ 0x9B, 0x91, 0xCF, 0xE5, 0x1C, 0xA4, 0xDD, 0x0E, 0x3F, 0xAD, 0xCC, 0x73, 0xA6, 0xCE, 0xE6, 0x36,
+    /*200:*/ 0x75, 0x63, 0x19, 0x2F, 0x63, 0x19, 0x43, 0x51, 0x1B, 0x41, 0x64, 0xB5, 0x8C, 0x20, 0x4A, 0xDB,
+    /*210:*/ 0xFA, 0x59, 0xAE, 0x04, 0x27, 0xB3, 0xC1, 0xFA, 0xED, 0xAA, 0x48, 0x87, 0x0E, 0xCA, 0x4A, 0x57,
+    /*220:*/ 0x04, 0x31, 0x87, 0x31, 0xBB, 0x29, 0x6B, 0x85, 0xC0, 0xDE, 0xEA, 0x25, 0x45, 0x39, 0xC9, 0xFA,
+    /*230:*/ 0x96, 0x9E, 0xCB, 0x1B, 0xC4, 0x8D, 0x39, 0x57, 0xCF, 0x60, 0xD7, 0x67, 0xAC, 0x52, 0xE6, 0x5A,
+    /*240:*/ 0xB4, 0xDC, 0x8D, 0xAC, 0xBA, 0xD3, 0x2A, 0xD6, 0x81, 0xF6, 0x81, 0x44, 0xC6, 0x3B, 0xED, 0x58,
+    /*250:*/ 0x07, 0x42, 0x75, 0x05, 0xAC, 0xF2, 0x4C, 0xA9, 0xEA, 0xBE, 0x44, 0x8B, 0xAE, 0x00, 0x2A, 0x3B,
+    /*260:*/ 0x19, 0xCA, 0x78, 0x56, 0xC8, 0xEE, 0x72, 0x0F, 0xE2, 0xCA, 0x94, 0xB3, 0x01, 0x9E, 0x9B, 0xD7,
+    /*270:*/ 0xE7, 0x8B, 0xD0, 0x3C, 0x4D, 0x17, 0xE1, 0x42, 0x9F, 0xA6, 0xE5, 0x13, 0x16, 0x5A, 0x66, 0x8A,
+    /*280:*/ 0xBB, 0x8E, 0x56, 0x75, 0xB8, 0x6D, 0x6C, 0x6E, 0x62, 0x36, 0x94, 0xBA, 0x22, 0xD2, 0xC2, 0x6F,
+    /*290:*/ 0xF3, 0xB4, 0xA2, 0xB3, 0x8C, 0x79, 0x58, 0xE3, 0x22, 0xBF, 0xDB, 0x25, 0xCF, 0x49, 0xF3, 0x4D,
+    /*2A0:*/ 0xE8, 0x6C, 0xE0, 0x7E, 0x83, 0xE9, 0xF2, 0x26, 0x94, 0x04, 0xD5, 0xFD, 0xFF, 0xB1, 0x23, 0xF2,
+    /*2B0:*/ 0xA7, 0x79, 0xE5, 0xFA, 0xF8, 0xDB, 0x3B, 0xF9, 0xF0, 0x07, 0xD2, 0xF7, 0x2F, 0x69, 0x12, 0x48,
+    /*2C0:*/ 0x5F, 0x9D, 0xC2, 0x5A, 0xCF, 0xE3, 0x2B, 0x44, 0x7D, 0x03, 0x55, 0xEC, 0x5D, 0x70,
+};
+
+// keyboard.jpg
+#define IMG_KEYBOARD_Z_SIZE (0x459)
+
+const uint32_t img_keyboard_z_size = IMG_KEYBOARD_Z_SIZE;
+const uint8_t __flash__ img_keyboard_z[]; // forward declaration.
+const uint8_t __flash__ *img_keyboard_z_data = img_keyboard_z;
+
+const uint8_t __flash__ img_keyboard_z[IMG_KEYBOARD_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0xCD, 0x58, 0x2D, 0x68, 0x23, 0x41, 0x14, 0x1E, 0x11, 0xB1, 0xE2, 0x44, 0xC4, 0x89,
+    /*010:*/ 0x95, 0xB3, 0x10, 0x71, 0x81, 0x33, 0x75, 0x17, 0xA8, 0x49, 0xA1, 0xA6, 0x70, 0xA2, 0x85, 0x13,
+    /*020:*/ 0x2D, 0x9C, 0x58, 0x4A, 0x45, 0x39, 0x55, 0x51, 0x51, 0x8E, 0x98, 0x70, 0x54, 0x94, 0xA8, 0x10,
+    /*030:*/ 0x4E, 0x94, 0xB2, 0xA2, 0x70, 0xA6, 0x50, 0x53, 0x68, 0x45, 0x20, 0x6B, 0x02, 0x3D, 0x51, 0x88,
+    /*040:*/ 0x29, 0x24, 0xA2, 0xD0, 0x27, 0x22, 0x22, 0x4E, 0x44, 0x54, 0xAC, 0x38, 0x31, 0x97, 0x97, 0xC9,
+    /*050:*/ 0xEC, 0x9B, 0x9D, 0xFD, 0xC9, 0xA6, 0x3D, 0x9A, 0xCE, 0x90, 0x4D, 0xF3, 0x3A, 0xEF, 0xCD, 0xB7,
+    /*060:*/ 0xEF, 0xE7, 0x9B, 0xB7, 0x0B, 0x42, 0x08, 0xFB, 0xF6, 0x6E, 0x67, 0x68, 0xD7, 0x8B, 0x43, 0xFB,
+    /*070:*/ 0xBC, 0xF8, 0xFA, 0x53, 0xEE, 0x5B, 0x9F, 0xFC, 0x55, 0x72, 0x4E, 0xB6, 0xEC, 0x5B, 0x31, 0x1D,
+    /*080:*/ 0xCD, 0x16, 0x67, 0x38, 0xE4, 0xF5, 0xF5, 0x87, 0xDC, 0xB7, 0x6A, 0xA9, 0xFD, 0xAF, 0x5A, 0x42,
+    /*090:*/ 0x0C, 0x3A, 0xEA, 0x3F, 0x7C, 0x69, 0xC8, 0xD4, 0xAE, 0x55, 0x4B, 0x7E, 0x0F, 0x3A, 0xFB, 0x1B,
+    /*0A0:*/ 0xEC, 0x4D, 0x0C, 0xF2, 0x09, 0x67, 0xA3, 0x0A, 0x67, 0x7C, 0x89, 0x5E, 0x4A, 0x8E, 0x93, 0x8E,
+    /*0B0:*/ 0xE5, 0xEB, 0x78, 0x59, 0xB3, 0x36, 0x5E, 0x1D, 0xD5, 0x26, 0xDF, 0x26, 0x42, 0xBC, 0x8A, 0xA5,
+    /*0C0:*/ 0x0D, 0x3F, 0xC0, 0x2B, 0x88, 0x24, 0x4F, 0x82, 0x58, 0xF6, 0x48, 0x42, 0x15, 0xC5, 0xEE, 0x07,
+    /*0D0:*/ 0x5E, 0x80, 0xF8, 0x75, 0x29, 0x4C, 0x7F, 0xCB, 0x3B, 0x23, 0x19, 0x7E, 0xE4, 0xBD, 0xCA, 0x2B,
+    /*0E0:*/ 0x4E, 0x2F, 0x20, 0x89, 0x6E, 0x4F, 0x0D, 0xD0, 0xEC, 0x91, 0x24, 0x1B, 0x55, 0xBD, 0xC8, 0x67,
+    /*0F0:*/ 0x75, 0x4A, 0x08, 0xD8, 0xAC, 0x2A, 0xAA, 0x16, 0xED, 0x2F, 0x65, 0xD1, 0xE8, 0xA3, 0x96, 0xE4,
+    /*100:*/ 0x1E, 0xDD, 0x1E, 0x4A, 0x92, 0xED, 0xB9, 0x16, 0xE1, 0xE2, 0x73, 0x50, 0x29, 0x99, 0xB2, 0xE2,
+    /*110:*/ 0x07, 0x4A, 0xA3, 0x5E, 0x54, 0x36, 0xFC, 0x80, 0xB2, 0x12, 0x62, 0x51, 0xE0, 0x93, 0xEA, 0x31,
+    /*120:*/ 0xED, 0xF1, 0xD0, 0x9E, 0x17, 0xA8, 0x75, 0x84, 0x2A, 0xDB, 0x57, 0x20, 0x88, 0x67, 0x6B, 0x63,
+    /*130:*/ 0x15, 0x95, 0x74, 0x2B, 0x51, 0xBF, 0x90, 0x3D, 0x85, 0x80, 0xEC, 0x71, 0xA6, 0x22, 0xEB, 0x1B,
+    /*140:*/ 0xA8, 0xE4, 0x5A, 0x96, 0xCB, 0x57, 0x5C, 0x43, 0xCA, 0x42, 0x5F, 0x81, 0x26, 0xE3, 0x31, 0x5D,
+    /*150:*/ 0x19, 0x79, 0xCE, 0xF4, 0x68, 0x91, 0xEF, 0x29, 0xD3, 0xC8, 0xA7, 0x7E, 0x90, 0x27, 0xAF, 0x40,
+    /*160:*/ 0x94, 0x9C, 0x7A, 0x51, 0x4E, 0xE5, 0x2B, 0x3F, 0xE8, 0xDA, 0xDD, 0xE9, 0xD9, 0x5D, 0x70, 0x74,
+    /*170:*/ 0x9F, 0xBA, 0xD6, 0x79, 0xB1, 0x6B, 0x57, 0x2D, 0x08, 0x73, 0x7B, 0x68, 0xBB, 0x16, 0x9E, 0xB4,
+    /*180:*/ 0x5C, 0x8B, 0x3E, 0xDA, 0x43, 0xDD, 0xAE, 0xAD, 0x10, 0x78, 0xA1, 0xBD, 0xF5, 0xB2, 0x6E, 0x2F,
+    /*190:*/ 0xCB, 0x57, 0x42, 0xE8, 0x15, 0x94, 0xF4, 0x1B, 0x52, 0x57, 0xCD, 0x63, 0x25, 0xD3, 0x86, 0xAF,
+    /*1A0:*/ 0x55, 0x6B, 0x76, 0x04, 0x4D, 0x4D, 0xC8, 0xB1, 0x3B, 0x2C, 0x80, 0x30, 0x6D, 0x6D, 0x36, 0xAA,
+    /*1B0:*/ 0x76, 0x7F, 0xBB, 0xD7, 0xEE, 0x7F, 0xBA, 0x6D, 0xF7, 0x49, 0x76, 0xDA, 0x3F, 0xEA, 0xE1, 0x7C,
+    /*1C0:*/ 0x78, 0x24, 0xD9, 0xC3, 0xE3, 0x51, 0x6F, 0x7B, 0x32, 0x95, 0x0C, 0x77, 0xFA, 0xFB, 0x78, 0x3A,
+    /*1D0:*/ 0xD1, 0x8C, 0xAE, 0x3B, 0x9D, 0xD8, 0x3B, 0x35, 0xEC, 0xB5, 0xFB, 0xA8, 0x7B, 0xD4, 0xD3, 0x65,
+    /*1E0:*/ 0xD9, 0xA8, 0x64, 0x7C, 0x31, 0x63, 0xBD, 0xC0, 0xCC, 0x76, 0x5C, 0xA7, 0x62, 0xA1, 0x4E, 0xAC,
+    /*1F0:*/ 0xAA, 0xE5, 0x05, 0x71, 0xCB, 0x10, 0xAE, 0x73, 0xAD, 0x78, 0x5D, 0x52, 0xB6, 0x93, 0xDF, 0xD2,
+    /*200:*/ 0x51, 0xA1, 0x1E, 0xD5, 0x8C, 0x17, 0x66, 0xA7, 0xAA, 0xB6, 0xF3, 0x90, 0xAF, 0x14, 0xE7, 0xF0,
+    /*210:*/ 0x48, 0xA5, 0x90, 0x3D, 0xE2, 0x77, 0x9D, 0xAF, 0x64, 0xF4, 0x6A, 0x63, 0x16, 0xF6, 0x54, 0x49,
+    /*220:*/ 0xBA, 0x49, 0xBE, 0xE2, 0x61, 0x6F, 0x18, 0xF7, 0x81, 0xAC, 0x37, 0xB3, 0x92, 0x75, 0xCE, 0xE1,
+    /*230:*/ 0x1A, 0x0B, 0x40, 0xE8, 0x7B, 0x1E, 0x61, 0x06, 0x10, 0x51, 0x54, 0x8B, 0xF0, 0x15, 0xA1, 0xF2,
+    /*240:*/ 0x02, 0x55, 0xB5, 0x6E, 0xE4, 0xDE, 0x88, 0xAF, 0x20, 0x76, 0x6A, 0xAC, 0x8E, 0xD4, 0xCA, 0x73,
+    /*250:*/ 0xED, 0xAC, 0x80, 0x98, 0x3D, 0x3A, 0x5D, 0x79, 0x26, 0x5F, 0x8D, 0x2A, 0x7B, 0xE5, 0xA1, 0x5D,
+    /*260:*/ 0x72, 0x8E, 0x57, 0xA8, 0x62, 0xD6, 0xCB, 0x25, 0x67, 0x7D, 0x22, 0x1D, 0x55, 0x08, 0xC1, 0x5E,
+    /*270:*/ 0xB9, 0xE0, 0x94, 0x9C, 0x82, 0x83, 0x32, 0xB5, 0xD2, 0x5A, 0x43, 0x49, 0x61, 0xA6, 0x2B, 0xA5,
+    /*280:*/ 0xBF, 0x2B, 0xA8, 0xB9, 0x5E, 0x3E, 0x5E, 0x21, 0xFF, 0xA1, 0xBD, 0x92, 0x23, 0xED, 0xE5, 0x8B,
+    /*290:*/ 0x20, 0xE5, 0x1F, 0xA4, 0xB2, 0x45, 0x5E, 0x06, 0x98, 0xA7, 0xA7, 0x33, 0xDF, 0x7C, 0xBE, 0x82,
+    /*2A0:*/ 0x14, 0xEE, 0x84, 0x1C, 0xF6, 0x45, 0x2E, 0xFE, 0x8D, 0x6B, 0x64, 0xA3, 0xBA, 0x3F, 0x6B, 0xB6,
+    /*2B0:*/ 0x0E, 0x1A, 0xCD, 0xD6, 0x55, 0x8B, 0xF4, 0xAE, 0x5A, 0xCD, 0x16, 0x4A, 0x9F, 0xCE, 0x84, 0x26,
+    /*2C0:*/ 0xC3, 0x55, 0x9B, 0x8D, 0x7B, 0x4D, 0xF6, 0x74, 0xB6, 0xD9, 0x38, 0x68, 0xE0, 0x6A, 0xD3, 0x1E,
+    /*2D0:*/ 0x4A, 0xC9, 0x5E, 0x73, 0x66, 0xEF, 0xFD, 0x2F, 0x58, 0x80, 0xAF, 0x54, 0xCD, 0x80, 0xD1, 0xC9,
+    /*2E0:*/ 0xC8, 0x9A, 0x81, 0x48, 0x37, 0x22, 0x75, 0x21, 0xAC, 0x4B, 0x1E, 0xC9, 0x6C, 0x3D, 0xDB, 0x95,
+    /*2F0:*/ 0x3D, 0x62, 0x1A, 0xD5, 0x01, 0xC0, 0xDC, 0xFE, 0xCA, 0xB5, 0x24, 0x3F, 0xF2, 0x59, 0x27, 0xA3,
+    /*300:*/ 0xD7, 0x16, 0xF1, 0x8B, 0x1F, 0xA4, 0x77, 0x32, 0x3C, 0xC2, 0x98, 0xAE, 0x25, 0x2B, 0xAE, 0x6A,
+    /*310:*/ 0xD1, 0x89, 0xAD, 0x56, 0xB9, 0x96, 0xCE, 0xA2, 0x7C, 0x2E, 0xB7, 0xEB, 0xCC, 0xE0, 0x27, 0x30,
+    /*320:*/ 0x83, 0x1F, 0x24, 0xE9, 0x92, 0xAC, 0x36, 0xA6, 0xBB, 0x64, 0x91, 0xFE, 0x4A, 0x24, 0xB2, 0xE8,
+    /*330:*/ 0xBC, 0x08, 0xD2, 0x09, 0xA1, 0xEE, 0xC2, 0x7B, 0x06, 0xAA, 0xE4, 0xFE, 0xCA, 0x8C, 0x60, 0x3E,
+    /*340:*/ 0x54, 0x90, 0x91, 0xED, 0x98, 0xB1, 0x2A, 0xB3, 0xE5, 0x3A, 0x94, 0x34, 0x8D, 0xCC, 0x8E, 0x67,
+    /*350:*/ 0xFB, 0x55, 0x0B, 0x57, 0xA2, 0x3D, 0xAA, 0xBE, 0xE6, 0xCC, 0x1E, 0x56, 0x0F, 0xE4, 0xF2, 0x55,
+    /*360:*/ 0xBC, 0x7F, 0x82, 0x8C, 0x3E, 0x04, 0x52, 0xAA, 0x1E, 0x72, 0xF2, 0x5F, 0xDE, 0xBE, 0x7D, 0x71,
+    /*370:*/ 0x8E, 0xCC, 0x62, 0x30, 0xC8, 0xDD, 0x71, 0x65, 0xFB, 0xEA, 0xE6, 0xFA, 0xE6, 0xFA, 0xCB, 0xE5,
+    /*380:*/ 0xE1, 0xE5, 0xCD, 0xB5, 0x2E, 0x3B, 0xBC, 0xFC, 0x39, 0xFD, 0x2C, 0x36, 0xA5, 0x96, 0xBC, 0x0E,
+    /*390:*/ 0x3A, 0x84, 0x72, 0xD0, 0x91, 0xB6, 0x82, 0x4E, 0x5E, 0x6E, 0xC7, 0xEC, 0xE4, 0x29, 0xA7, 0xE9,
+    /*3A0:*/ 0x4B, 0x06, 0x32, 0x83, 0x99, 0xED, 0xEA, 0x74, 0x56, 0xBD, 0x4A, 0x7A, 0x04, 0xB9, 0xC6, 0x84,
+    /*3B0:*/ 0x59, 0xCF, 0x1F, 0x8B, 0x21, 0x32, 0xBB, 0x3E, 0x1E, 0x61, 0x60, 0x91, 0x83, 0x45, 0x4D, 0x7E,
+    /*3C0:*/ 0x81, 0x17, 0xA1, 0x22, 0x1E, 0x27, 0xA6, 0x61, 0x61, 0x1F, 0x9B, 0xE7, 0x69, 0x02, 0xFB, 0x5A,
+    /*3D0:*/ 0xF9, 0x44, 0xAF, 0x3F, 0x55, 0x26, 0xDF, 0xC7, 0xE2, 0xD8, 0xE2, 0xCF, 0xE2, 0x51, 0xBE, 0xCA,
+    /*3E0:*/ 0xE2, 0xF6, 0xCF, 0xDF, 0xF6, 0x37, 0x2E, 0xB6, 0x4E, 0xB6, 0xEE, 0x76, 0xA8, 0xA2, 0xFF, 0xEC,
+    /*3F0:*/ 0x5C, 0x6C, 0x49, 0xE9, 0x73, 0x26, 0xEA, 0xEE, 0x6F, 0xBC, 0xDB, 0x8D, 0xDB, 0xFB, 0xB8, 0x9B,
+    /*400:*/ 0xD4, 0xF3, 0x67, 0x3F, 0x79, 0x2D, 0xFE, 0x54, 0x95, 0x87, 0x41, 0x20, 0xA5, 0xF7, 0xFA, 0x1F,
+    /*410:*/ 0x7C, 0xF5, 0x7C, 0x6C, 0x26, 0xAF, 0xC6, 0xB9, 0x9D, 0x2A, 0x9E, 0x33, 0x77, 0xFA, 0x3E, 0xE7,
+    /*420:*/ 0xB5, 0xA7, 0xDC, 0x93, 0x47, 0x72, 0xEA, 0xC3, 0x1A, 0x4B, 0x7C, 0x4B, 0xBA, 0xBC, 0xF7, 0xDB,
+    /*430:*/ 0x8C, 0x8D, 0x2A, 0x41, 0x67, 0xF9, 0x78, 0xCC, 0x81, 0x67, 0x40, 0xF1, 0xC7, 0xDB, 0xC1, 0x83,
+    /*440:*/ 0xDE, 0x19, 0x7F, 0x57, 0xEF, 0x0B, 0xF0, 0x6D, 0x0F, 0xBD, 0x4B, 0x5B, 0x16, 0x22, 0xCE, 0xEA,
+    /*450:*/ 0x45, 0xF9, 0xDE, 0xE1, 0x1F, 0x6D, 0x03, 0xCA, 0xC0,
+};
+
+// refresh.jpg
+#define IMG_REFRESH_Z_SIZE (0x39F)
+
+const uint32_t img_refresh_z_size = IMG_REFRESH_Z_SIZE;
+const uint8_t __flash__ img_refresh_z[]; // forward declaration.
+const uint8_t __flash__ *img_refresh_z_data = img_refresh_z;
+
+const uint8_t __flash__ img_refresh_z[IMG_REFRESH_Z_SIZE]  __attribute__((aligned(4))) =
+{
+    /*000:*/ 0x78, 0xDA, 0x9D, 0x57, 0x3F, 0x68, 0xEA, 0x40, 0x1C, 0xBE, 0xA1, 0x43, 0x86, 0x37, 0x64, 0xE8,
+    /*010:*/ 0x90, 0xA1, 0xC3, 0x09, 0x1D, 0x2A, 0x38, 0x3C, 0xA1, 0x43, 0x03, 0x5D, 0x14, 0x1C, 0x0C, 0x38,
+    /*020:*/ 0xF4, 0x81, 0xC3, 0x13, 0x3A, 0x88, 0xBC, 0x41, 0x82, 0x83, 0x48, 0x87, 0x52, 0xBA, 0x88, 0x38,
+    /*030:*/ 0x85, 0x0E, 0x45, 0x1C, 0x8A, 0x38, 0x08, 0x76, 0x78, 0xA0, 0xC3, 0x03, 0x3B, 0x08, 0x76, 0x11,
+    /*040:*/ 0x74, 0x28, 0xF8, 0x86, 0x82, 0x1D, 0x0A, 0xDE, 0xE0, 0x90, 0xA1, 0x83, 0x43, 0x87, 0x0C, 0x1D,
+    /*050:*/ 0xF2, 0x7A, 0xDE, 0x8B, 0xB9, 0x4B, 0x2E, 0x17, 0xED, 0x4F, 0xA2, 0xE6, 0x72, 0xF7, 0xE5, 0x97,
+    /*060:*/ 0xEF, 0xBE, 0xDF, 0x9F, 0xD8, 0xB6, 0xC8, 0xDA, 0xD6, 0x81, 0x99, 0xED, 0xC5, 0x0A, 0x53, 0x75,
+    /*070:*/ 0xAC, 0x40, 0x00, 0x40, 0x42, 0x5A, 0x2A, 0xA6, 0x5A, 0xD2, 0xB3, 0xBD, 0x8F, 0x05, 0x5A, 0xCF,
+    /*080:*/ 0x40, 0x81, 0x6B, 0x91, 0xEF, 0x2A, 0x39, 0x7B, 0xB4, 0xEE, 0xE6, 0xB7, 0x0D, 0x53, 0x05, 0x6B,
+    /*090:*/ 0x83, 0x00, 0x02, 0xD6, 0x12, 0x92, 0xA9, 0xDE, 0x36, 0x86, 0x73, 0x1E, 0xE6, 0x70, 0x8E, 0xC7,
+    /*0A0:*/ 0x5D, 0x64, 0x44, 0x61, 0x5F, 0xCE, 0x62, 0x85, 0xB1, 0x42, 0x30, 0x83, 0x0D, 0x82, 0xB1, 0x92,
+    /*0B0:*/ 0xD1, 0x95, 0x09, 0xBB, 0x7A, 0xBF, 0xBB, 0x54, 0xC6, 0xCA, 0x7B, 0xCB, 0xFB, 0x04, 0x78, 0x46,
+    /*0C0:*/ 0x49, 0xAF, 0xCA, 0x5E, 0x0C, 0x3F, 0xAA, 0xF3, 0xBD, 0x17, 0xE9, 0x57, 0xDC, 0xF5, 0xB7, 0x8D,
+    /*0D0:*/ 0x84, 0x44, 0x46, 0xBD, 0x2C, 0x9C, 0x9A, 0x7B, 0x11, 0x91, 0x97, 0x80, 0xC3, 0x0B, 0x00, 0xF5,
+    /*0E0:*/ 0xF8, 0xF5, 0x0A, 0x23, 0x3C, 0xB7, 0xF2, 0x12, 0x19, 0x5D, 0x2A, 0x2C, 0xCB, 0x17, 0x3D, 0x18,
+    /*0F0:*/ 0xC2, 0x00, 0xE0, 0xE0, 0x92, 0x7B, 0x2A, 0x93, 0xE3, 0x2E, 0x39, 0xC3, 0xEB, 0x3B, 0x32, 0x8D,
+    /*100:*/ 0xBB, 0xDF, 0x75, 0xEE, 0x08, 0x76, 0xC4, 0x27, 0x86, 0x39, 0x74, 0x58, 0xAA, 0xCA, 0x2E, 0x0F,
+    /*110:*/ 0xCD, 0x41, 0x5E, 0xE2, 0x63, 0x76, 0xE4, 0xA3, 0x64, 0xBF, 0x72, 0x66, 0x94, 0x3F, 0x3F, 0xFD,
+    /*120:*/ 0x4A, 0x51, 0x23, 0x7B, 0x2B, 0x36, 0xCC, 0x06, 0xC1, 0xFE, 0x58, 0x40, 0x4A, 0x5D, 0x70, 0x73,
+    /*130:*/ 0x1C, 0x25, 0x9B, 0x83, 0xB6, 0xD5, 0xB6, 0xD0, 0x46, 0xA1, 0xF8, 0x4C, 0x99, 0x14, 0x35, 0xF1,
+    /*140:*/ 0x53, 0x75, 0x64, 0xAC, 0x5C, 0x8C, 0x8D, 0xF7, 0x0D, 0x7A, 0xF6, 0xFD, 0x57, 0xD4, 0x1A, 0x21,
+    /*150:*/ 0x9F, 0xD2, 0x5D, 0xBD, 0xA7, 0xA2, 0x50, 0x88, 0x8C, 0x67, 0xDD, 0x54, 0xBC, 0x11, 0x51, 0x95,
+    /*160:*/ 0x33, 0xBA, 0xE3, 0x25, 0x0A, 0x8C, 0xB1, 0x8C, 0x4F, 0x9F, 0x2C, 0xF2, 0xCF, 0x59, 0x55, 0x86,
+    /*170:*/ 0x9E, 0xBD, 0xC0, 0x4A, 0x47, 0xC2, 0x88, 0x25, 0xBF, 0x45, 0x2D, 0x2F, 0xF1, 0xA2, 0x14, 0x23,
+    /*180:*/ 0xA3, 0xCF, 0x3B, 0x7B, 0x95, 0xB4, 0xDF, 0xB5, 0x05, 0xDE, 0x3A, 0x0C, 0x3A, 0xFA, 0x85, 0x1C,
+    /*190:*/ 0xC6, 0x31, 0xF2, 0xE5, 0xCC, 0xD9, 0x6B, 0xA2, 0xC6, 0x84, 0x54, 0xD2, 0x83, 0x73, 0x0C, 0x7D,
+    /*1A0:*/ 0xC7, 0x3F, 0x0D, 0xB8, 0xD1, 0x33, 0xE0, 0xF8, 0x5C, 0x36, 0xD8, 0x51, 0xA2, 0x17, 0xC4, 0xE4,
+    /*1B0:*/ 0x11, 0xDE, 0x3E, 0x1E, 0x77, 0x83, 0x38, 0x26, 0xC8, 0x6D, 0x8B, 0xE4, 0x33, 0x17, 0xFB, 0x64,
+    /*1C0:*/ 0x82, 0x02, 0x3C, 0xA5, 0xB9, 0x0E, 0x56, 0xBF, 0x83, 0x7C, 0x60, 0xB2, 0x57, 0xA5, 0xA4, 0xBD,
+    /*1D0:*/ 0x85, 0x21, 0xFB, 0x3E, 0x2E, 0x8E, 0x94, 0xB1, 0x72, 0xDC, 0x65, 0x47, 0x1E, 0x06, 0xA2, 0x6C,
+    /*1E0:*/ 0xEE, 0x22, 0xA7, 0x35, 0x31, 0x72, 0x51, 0x8B, 0x15, 0xBC, 0xEC, 0x84, 0xA3, 0xE2, 0xE3, 0x7C,
+    /*1F0:*/ 0x55, 0xD4, 0x52, 0xD1, 0xA9, 0x5A, 0x8F, 0xF3, 0x3E, 0x69, 0x6D, 0x38, 0x9F, 0xAA, 0x34, 0x4F,
+    /*200:*/ 0x69, 0x0D, 0x67, 0xC3, 0x30, 0xAF, 0x11, 0x15, 0x89, 0xC1, 0x0A, 0x5A, 0x32, 0xD9, 0xA5, 0x5F,
+    /*210:*/ 0x41, 0x9C, 0x39, 0x41, 0x6B, 0xC5, 0xC6, 0xEE, 0xEC, 0x99, 0xB1, 0x9D, 0xC7, 0x6C, 0xC4, 0xF0,
+    /*220:*/ 0xAF, 0xB3, 0xBC, 0x97, 0x0D, 0x14, 0xEA, 0x17, 0xB2, 0xC5, 0xF1, 0xE9, 0xCC, 0xE1, 0xF9, 0x6C,
+    /*230:*/ 0x6F, 0x89, 0x2E, 0x7E, 0xB2, 0x20, 0x9E, 0xB7, 0xE3, 0x32, 0xA8, 0xB3, 0xC0, 0x36, 0x55, 0x69,
+    /*240:*/ 0xE4, 0xA3, 0x24, 0xC9, 0xF1, 0xC1, 0xF3, 0xC5, 0xFE, 0xD3, 0xFF, 0xDD, 0x3C, 0x07, 0xD7, 0xD9,
+    /*250:*/ 0x93, 0xD4, 0xE0, 0x47, 0x6B, 0x17, 0x7F, 0xF9, 0x1C, 0x79, 0x63, 0xB0, 0x39, 0x08, 0x56, 0x6A,
+    /*260:*/ 0x38, 0x3A, 0xBD, 0xEA, 0x63, 0x91, 0x90, 0x68, 0x64, 0x9C, 0x37, 0x9C, 0xEC, 0xBB, 0x0B, 0xDB,
+    /*270:*/ 0xBC, 0x2A, 0xC1, 0x32, 0x0D, 0x00, 0x5B, 0xFB, 0xBE, 0xEA, 0x31, 0xB6, 0xB2, 0xC1, 0x2A, 0xEF,
+    /*280:*/ 0x30, 0x82, 0x67, 0xA0, 0x1D, 0xF5, 0xC1, 0xEF, 0x1C, 0x69, 0xE5, 0xE1, 0xBB, 0x64, 0xF4, 0xDD,
+    /*290:*/ 0x7C, 0x5E, 0x5D, 0xDD, 0x54, 0x78, 0x8C, 0x20, 0x9B, 0xCD, 0x77, 0x18, 0xFD, 0xB9, 0xB5, 0x3D,
+    /*2A0:*/ 0xF2, 0x7B, 0x0B, 0xAF, 0x89, 0x15, 0x78, 0xD7, 0xEE, 0xE6, 0x1D, 0x19, 0xF8, 0x6A, 0x37, 0xAF,
+    /*2B0:*/ 0xFF, 0xF5, 0x33, 0xFC, 0xDC, 0x72, 0x2A, 0xE8, 0x5B, 0x8E, 0x37, 0x0F, 0xF7, 0x1B, 0xA4, 0xA7,
+    /*2C0:*/ 0x87, 0x9B, 0xFA, 0x5D, 0xD2, 0xDD, 0xA8, 0xE1, 0x57, 0xEF, 0xB6, 0xC5, 0x56, 0xFD, 0x58, 0x81,
+    /*2D0:*/ 0x37, 0xBF, 0x1E, 0xF7, 0x77, 0x99, 0x4B, 0xE5, 0xA2, 0x47, 0x67, 0x1F, 0xC4, 0x78, 0x9B, 0xED,
+    /*2E0:*/ 0xED, 0x45, 0xDC, 0x8E, 0x8D, 0x1C, 0x3C, 0xEC, 0x53, 0x13, 0x52, 0x1D, 0xAB, 0x6B, 0xA9, 0x28,
+    /*2F0:*/ 0xCD, 0x8B, 0xFD, 0xBF, 0xB3, 0x7B, 0x6F, 0x39, 0x9D, 0x17, 0x64, 0x56, 0xD4, 0xE3, 0xBC, 0xEA,
+    /*300:*/ 0xFC, 0x32, 0xA2, 0x63, 0x86, 0x8D, 0x9F, 0x54, 0xF4, 0x5B, 0xE1, 0x7B, 0x4D, 0xAE, 0xAD, 0xAE,
+    /*310:*/ 0xDE, 0x72, 0x58, 0xFF, 0xD0, 0x37, 0x07, 0xFF, 0xAF, 0xCA, 0xB8, 0x8A, 0xF2, 0xD4, 0x9E, 0xED,
+    /*320:*/ 0xE5, 0x25, 0xD6, 0x07, 0xF7, 0x17, 0x0A, 0xDF, 0x2B, 0xC8, 0x41, 0xB8, 0xE3, 0xDB, 0xCB, 0x48,
+    /*330:*/ 0xD4, 0x9D, 0x88, 0xDE, 0x31, 0xAA, 0xB2, 0x35, 0x12, 0xC7, 0xD6, 0xA9, 0xE9, 0x46, 0x3B, 0x0C,
+    /*340:*/ 0xC5, 0x73, 0xEC, 0x3E, 0x7E, 0x60, 0x86, 0x2B, 0xBF, 0x6D, 0x9D, 0x19, 0xD8, 0xF3, 0x84, 0x14,
+    /*350:*/ 0xFE, 0x46, 0x41, 0xBC, 0xFD, 0x7B, 0x85, 0xB6, 0x8E, 0xD7, 0xD7, 0x45, 0x46, 0x5F, 0x2A, 0xE1,
+    /*360:*/ 0x6F, 0x3F, 0x1D, 0xF9, 0x29, 0x77, 0x32, 0xD9, 0xB6, 0x7E, 0xB9, 0x91, 0x59, 0x36, 0xD2, 0x1A,
+    /*370:*/ 0x0C, 0x44, 0x35, 0xD5, 0xB2, 0x71, 0x39, 0xFB, 0x4A, 0xEE, 0x42, 0x6B, 0xD6, 0x87, 0xF3, 0x87,
+    /*380:*/ 0x81, 0x5C, 0xFB, 0xFD, 0x63, 0xAA, 0x1E, 0x46, 0x96, 0xCA, 0x61, 0xC4, 0x54, 0x9F, 0x72, 0x72,
+    /*390:*/ 0xAD, 0x39, 0x78, 0x5D, 0x5C, 0xAF, 0x90, 0x30, 0x47, 0xFF, 0x03, 0x89, 0x65, 0x2B, 0xF7,
+};
+
+#endif // EVE_UI_ASSETS_JPEG
@@ -216,6 +216,12 @@ uint8_t keyboard_layout = KEYBOARD_LAYOUT_PC_UK_ALPHA;
  */
 uint32_t keyboard_components = KEYBOARD_COMPONENTS_FULL;
 
+/**
+ * @brief Only key drawn when a highlighted key is drawn over a cached layout.
+ * @details Zero when every key is drawn.
+ */
+static uint8_t key_filter = 0;
+
 /**
  * @brief Map of ASCII codes assigned to tagged buttons.
  */
@@ -235,6 +241,20 @@ const uint8_t keymap_bot_row_us[] = KEYMAP_BOT_ROW_US;
 
 /* LOCAL FUNCTIONS / INLINES *******************************************************/
 
+static void draw_key(uint8_t tag, uint32_t colour,
+		int16_t x, int16_t y, int16_t w, int16_t h,
+		int16_t font, uint16_t options, const char *label)
+{
+	if ((key_filter) && (tag != key_filter))
+	{
+		return;
+	}
+
+	EVE_CMD_FGCOLOR(colour);
+	EVE_TAG(tag);
+	EVE_CMD_BUTTON(x, y, w, h, font, options, label);
+}
+
 static void draw_keypad(uint8_t key_code)
 {
 	uint32_t button_colour;
@@ -242,105 +262,79 @@ static void draw_keypad(uint8_t key_code)
 	if (keyboard_components & KEYBOARD_COMPONENTS_KEYPAD_CONTROL)
 	{
 		button_colour = (key_code == KEY_PRINT_SCREEN)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_PRINT_SCREEN); // Print Screen
-		EVE_CMD_BUTTON(
+		draw_key(KEY_PRINT_SCREEN, button_colour, // Print Screen
 				KEY_COL_KEYPAD(0), KEY_ROW_KEYPAD(0) + (KEY_HEIGHT_KEYPAD(1) * 1) / 6,
 				KEY_WIDTH_KEYPAD(1), (KEY_HEIGHT_KEYPAD(1) *2) / 3,
 				KEYBOARD_FONT, OPT_FLAT, "PrtScr");
 
 		button_colour = (key_state.Scroll)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_SCROLL_LOCK); // Scroll Lock
-		EVE_CMD_BUTTON(
+		draw_key(KEY_SCROLL_LOCK, button_colour, // Scroll Lock
 				KEY_COL_KEYPAD(1), KEY_ROW_KEYPAD(0) + (KEY_HEIGHT_KEYPAD(1) * 1) / 6,
 				KEY_WIDTH_KEYPAD(1), (KEY_HEIGHT_KEYPAD(1) *2) / 3,
 				KEYBOARD_FONT, OPT_FLAT, "ScrLock");
 
 		button_colour = (key_code == KEY_PAUSE)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_PAUSE); // Pause
-		EVE_CMD_BUTTON(
+		draw_key(KEY_PAUSE, button_colour, // Pause
 				KEY_COL_KEYPAD(2), KEY_ROW_KEYPAD(0) + (KEY_HEIGHT_KEYPAD(1) * 1) / 6,
 				KEY_WIDTH_KEYPAD(1), (KEY_HEIGHT_KEYPAD(1) *2) / 3,
 				KEYBOARD_FONT, OPT_FLAT, "Pause");
 
 		button_colour = (key_code == KEY_INSERT)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_INSERT); // Insert
-		EVE_CMD_BUTTON(
+		draw_key(KEY_INSERT, button_colour, // Insert
 				KEY_COL_KEYPAD(0), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Ins");
 
 		button_colour = (key_code == KEY_HOME)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_HOME); // Home
-		EVE_CMD_BUTTON(
+		draw_key(KEY_HOME, button_colour, // Home
 				KEY_COL_KEYPAD(1), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Home");
 
 		button_colour = (key_code == KEY_PAGE_UP)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_PAGE_UP); // Page Up
-		EVE_CMD_BUTTON(
+		draw_key(KEY_PAGE_UP, button_colour, // Page Up
 				KEY_COL_KEYPAD(2), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "PgUp");
 
 		button_colour = (key_code == KEY_DEL)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_DEL); // Delete
-		EVE_CMD_BUTTON(
+		draw_key(KEY_DEL, button_colour, // Delete
 				KEY_COL_KEYPAD(0), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Del");
 
 		button_colour = (key_code == KEY_END)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_END); // End
-		EVE_CMD_BUTTON(
+		draw_key(KEY_END, button_colour, // End
 				KEY_COL_KEYPAD(1), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "End");
 
 		button_colour = (key_code == KEY_PAGE_DOWN)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_PAGE_DOWN); // Page Down
-		EVE_CMD_BUTTON(
+		draw_key(KEY_PAGE_DOWN, button_colour, // Page Down
 				KEY_COL_KEYPAD(2), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "PgDn");
 
 		button_colour = (key_code == KEY_UP_ARROW)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_UP_ARROW); // Up Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEY_UP_ARROW, button_colour, // Up Arrow
 				KEY_COL_KEYPAD(1), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x02");
 
 		button_colour = (key_code == KEY_LEFT_ARROW)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_LEFT_ARROW); // Left Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEY_LEFT_ARROW, button_colour, // Left Arrow
 				KEY_COL_KEYPAD(0), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x01");
 
 		button_colour = (key_code == KEY_DOWN_ARROW)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_DOWN_ARROW); // Down Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEY_DOWN_ARROW, button_colour, // Down Arrow
 				KEY_COL_KEYPAD(1), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x04");
 
 		button_colour = (key_code == KEY_RIGHT_ARROW)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_RIGHT_ARROW); // Right Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEY_RIGHT_ARROW, button_colour, // Right Arrow
 				KEY_COL_KEYPAD(2), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x03");
@@ -348,9 +342,7 @@ static void draw_keypad(uint8_t key_code)
 	else
 	{
 		button_colour = (key_code==KEY_BACKSPACE)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_BACKSPACE); // Backspace
-		EVE_CMD_BUTTON(
+		draw_key(KEY_BACKSPACE, button_colour, // Backspace
 				KEY_COL_KEYPAD(8), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT,"\x01");
@@ -359,9 +351,7 @@ static void draw_keypad(uint8_t key_code)
 	if (keyboard_components & KEYBOARD_COMPONENTS_KEYPAD_CONTROL)
 	{
 		button_colour = (key_state.Numeric)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_NUMBER_LOCK); // Num Lock
-		EVE_CMD_BUTTON(
+		draw_key(KEY_NUMBER_LOCK, button_colour, // Num Lock
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Num");
@@ -370,42 +360,32 @@ static void draw_keypad(uint8_t key_code)
 	if (keyboard_components & KEYBOARD_COMPONENTS_KEYPAD_ARITH)
 	{
 		button_colour = (key_code == KEYPAD_DIV)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_DIV); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_DIV, button_colour, //
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "/");
 
 		button_colour = (key_code == KEYPAD_MUL)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_MUL); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_MUL, button_colour, //
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "*");
 
 		button_colour = (key_code == KEYPAD_MINUS)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_MINUS); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_MINUS, button_colour, //
 				KEY_COL_KEYPAD(7), KEY_ROW_KEYPAD(1),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "-");
 
 		button_colour = (key_code == KEYPAD_PLUS)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_PLUS); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_PLUS, button_colour, //
 				KEY_COL_KEYPAD(7), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(2),
 				KEYBOARD_FONT, OPT_FLAT, "+");
 	}
 
 	button_colour = (key_code == KEYPAD_ENTER)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEYPAD_ENTER); //
-	EVE_CMD_BUTTON(
+	draw_key(KEYPAD_ENTER, button_colour, //
 			KEY_COL_KEYPAD(7), KEY_ROW_KEYPAD(4),
 			KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(2),
 			KEYBOARD_FONT, OPT_FLAT, "Enter");
@@ -413,81 +393,61 @@ static void draw_keypad(uint8_t key_code)
 	if (key_state.Numeric)
 	{
 		button_colour = (key_code == KEYPAD_7)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_7); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_7, button_colour, //
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "7");
 
 		button_colour = (key_code == KEYPAD_8)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_8); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_8, button_colour, //
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "8");
 
 		button_colour = (key_code == KEYPAD_9)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_9); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_9, button_colour, //
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "9");
 
 		button_colour = (key_code == KEYPAD_4)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_4); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_4, button_colour, //
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "4");
 
 		button_colour = (key_code == KEYPAD_5)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_5); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_5, button_colour, //
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "5");
 
 		button_colour = (key_code == KEYPAD_6)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_6); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_6, button_colour, //
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "6");
 
 		button_colour = (key_code == KEYPAD_1)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_1); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_1, button_colour, //
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "1");
 
 		button_colour = (key_code == KEYPAD_2)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_2); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_2, button_colour, //
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "2");
 
 		button_colour = (key_code == KEYPAD_3)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_3); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_3, button_colour, //
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "3");
 
 		button_colour = (key_code == KEYPAD_0)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_0); //
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_0, button_colour, //
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(2), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "0");
@@ -495,9 +455,7 @@ static void draw_keypad(uint8_t key_code)
 		if (keyboard_components & KEYBOARD_COMPONENTS_KEYPAD_DOT)
 		{
 			button_colour = (key_code == KEYPAD_DOT)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-			EVE_CMD_FGCOLOR(button_colour);
-			EVE_TAG(KEYPAD_DOT); //
-			EVE_CMD_BUTTON(
+			draw_key(KEYPAD_DOT, button_colour, //
 					KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(5),
 					KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 					KEYBOARD_FONT, OPT_FLAT, ".");
@@ -506,89 +464,67 @@ static void draw_keypad(uint8_t key_code)
 	else
 	{
 		button_colour = (key_code == KEYPAD_7)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_7); // Home
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_7, button_colour, // Home
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Home");
 
 		button_colour = (key_code == KEYPAD_8)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_8); // Up Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_8, button_colour, // Up Arrow
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x02");
 
 		button_colour = (key_code == KEYPAD_9)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_9); // Page Up
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_9, button_colour, // Page Up
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(2),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "PgUp");
 
 		button_colour = (key_code == KEYPAD_4)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_4); // Left Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_4, button_colour, // Left Arrow
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x01");
 
 		button_colour = (key_code == KEYPAD_5)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_5); // Blank
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_5, button_colour, // Blank
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "");
 
 		button_colour = (key_code == KEYPAD_6)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_6); // Right Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_6, button_colour, // Right Arrow
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(3),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x03");
 
 		button_colour = (key_code == KEYPAD_1)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_1); // End
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_1, button_colour, // End
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "End");
 
 		button_colour = (key_code == KEYPAD_2)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_2); // Down Arrow
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_2, button_colour, // Down Arrow
 				KEY_COL_KEYPAD(5), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT_ALT, OPT_FLAT, "\x04");
 
 		button_colour = (key_code == KEYPAD_3)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_3); // Page Down
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_3, button_colour, // Page Down
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(4),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "PgDn");
 
 		button_colour = (key_code == KEYPAD_0)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_0); // Insert
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_0, button_colour, // Insert
 				KEY_COL_KEYPAD(4), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(2), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Ins");
 
 		button_colour = (key_code == KEYPAD_DOT)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEYPAD_DOT); // Delete
-		EVE_CMD_BUTTON(
+		draw_key(KEYPAD_DOT, button_colour, // Delete
 				KEY_COL_KEYPAD(6), KEY_ROW_KEYPAD(5),
 				KEY_WIDTH_KEYPAD(1), KEY_HEIGHT_KEYPAD(1),
 				KEYBOARD_FONT, OPT_FLAT, "Del");
@@ -603,9 +539,7 @@ static void draw_function_keys(uint8_t key_code)
 	if (keyboard_components & KEYBOARD_COMPONENTS_FUNCTION)
 	{
 		button_colour = (key_code == KEY_ESCAPE)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_ESCAPE); // Escape
-		EVE_CMD_BUTTON(
+		draw_key(KEY_ESCAPE, button_colour, // Escape
 				KEY_COL_ALPHA(0), KEY_ROW_ALPHA(0) + (KEY_HEIGHT_ALPHA * 1) / 6,
 				KEY_WIDTH_ALPHA(1), (KEY_HEIGHT_ALPHA *2) / 3,
 				KEYBOARD_FONT, OPT_FLAT, "Esc");
@@ -615,9 +549,7 @@ static void draw_function_keys(uint8_t key_code)
 			char name[4];
 			sprintf(name, "F%d", i);
 			button_colour = (key_code == (KEY_F1 + i))?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-			EVE_CMD_FGCOLOR(button_colour);
-			EVE_TAG(KEY_F1 + i); // F1 to F12
-			EVE_CMD_BUTTON(
+			draw_key(KEY_F1 + i, button_colour, // F1 to F12
 					KEY_COL_ALPHA(1 + i)
 					+ (i>4?(KEY_WIDTH_ALPHA(1) * 0.5):0)
 					+ (i>8?(KEY_WIDTH_ALPHA(1) * 0.5):0),
@@ -697,25 +629,19 @@ static void draw_extra(uint8_t key_code)
 			KEYBOARD_FONT, OPT_CENTERY,"Volume:");
 
 	button_colour = (key_code == KEY_VOLUME_MUTE)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_VOLUME_MUTE); // Volume mute
-	EVE_CMD_BUTTON(
+	draw_key(KEY_VOLUME_MUTE, button_colour, // Volume mute
 			KEY_COL_STATUS(1), KEY_ROW_STATUS(3),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Mute");
 
 	button_colour = (key_code == KEY_VOLUME_UP)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_VOLUME_UP); // Volume up
-	EVE_CMD_BUTTON(
+	draw_key(KEY_VOLUME_UP, button_colour, // Volume up
 			KEY_COL_STATUS(2), KEY_ROW_STATUS(3),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Up");
 
 	button_colour = (key_code == KEY_VOLUME_DOWN)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_VOLUME_DOWN); // Volume down
-	EVE_CMD_BUTTON(
+	draw_key(KEY_VOLUME_DOWN, button_colour, // Volume down
 			KEY_COL_STATUS(3), KEY_ROW_STATUS(3),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Down");
@@ -725,9 +651,7 @@ static void draw_extra(uint8_t key_code)
 			KEYBOARD_FONT, OPT_CENTERY,"Power:");
 
 	button_colour = (key_code == KEY_POWER)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_POWER); // Power sleep
-	EVE_CMD_BUTTON(
+	draw_key(KEY_POWER, button_colour, // Power sleep
 			KEY_COL_STATUS(1), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Sleep");
@@ -737,41 +661,31 @@ static void draw_extra(uint8_t key_code)
 			KEYBOARD_FONT, OPT_CENTERY,"Edit:");
 
 	button_colour = (key_code == KEY_CUT)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_CUT); // Cut
-	EVE_CMD_BUTTON(
+	draw_key(KEY_CUT, button_colour, // Cut
 			KEY_COL_STATUS(1), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Cut");
 
 	button_colour = (key_code == KEY_COPY)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_COPY); // Copy
-	EVE_CMD_BUTTON(
+	draw_key(KEY_COPY, button_colour, // Copy
 			KEY_COL_STATUS(2), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Copy");
 
 	button_colour = (key_code == KEY_PASTE)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_PASTE); // Paste
-	EVE_CMD_BUTTON(
+	draw_key(KEY_PASTE, button_colour, // Paste
 			KEY_COL_STATUS(3), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Paste");
 
 	button_colour = (key_code == KEY_UNDO)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_UNDO); // Undo
-	EVE_CMD_BUTTON(
+	draw_key(KEY_UNDO, button_colour, // Undo
 			KEY_COL_STATUS(4), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Undo");
 
 	button_colour = (key_code == KEY_REDO)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_REDO); // Redo
-	EVE_CMD_BUTTON(
+	draw_key(KEY_REDO, button_colour, // Redo
 			KEY_COL_STATUS(5), KEY_ROW_STATUS(4),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Redo");
@@ -781,17 +695,13 @@ static void draw_extra(uint8_t key_code)
 			KEYBOARD_FONT, OPT_CENTERY,"Other:");
 
 	button_colour = (key_code == KEY_FIND)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_FIND); // Find
-	EVE_CMD_BUTTON(
+	draw_key(KEY_FIND, button_colour, // Find
 			KEY_COL_STATUS(1), KEY_ROW_STATUS(5),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Find...");
 
 	button_colour = (key_code == KEY_HELP)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_HELP); // Help
-	EVE_CMD_BUTTON(
+	draw_key(KEY_HELP, button_colour, // Help
 			KEY_COL_STATUS(2), KEY_ROW_STATUS(5),
 			KEY_WIDTH_STATUS(1), KEY_HEIGHT_STATUS,
 			KEYBOARD_FONT, OPT_FLAT, "Help...");
@@ -878,51 +788,41 @@ static void draw_keyboard_fixed_keys(uint8_t key_code)
 	uint32_t button_colour;
 
 	button_colour = (key_code==KEY_BACKSPACE)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_BACKSPACE); // Backspace
-	EVE_CMD_BUTTON(
+	draw_key(KEY_BACKSPACE, button_colour, // Backspace
 			KEY_COL_ALPHA(13), KEY_ROW_ALPHA(1),
 			KEY_WIDTH_ALPHA(2), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT_ALT, OPT_FLAT,"\x01");
 
 	button_colour = (key_code==KEY_TAB)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_TAB); // Tab
 	if (key_state.ShiftL || key_state.ShiftR)
 	{
-		EVE_CMD_BUTTON(
+		draw_key(KEY_TAB, button_colour, // Tab
 				KEY_COL_ALPHA(0), KEY_ROW_ALPHA(2),
 				KEY_WIDTH_ALPHA(1.5), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT_ALT, OPT_FLAT,"\x05\x01");
 	}
 	else
 	{
-		EVE_CMD_BUTTON(
+		draw_key(KEY_TAB, button_colour, // Tab
 				KEY_COL_ALPHA(0), KEY_ROW_ALPHA(2),
 				KEY_WIDTH_ALPHA(1.5), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT_ALT, OPT_FLAT,"\x03\x05");
 	}
 
 	button_colour = (key_state.Caps)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_CAPS_LOCK); // Capslock
-	EVE_CMD_BUTTON(
+	draw_key(KEY_CAPS_LOCK, button_colour, // Capslock
 			KEY_COL_ALPHA(0), KEY_ROW_ALPHA(3),
 			KEY_WIDTH_ALPHA(1.75), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"CapsLock");
 
 	button_colour = (key_code==KEY_SPACE)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_SPACE); // Space
-	EVE_CMD_BUTTON(
+	draw_key(KEY_SPACE, button_colour, // Space
 			KEY_COL_ALPHA(4), KEY_ROW_ALPHA(5),
 			KEY_WIDTH_ALPHA(5.75), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT, "Space");
 
 	button_colour = (key_state.ShiftR)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_SHIFTR); // Shift Right
-	EVE_CMD_BUTTON(
+	draw_key(KEY_SHIFTR, button_colour, // Shift Right
 			KEY_COL_ALPHA(12.25), KEY_ROW_ALPHA(4),
 			KEY_WIDTH_ALPHA(2.75), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"Shift");
@@ -930,57 +830,43 @@ static void draw_keyboard_fixed_keys(uint8_t key_code)
 	if (keyboard_components & KEYBOARD_COMPONENTS_MODIFIERS)
 	{
 		button_colour = (key_state.CtrlL)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_CTRLL); // Ctrl Left
-		EVE_CMD_BUTTON(
+		draw_key(KEY_CTRLL, button_colour, // Ctrl Left
 				KEY_COL_ALPHA(0), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.5), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT,"Ctrl");
 
 		button_colour = (key_state.WinL)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_WINL); // Win Left
-		EVE_CMD_BUTTON(
+		draw_key(KEY_WINL, button_colour, // Win Left
 				KEY_COL_ALPHA(1.5), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT,"Gui");
 
 		button_colour = (key_state.Alt)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_ALT); // Alt Left
-		EVE_CMD_BUTTON(
+		draw_key(KEY_ALT, button_colour, // Alt Left
 				KEY_COL_ALPHA(2.75), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT,"Alt");
 
 		button_colour = (key_state.AltGr)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_ALTGR); // AltGr
-		EVE_CMD_BUTTON(
+		draw_key(KEY_ALTGR, button_colour, // AltGr
 				KEY_COL_ALPHA(9.75), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT,"AltGr");
 
 		button_colour = (key_state.WinR)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_WINR); // Win Right
-		EVE_CMD_BUTTON(
+		draw_key(KEY_WINR, button_colour, // Win Right
 				KEY_COL_ALPHA(11), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT, "Gui");
 
 		button_colour = (key_code==KEY_MENU)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_MENU); // Menu
-		EVE_CMD_BUTTON(
+		draw_key(KEY_MENU, button_colour, // Menu
 				KEY_COL_ALPHA(12.25), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT, "Menu");
 
 		button_colour = (key_state.CtrlR)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-		EVE_CMD_FGCOLOR(button_colour);
-		EVE_TAG(KEY_CTRLR); // Ctrl Right
-		EVE_CMD_BUTTON(
+		draw_key(KEY_CTRLR, button_colour, // Ctrl Right
 				KEY_COL_ALPHA(13.5), KEY_ROW_ALPHA(5),
 				KEY_WIDTH_ALPHA(1.5), KEY_HEIGHT_ALPHA,
 				KEYBOARD_FONT, OPT_FLAT, "Ctrl");
@@ -1004,9 +890,6 @@ static uint8_t draw_keys(int16_t x, int16_t y,
 		cmap = (uint8_t)scancodes[i];
 
 		button_colour = (cmap == (uint8_t)options)?KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_ALPHANUM;
-		EVE_CMD_FGCOLOR(button_colour);
-
-		EVE_TAG(cmap);
 
 		use_font = KEYBOARD_FONT;
 		if (cdisp >= 0x80)
@@ -1069,7 +952,7 @@ static uint8_t draw_keys(int16_t x, int16_t y,
 		}
 
 		str[0] = (char)cdisp;
-		EVE_CMD_BUTTON(
+		draw_key(cmap, button_colour,
 				x + KEY_COL_ALPHA(i), y,
 				KEY_WIDTH_ALPHA(1) , KEY_HEIGHT_ALPHA,
 				use_font, OPT_FLAT, str);
@@ -1084,17 +967,13 @@ static void draw_fixed_keys_uk_de(uint8_t key_code)
 	uint32_t button_colour;
 
 	button_colour = (key_code==KEY_ENTER)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_ENTER); // Enter
-	EVE_CMD_BUTTON(
+	draw_key(KEY_ENTER, button_colour, // Enter
 			KEY_COL_ALPHA(13.75), KEY_ROW_ALPHA(2),
 			KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA * 2 + KEY_SPACER_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"Enter");
 
 	button_colour = (key_state.ShiftL)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_SHIFTL); // Shift Left
-	EVE_CMD_BUTTON(
+	draw_key(KEY_SHIFTL, button_colour, // Shift Left
 			KEY_COL_ALPHA(0), KEY_ROW_ALPHA(4),
 			KEY_WIDTH_ALPHA(1.25), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"Shift");
@@ -1210,17 +1089,13 @@ static void draw_us_keyboard(uint8_t key_code)
 	uint8_t offset = 1;
 
 	button_colour = (key_code==KEY_ENTER)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_ENTER); // Enter
-	EVE_CMD_BUTTON(
+	draw_key(KEY_ENTER, button_colour, // Enter
 			KEY_COL_ALPHA(12.75), KEY_ROW_ALPHA(3),
 			KEY_WIDTH_ALPHA(2.25), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"Enter");
 
 	button_colour = (key_state.ShiftL)? KEY_COLOUR_HIGHLIGHT:KEY_COLOUR_CONTROL;
-	EVE_CMD_FGCOLOR(button_colour);
-	EVE_TAG(KEY_SHIFTL); // Shift Left
-	EVE_CMD_BUTTON(
+	draw_key(KEY_SHIFTL, button_colour, // Shift Left
 			KEY_COL_ALPHA(0), KEY_ROW_ALPHA(4),
 			KEY_WIDTH_ALPHA(2.25), KEY_HEIGHT_ALPHA,
 			KEYBOARD_FONT, OPT_FLAT,"Shift");
@@ -1271,6 +1146,61 @@ static void draw_us_keyboard(uint8_t key_code)
 	draw_keyboard_fixed_keys(key_code);
 }
 
+static void draw_keyboard_layout(uint8_t key_code)
+{
+	if (keyboard_screen == KEYBOARD_SCREEN_ALPHANUMERIC)
+	{
+		if (keyboard_layout == KEYBOARD_LAYOUT_PC_UK_ALPHA)
+		{
+			draw_uk_keyboard(key_code);
+		}
+		else if (keyboard_layout == KEYBOARD_LAYOUT_PC_US_ALPHA)
+		{
+			draw_us_keyboard(key_code);
+		}
+		else if (keyboard_layout == KEYBOARD_LAYOUT_PC_DE_ALPHA)
+		{
+			draw_de_keyboard(key_code);
+		}
+	}
+#ifdef USE_EXTRA_SCREEN
+	else if (keyboard_screen == KEYBOARD_SCREEN_EXTRA)
+	{
+		draw_extra(key_code);
+	}
+#endif // USE_EXTRA_SCREEN
+	else if (keyboard_screen == KEYBOARD_SCREEN_KEYPAD)
+	{
+		draw_keypad(key_code);
+	}
+}
+
+static void draw_keyboard_cached(uint32_t key)
+{
+	// Cached layouts have no highlighted key.
+	(void)key;
+	draw_keyboard_layout(0);
+}
+
+static uint32_t keyboard_cache_key(void)
+{
+	uint16_t state;
+
+	// Everything which changes the appearance of the layout. Shift and
+	// Caps Lock change the key labels, the others are highlighted.
+	state = (key_state.ShiftL << 0) | (key_state.ShiftR << 1)
+			| (key_state.CtrlL << 2) | (key_state.CtrlR << 3)
+			| (key_state.Alt << 4) | (key_state.AltGr << 5)
+			| (key_state.WinL << 6) | (key_state.WinR << 7)
+			| (key_state.Caps << 8) | (key_state.Numeric << 9)
+			| (key_state.Scroll << 10);
+
+	return state
+			| ((uint32_t)keyboard_screen << 11)
+			| ((uint32_t)keyboard_layout << 13)
+			| ((keyboard_components & 0xffff) << 16);
+}
+
 static void draw_keyboard(const char *toast, uint32_t options, const char *edit, uint8_t key_code)
 {
 	// Display List start
@@ -1298,31 +1228,19 @@ static void draw_keyboard(const char *toast, uint32_t options, const char *edit,
 				| EVE_HEADER_KEYPAD_BUTTON));
 		eve_ui_header_bar(settings_options);
 	}
-	else if (keyboard_screen == KEYBOARD_SCREEN_ALPHANUMERIC)
+	else
 	{
-		if (keyboard_layout == KEYBOARD_LAYOUT_PC_UK_ALPHA)
+		// Layouts are replayed from the display list cache. A highlighted
+		// key is drawn again on top of its cached button.
+		eve_ui_dlcache_draw(EVE_DLCACHE_KEYBOARD, keyboard_cache_key(),
+				draw_keyboard_cached);
+		if (key_code)
 		{
-			draw_uk_keyboard(key_code);
-		}
-		else if (keyboard_layout == KEYBOARD_LAYOUT_PC_US_ALPHA)
-		{
-			draw_us_keyboard(key_code);
-		}
-		else if (keyboard_layout == KEYBOARD_LAYOUT_PC_DE_ALPHA)
-		{
-			draw_de_keyboard(key_code);
+			key_filter = key_code;
+			draw_keyboard_layout(key_code);
+			key_filter = 0;
 		}
 	}
-#ifdef USE_EXTRA_SCREEN
-	else if (keyboard_screen == KEYBOARD_SCREEN_EXTRA)
-	{
-		draw_extra(key_code);
-	}
-#endif // USE_EXTRA_SCREEN
-	else if (keyboard_screen == KEYBOARD_SCREEN_KEYPAD)
-	{
-		draw_keypad(key_code);
-	}
 
 	if (keyboard_screen != KEYBOARD_SCREEN_SETTINGS)
 	{
@@ -1363,7 +1281,6 @@ static void draw_keyboard(const char *toast, uint32_t options, const char *edit,
 	EVE_DISPLAY();
 	EVE_CMD_SWAP();
 	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
 }
 
 char __flash__ map_unshift[] = KEYDEMAP_UNSHIFT;
@@ -1709,6 +1626,7 @@ static uint16_t keyboard_input(char *toast, uint32_t options, char *buffer, uint
 	// Reset state of keyboard to known values
 	memset(&key_state, 0, sizeof(key_state));
 	key_state.Numeric = 1;
+	memset(&report_buffer_in, 0, sizeof(report_buffer_in));
 
 	count = strlen(buffer);
 	ptr = buffer + count;
@@ -1765,6 +1683,11 @@ static uint16_t keyboard_input(char *toast, uint32_t options, char *buffer, uint
 			{
 				return 0xff00 | rsp;
 			}
+			else
+			{
+				// Block until the touch state changes.
+				eve_ui_touch_wait();
+			}
 		}
 		*ptr = '\0';
 	}
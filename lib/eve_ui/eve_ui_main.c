@@ -53,6 +53,7 @@
 #include "HAL.h"
 
 #include "eve_ui.h"
+#include "eve_ui_assets.h"
 
 /**
  @brief Pointers to custom fonts in external C file.
@@ -73,8 +74,11 @@ extern const EVE_GPU_FONT_HEADER __flash__ *font1_hdr;
 
 /**
  @brief Allow click on the BridgeTek Logo to make a screenshot.
+ @details The screenshot is sent on the FT9xx debug UART.
  */
+#ifdef __FT32__
 #define ENABLE_SCREENSHOT
+#endif // __FT32__
 
 /* GLOBAL VARIABLES ****************************************************************/
 
@@ -98,18 +102,42 @@ uint32_t img_keyboard_width;
 uint32_t img_keyboard_height;
 //@}
 
+/* LOCAL VARIABLES *****************************************************************/
+
 /**
- @brief Free RAM_DL after custom images.
+ @brief Function used by input loops to wait for a touch event.
+ @details Set when the touch interrupt is enabled.
  */
-uint32_t img_end_address;
-
-
-/* LOCAL VARIABLES *****************************************************************/
+static eve_ui_touch_wait_t touch_wait = NULL;
 
 /* MACROS **************************************************************************/
 
+/**
+ @brief Select image data for the asset loader.
+ @details Define EVE_UI_ASSETS_JPEG to decode JPEG images with CMD_LOADIMAGE
+ instead of expanding compressed RGB565 images with CMD_INFLATE.
+ */
+#ifdef EVE_UI_ASSETS_JPEG
+#define IMG_DATA(a) img_##a##_data, img_##a##_size
+#else
+#define IMG_DATA(a) img_##a##_z_data, img_##a##_z_size
+#endif
+
 /* LOCAL FUNCTIONS / INLINES *******************************************************/
 
+static void load_image(uint32_t address, const uint8_t __flash__ *data, uint32_t size)
+{
+#ifdef EVE_UI_ASSETS_JPEG
+	// Send raw JPEG encoded image data to coprocessor. It will be decoded
+	// as the data is received.
+	EVE_CMD_LOADIMAGE(address, OPT_NODL);
+#else
+	// Compressed RGB565 image data is expanded as it is received.
+	EVE_CMD_INFLATE(address);
+#endif
+	eve_ui_arch_write_cmd_from_flash(data, size);
+}
+
 /* FUNCTIONS ***********************************************************************/
 
 void eve_ui_calibrate()
@@ -149,17 +177,63 @@ void eve_ui_calibrate()
 
 void eve_ui_load_images(void)
 {
+	uint32_t img_start_address;
 	uint32_t img_bridgetek_logo_address;
 	uint32_t img_settings_address;
 	uint32_t img_cancel_address;
 	uint32_t img_save_address;
-	uint32_t img_refresh_address;
 	uint32_t img_keypad_address;
 	uint32_t img_keyboard_address;
-	uint32_t dummy;
+	uint32_t img_refresh_address;
 
+	// Cached fragments refer to the images being loaded.
+	eve_ui_dlcache_invalidate(EVE_DLCACHE_ALL);
+
+	// Fonts and images are replaced if they are loaded again.
+	eve_ui_ramg_arena_reset();
+
+	// The font header holds absolute addresses so the font must be
+	// loaded at font0_offset.
+	eve_ui_ramg_arena_alloc(font0_offset + font0_size);
 	eve_ui_arch_write_ram_from_flash(font0_data, font0_size, font0_offset);
 
+	// Image sizes and positions are taken from the asset manifest so
+	// addresses do not depend on the results of earlier decodes.
+	img_start_address = eve_ui_ramg_arena_alloc(EVE_ASSET_IMAGES_SIZE);
+	img_bridgetek_logo_address = img_start_address + EVE_ASSET_BRIDGETEK_LOGO_OFFSET;
+	img_settings_address = img_start_address + EVE_ASSET_SETTINGS_OFFSET;
+	img_cancel_address = img_start_address + EVE_ASSET_CANCEL_OFFSET;
+	img_save_address = img_start_address + EVE_ASSET_SAVE_OFFSET;
+	img_keypad_address = img_start_address + EVE_ASSET_KEYPAD_OFFSET;
+	img_keyboard_address = img_start_address + EVE_ASSET_KEYBOARD_OFFSET;
+	img_refresh_address = img_start_address + EVE_ASSET_REFRESH_OFFSET;
+
+	img_bridgetek_logo_width = EVE_ASSET_BRIDGETEK_LOGO_WIDTH;
+	img_bridgetek_logo_height = EVE_ASSET_BRIDGETEK_LOGO_HEIGHT;
+	img_settings_width = EVE_ASSET_SETTINGS_WIDTH;
+	img_settings_height = EVE_ASSET_SETTINGS_HEIGHT;
+	img_cancel_width = EVE_ASSET_CANCEL_WIDTH;
+	img_cancel_height = EVE_ASSET_CANCEL_HEIGHT;
+	img_save_width = EVE_ASSET_SAVE_WIDTH;
+	img_save_height = EVE_ASSET_SAVE_HEIGHT;
+	img_keypad_width = EVE_ASSET_KEYPAD_WIDTH;
+	img_keypad_height = EVE_ASSET_KEYPAD_HEIGHT;
+	img_keyboard_width = EVE_ASSET_KEYBOARD_WIDTH;
+	img_keyboard_height = EVE_ASSET_KEYBOARD_HEIGHT;
+	img_refresh_width = EVE_ASSET_REFRESH_WIDTH;
+	img_refresh_height = EVE_ASSET_REFRESH_HEIGHT;
+
+	eve_ui_handle_reserve(FONT_CUSTOM_EXTENDED);
+	eve_ui_handle_reserve(BITMAP_BRIDGETEK_LOGO);
+	eve_ui_handle_reserve(BITMAP_SETTINGS);
+	eve_ui_handle_reserve(BITMAP_CANCEL);
+	eve_ui_handle_reserve(BITMAP_SAVE);
+	eve_ui_handle_reserve(BITMAP_REFRESH);
+	eve_ui_handle_reserve(BITMAP_KEYPAD);
+	eve_ui_handle_reserve(BITMAP_KEYBOARD);
+
+	// Load the font, decode all images and set up the bitmap handles in
+	// one co-processor list.
 	EVE_LIB_BeginCoProList();
 	EVE_CMD_DLSTART();
 	EVE_CLEAR(1,1,1);
@@ -174,137 +248,14 @@ void eve_ui_load_images(void)
 			font0_hdr->FontWidthInPixels,
 			font0_hdr->FontHeightInPixels);
 
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	img_bridgetek_logo_address = ((font0_size + font0_offset) + 16) & (~15);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_BRIDGETEK_LOGO);
-	EVE_CMD_LOADIMAGE(img_bridgetek_logo_address, 0);
-	// Send raw JPEG encoded image data to coprocessor. It will be decoded
-	// as the data is received.
-	eve_ui_arch_write_cmd_from_flash(img_bridgetek_logo_data, img_bridgetek_logo_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	// We know the start address in RAM so do not seek this information.
-	EVE_LIB_GetProps(&dummy,
-			// Obtain the width and height of the expanded JPEG image.
-			&img_bridgetek_logo_width, &img_bridgetek_logo_height);
-
-	img_settings_address = img_bridgetek_logo_address +
-			(img_bridgetek_logo_width * 2 * img_bridgetek_logo_height);
-	img_settings_address += 3;
-	img_settings_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_SETTINGS);
-	EVE_CMD_LOADIMAGE(img_settings_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_settings_data, img_settings_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_settings_width, &img_settings_height);
-
-	img_cancel_address = img_settings_address +
-			(img_settings_width * 2 * img_settings_height);
-	img_cancel_address += 3;
-	img_cancel_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_CANCEL);
-	EVE_CMD_LOADIMAGE(img_cancel_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_cancel_data, img_cancel_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_cancel_width, &img_cancel_height);
-
-	img_save_address = img_cancel_address +
-			(img_cancel_width * 2 * img_cancel_height);
-	img_save_address += 3;
-	img_save_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_SAVE);
-	EVE_CMD_LOADIMAGE(img_save_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_save_data, img_save_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_save_width, &img_save_height);
-
-	img_keypad_address = img_save_address +
-			(img_save_width * 2 * img_save_height);
-	img_keypad_address += 3;
-	img_keypad_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_KEYPAD);
-	EVE_CMD_LOADIMAGE(img_keypad_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_keypad_data, img_keypad_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_keypad_width, &img_keypad_height);
-
-	img_keyboard_address = img_keypad_address +
-			(img_keypad_width * 2 * img_keypad_height);
-	img_keyboard_address += 3;
-	img_keyboard_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_KEYBOARD);
-	EVE_CMD_LOADIMAGE(img_keyboard_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_keyboard_data, img_keyboard_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_keyboard_width, &img_keyboard_height);
-
-	img_refresh_address = img_keyboard_address +
-			(img_keyboard_width * 2 * img_keyboard_height);
-	img_refresh_address += 3;
-	img_refresh_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_BITMAP_HANDLE(BITMAP_REFRESH);
-	EVE_CMD_LOADIMAGE(img_refresh_address, 0);
-	eve_ui_arch_write_cmd_from_flash(img_refresh_data, img_refresh_size);
-	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
-
-	EVE_LIB_GetProps(&dummy,
-			&img_refresh_width, &img_refresh_height);
-
-	img_end_address = img_keypad_address +
-			(img_keypad_width * 2 * img_keypad_height);
-	img_end_address += 3;
-	img_end_address &= (~3);
-
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
+	// Expand each image into RAM_G. The display list entries are made below.
+	load_image(img_bridgetek_logo_address, IMG_DATA(bridgetek_logo));
+	load_image(img_settings_address, IMG_DATA(settings));
+	load_image(img_cancel_address, IMG_DATA(cancel));
+	load_image(img_save_address, IMG_DATA(save));
+	load_image(img_keypad_address, IMG_DATA(keypad));
+	load_image(img_keyboard_address, IMG_DATA(keyboard));
+	load_image(img_refresh_address, IMG_DATA(refresh));
 
 	EVE_BITMAP_HANDLE(BITMAP_BRIDGETEK_LOGO);
 	EVE_BEGIN(BITMAPS);
@@ -376,46 +327,65 @@ void eve_ui_load_images(void)
 	EVE_BITMAP_SIZE_H(img_keyboard_width >> 9, img_keyboard_height >> 9);
 	EVE_VERTEX2II(0, 0, BITMAP_KEYBOARD, 0);
 
+	EVE_DISPLAY();
 	EVE_CMD_SWAP();
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
+	EVE_LIB_AwaitFence(EVE_LIB_EndCoProList());
 }
 
 void eve_ui_screenshot()
 {
 #ifdef ENABLE_SCREENSHOT
-	uint8_t buffer[256];
-	int i, j;
-
-	CRITICAL_SECTION_BEGIN
+	static uint8_t buffer[1024];
+	uint16_t width, height;
+	uint16_t length;
+	int8_t err;
 
-	// Write screenshot into RAM_G
-	EVE_LIB_BeginCoProList();
-	EVE_CMD_DLSTART();
-	EVE_CMD_SNAPSHOT(img_end_address);
-	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
+	err = eve_ui_snapshot_start(&width, &height);
+	if (err != EVE_SNAPSHOT_OK)
+	{
+		eve_ui_splash("No memory for screenshot...", 0);
+		return;
+	}
 
-	printf("ARGB start\n"); // Use this marker to identify the start of the image.
-	for (i = 0; i < (EVE_DISP_WIDTH * 2) * EVE_DISP_HEIGHT; i += sizeof(buffer))
+	// Use this marker to identify the start of the image. Blocks of
+	// compressed pixels follow, each one after a 2 byte little-endian
+	// length. A zero length marks the end. Interrupts are left enabled
+	// so the rest of the system runs while the UART is busy.
+	printf("SCREENSHOT %d %d RGB565 RLE\n", width, height);
+	do
 	{
-		EVE_LIB_ReadDataFromRAMG(buffer, sizeof(buffer), img_end_address+ i);
-		for (j = 0; j < sizeof(buffer); j++)
+		err = eve_ui_snapshot_read(buffer, sizeof(buffer), &length);
+		if (err != EVE_SNAPSHOT_OK)
 		{
-			printf("%c", buffer[j]);
+			length = 0;
 		}
-	}
-	printf("ARGB end\n"); // Marker to identify the end of the image.
+		putchar(length & 0xff);
+		putchar(length >> 8);
+		fwrite(buffer, 1, length, stdout);
+	} while (length);
+	printf("SCREENSHOT END\n"); // Marker to identify the end of the image.
+	fflush(stdout);
 
-	eve_ui_splash("Screenshot completed...", 0);
-	delayms(2000);
+	eve_ui_snapshot_end();
 
-	CRITICAL_SECTION_END
+	eve_ui_splash((err == EVE_SNAPSHOT_OK) ? "Screenshot completed..." : "Screenshot failed...", 0);
+	delayms(2000);
 
 #endif // ENABLE_SCREENSHOT
 }
 
-void eve_ui_header_bar(uint32_t options)
+void eve_ui_copro_reset(void)
+{
+	HAL_ResetCmdFifo();
+
+	// The custom font is registered with the co-processor. The bitmap
+	// handle for it is display list state and is kept.
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_SETFONT(FONT_CUSTOM_EXTENDED, font0_offset);
+	EVE_LIB_AwaitFence(EVE_LIB_EndCoProList());
+}
+
+static void header_bar_draw(uint32_t options)
 {
 	uint32_t x = EVE_SPACER;
 
@@ -487,6 +457,13 @@ void eve_ui_header_bar(uint32_t options)
 	EVE_VERTEX_TRANSLATE_Y(0);
 }
 
+void eve_ui_header_bar(uint32_t options)
+{
+	// The header bar only changes with the options so is replayed from
+	// the display list cache.
+	eve_ui_dlcache_draw(EVE_DLCACHE_HEADER_BAR, options, header_bar_draw);
+}
+
 void eve_ui_play_sound(uint8_t sound, uint8_t volume)
 {
 	HAL_MemWrite8(REG_VOL_SOUND, volume);
@@ -494,17 +471,42 @@ void eve_ui_play_sound(uint8_t sound, uint8_t volume)
 	HAL_MemWrite8(REG_PLAY, 1);
 }
 
+void eve_ui_touch_int_init(eve_ui_touch_notify_t notify, eve_ui_touch_wait_t wait)
+{
+	touch_wait = wait;
+
+	// Touch detection and tag changes (including release) raise INT_N.
+	HAL_IntSetup(INT_TOUCH | INT_TAG, notify);
+}
+
+uint8_t eve_ui_touch_event(void)
+{
+	// Clears the interrupt so that the next event can be signalled.
+	return HAL_IntFlags() & (INT_TOUCH | INT_TAG);
+}
+
+void eve_ui_touch_wait(void)
+{
+	// Without the touch interrupt input loops poll continuously.
+	if (touch_wait)
+	{
+		touch_wait();
+		eve_ui_touch_event();
+	}
+}
+
 uint8_t eve_ui_read_tag(uint8_t *key)
 {
-	uint8_t Read_tag;
+	EVE_TOUCH_SNAPSHOT touch;
 	uint8_t key_detect = 0;
 
-	Read_tag = HAL_MemRead8(REG_TOUCH_TAG);
+	// Tag and touch coordinates are read together.
+	EVE_LIB_GetTouch(&touch, 0);
 
-	if (!(HAL_MemRead16(REG_TOUCH_RAW_XY) & 0x8000))
+	if (!(touch.raw_xy & 0x8000))
 	{
 		key_detect = 1;
-		*key = Read_tag;
+		*key = touch.tag & 0xff;
 	}
 
 	return key_detect;
@@ -524,7 +526,6 @@ void eve_ui_splash(char *toast, uint32_t options)
 	EVE_DISPLAY();
 	EVE_CMD_SWAP();
 	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
 }
 
 uint8_t eve_ui_key_check(void)
@@ -597,5 +598,11 @@ uint8_t eve_ui_key_check(void)
 		return TAG_KEYPAD;
 	}
 
+	if ((selection == TAG_PAGE_UP) || (selection == TAG_PAGE_DOWN))
+	{
+		// Paging TAGs will be picked up later.
+		return selection;
+	}
+
 	return 0;
 }
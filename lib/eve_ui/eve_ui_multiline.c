@@ -48,22 +48,12 @@
 #include <string.h>
 #include <ctype.h>
 
-#include <ft900.h>
-#include <ft900_dlog.h>
-
 #include "EVE_config.h"
 #include "EVE.h"
+#include "HAL.h"
 
 #include "eve_ui.h"
 
-/**
- @brief Link to datalogger area defined in crt0.S file.
- @details Must be passed to dlog library functions to initialise and use
-        datalogger functions. We use the datalogger area for persistent
-        configuration storage.
- */
-extern __flash__ uint32_t __dlog_partition[];
-
 /* CONSTANTS ***********************************************************************/
 
 /**
@@ -82,6 +72,26 @@ extern __flash__ uint32_t __dlog_partition[];
 #define ML_COLS (EVE_DISP_WIDTH / ML_FONT_MIN_WIDTH)
 
 #define ML_ROW(a) (ML_TOP + (ML_LINE_HEIGHT * a))
+#define ML_VISIBLE (ML_ROWS - 1)
+//@}
+
+/**
+ * @brief Scrollback history for multiline display.
+ * @details Each line is drawn once and the display list generated for it
+ * is kept in RAM_G. Lines are packed one after the other in an area of
+ * RAM_G allocated when the first line is added and replayed with
+ * CMD_APPEND. The oldest lines are discarded when either
+ * the RAM_G area or the line index is full.
+ * Added lines are queued and drawn together before the next redraw. The
+ * co-processor copies REG_CMD_DL after each one into the last words of
+ * the area so one fence wait finds the size of every queued line.
+ */
+//@{
+#define ML_HISTORY_LINES 512 // Must be a power of 2
+#define ML_PENDING_LINES 8
+#define ML_HISTORY_START ml_history_start
+#define ML_HISTORY_END (ml_history_start + EVE_RAM_G_HISTORY_SIZE - (ML_PENDING_LINES * 4))
+#define ML_PENDING_OFFSETS ML_HISTORY_END
 //@}
 
 /* GLOBAL VARIABLES ****************************************************************/
@@ -92,22 +102,180 @@ extern __flash__ uint32_t __dlog_partition[];
  @brief Variables used for Multi-line display.
  */
 //@{
-static char ml_display[ML_ROWS + 1][ML_COLS];
-static uint32_t ml_display_fmt[ML_ROWS + 1];
-static int ml_line = 0;
+static char ml_toast[ML_COLS];
 static uint32_t ml_options = 0;
 //@}
 
+/**
+ @brief Scrollback history index.
+ @details ml_history_head counts all lines ever added so the newest line is
+ at index (ml_history_head - 1) modulo ML_HISTORY_LINES. ml_view is the
+ number of lines the display is scrolled back from the newest line.
+ */
+//@{
+static struct ml_history_line
+{
+	uint32_t address;
+	uint16_t length;
+} ml_history[ML_HISTORY_LINES];
+static uint32_t ml_history_head = 0;
+static uint32_t ml_history_count = 0;
+static uint32_t ml_history_start = EVE_RAMG_NONE;
+static uint32_t ml_history_write = EVE_RAMG_NONE;
+static uint32_t ml_view = 0;
+//@}
+
+/**
+ @brief Lines added but not yet drawn into the history.
+ */
+//@{
+static struct ml_pending_line
+{
+	uint32_t format;
+	char text[ML_COLS];
+} ml_pending[ML_PENDING_LINES];
+static uint8_t ml_pending_count = 0;
+//@}
+
+/**
+ @brief Variables used to coalesce Multi-line display updates.
+ @details Added lines mark the display as dirty. It is redrawn at most
+ once per display frame as counted by REG_FRAMES.
+ */
+//@{
+static uint8_t ml_dirty = 0;
+static uint32_t ml_frame = 0;
+static uint32_t ml_stat_lines = 0;
+static uint32_t ml_stat_frames = 0;
+//@}
+
 /* MACROS **************************************************************************/
 
+#define ML_HISTORY(a) (&ml_history[(a) & (ML_HISTORY_LINES - 1)])
+#define ML_HISTORY_OLDEST() ML_HISTORY(ml_history_head - ml_history_count)
+
 /* LOCAL FUNCTIONS / INLINES *******************************************************/
 
+static void multiline_history_reserve(uint32_t length)
+{
+	uint32_t wrap;
+
+	// The line index is full.
+	if (ml_history_count == ML_HISTORY_LINES)
+	{
+		ml_history_count--;
+	}
+
+	if (ml_history_write + length > ML_HISTORY_END)
+	{
+		// Lines left at the end of the area are the oldest ones.
+		wrap = ml_history_write;
+		while ((ml_history_count) && (ML_HISTORY_OLDEST()->address >= wrap))
+		{
+			ml_history_count--;
+		}
+		ml_history_write = ML_HISTORY_START;
+	}
+
+	// Discard lines which will be overwritten.
+	while ((ml_history_count)
+			&& (ML_HISTORY_OLDEST()->address >= ml_history_write)
+			&& (ML_HISTORY_OLDEST()->address < ml_history_write + length))
+	{
+		ml_history_count--;
+	}
+}
+
+static void multiline_history_commit(void)
+{
+	struct ml_history_line *line;
+	uint32_t start, end, length;
+	uint8_t i;
+
+	if (ml_pending_count == 0)
+	{
+		return;
+	}
+
+	if (ml_history_start == EVE_RAMG_NONE)
+	{
+		ml_history_start = eve_ui_ramg_alloc(EVE_RAM_G_HISTORY_SIZE);
+		if (ml_history_start == EVE_RAMG_NONE)
+		{
+			// No room to keep the lines.
+			ml_pending_count = 0;
+			return;
+		}
+		ml_history_write = ml_history_start;
+	}
+
+	// Draw the queued lines one after the other at the top of a scratch
+	// display list. The offset in the display list after each line is
+	// copied to RAM_G so that a single wait covers all the lines.
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_DLSTART();
+	for (i = 0; i < ml_pending_count; i++)
+	{
+		EVE_COLOR(ml_pending[i].format);
+		EVE_CMD_TEXT(ML_SPACER, ML_LINE_HEIGHT / 2,
+						FONT_BODY, OPT_CENTERY, ml_pending[i].text);
+		EVE_CMD_MEMCPY(ML_PENDING_OFFSETS + (i * 4), REG_CMD_DL, 4);
+	}
+	EVE_LIB_AwaitFence(EVE_LIB_FlushCoProList());
+
+	// Copy the display list entries generated for each line into the
+	// history area. The space is reserved once the size is known.
+	start = 0;
+	for (i = 0; i < ml_pending_count; i++)
+	{
+		end = (HAL_MemRead32(ML_PENDING_OFFSETS + (i * 4)) + 3) & (~3);
+		length = end - start;
+		start = end;
+
+		if (length > ML_HISTORY_END - ML_HISTORY_START)
+		{
+			// Too large to keep the line.
+			continue;
+		}
+
+		multiline_history_reserve(length);
+
+		EVE_CMD_MEMCPY(ml_history_write, RAM_DL + end - length, length);
+
+		line = ML_HISTORY(ml_history_head);
+		line->address = ml_history_write;
+		line->length = length;
+
+		ml_history_write += length;
+		ml_history_head++;
+		ml_history_count++;
+
+		// Keep the same lines on screen if scrolled back.
+		if (ml_view)
+		{
+			eve_ui_multiline_scroll(1);
+		}
+	}
+	// The copies complete before any display list which follows.
+	EVE_LIB_EndCoProList();
+
+	ml_pending_count = 0;
+}
+
 /* FUNCTIONS ***********************************************************************/
 
 void eve_ui_multiline_display(void)
 {
+	struct ml_history_line *line;
+	uint32_t newest, first;
 	int i;
 
+	multiline_history_commit();
+
+	ml_dirty = 0;
+	ml_frame = HAL_MemRead32(REG_FRAMES);
+	ml_stat_frames++;
+
 	EVE_LIB_BeginCoProList();
 	EVE_CMD_DLSTART();
 	EVE_CLEAR_COLOR_RGB(0, 0, 0);
@@ -115,12 +283,34 @@ void eve_ui_multiline_display(void)
 	//EVE_CLEAR_TAG(TAG_NO_ACTION);
 
 	EVE_CMD_TEXT(EVE_DISP_WIDTH/2, ML_TOAST,
-						FONT_HEADER, OPT_CENTERX|OPT_CENTERY, ml_display[0]);
-	for (i = 1; i < ML_ROWS + 1; i++)
+						FONT_HEADER, OPT_CENTERX|OPT_CENTERY, ml_toast);
+
+	// Lines 1 - n are the data. Fill from the top until the screen is
+	// full and then scroll.
+	newest = ml_history_head - ml_view;
+	first = newest - ((ml_history_count - ml_view < ML_VISIBLE)
+			? (ml_history_count - ml_view) : ML_VISIBLE);
+	for (i = 1; first != newest; i++, first++)
+	{
+		line = ML_HISTORY(first);
+		EVE_VERTEX_TRANSLATE_Y((ML_ROW(i) - (ML_LINE_HEIGHT / 2)) * 16);
+		EVE_CMD_APPEND(line->address, line->length);
+	}
+	EVE_VERTEX_TRANSLATE_Y(0);
+
+	if (ml_history_count > ML_VISIBLE)
 	{
-		EVE_COLOR(ml_display_fmt[i]);
-		EVE_CMD_TEXT(ML_SPACER, ML_ROW(i),
-						FONT_BODY, OPT_CENTERY, ml_display[i]);
+		EVE_COLOR(EVE_COLOUR_FG_1);
+		EVE_CMD_FGCOLOR(EVE_COLOUR_BG_1);
+		EVE_TAG(TAG_PAGE_UP);
+		EVE_CMD_BUTTON(EVE_DISP_WIDTH - (ML_LINE_HEIGHT * 3), ML_TOP,
+				ML_LINE_HEIGHT * 3 - ML_SPACER, ML_LINE_HEIGHT * 2,
+				FONT_BODY, (ml_view < ml_history_count - ML_VISIBLE) ? 0 : OPT_FLAT, "Up");
+		EVE_TAG(TAG_PAGE_DOWN);
+		EVE_CMD_BUTTON(EVE_DISP_WIDTH - (ML_LINE_HEIGHT * 3), ML_BOTTOM - (ML_LINE_HEIGHT * 2),
+				ML_LINE_HEIGHT * 3 - ML_SPACER, ML_LINE_HEIGHT * 2,
+				FONT_BODY, (ml_view > 0) ? 0 : OPT_FLAT, "Down");
+		EVE_TAG(TAG_NO_ACTION);
 	}
 
 	eve_ui_header_bar(ml_options);
@@ -128,52 +318,90 @@ void eve_ui_multiline_display(void)
 	EVE_DISPLAY();
 	EVE_CMD_SWAP();
 	EVE_LIB_EndCoProList();
-	EVE_LIB_AwaitCoProEmpty();
 }
 
-static void multiline_toast(char *toast)
+void eve_ui_multiline_init(char *toast, uint32_t options)
 {
-	// Line zero is the toast.
-	strcpy(ml_display[0], toast);
+	// Each screen starts with an empty history. The RAM_G area is reused.
+	ml_pending_count = 0;
+	ml_history_head = 0;
+	ml_history_count = 0;
+	ml_history_write = ml_history_start;
+	ml_view = 0;
+	ml_options = options;
+
+	strncpy(ml_toast, toast, ML_COLS - 1);
+	ml_toast[ML_COLS - 1] = '\0';
+
 	eve_ui_multiline_display();
 }
 
-void eve_ui_multiline_init(char *toast, uint32_t options, uint32_t format)
+void eve_ui_multiline_add(char *message, uint32_t format)
 {
-	int i;
+	struct ml_pending_line *pending;
 
-	for (i = 1; i < ML_ROWS + 1; i++)
+	if (ml_pending_count == ML_PENDING_LINES)
 	{
-		ml_display[i][0] = '\0';
-		ml_display_fmt[i] = COLOR_RGB(255,255,255);
+		multiline_history_commit();
 	}
 
-	ml_line = 0;
-	ml_display_fmt[ml_line] = format;
+	pending = &ml_pending[ml_pending_count++];
+	pending->format = format;
+	strncpy(pending->text, message, ML_COLS - 1);
+	pending->text[ML_COLS - 1] = '\0';
 
-	ml_options = options;
+	// Drawn into the history and displayed by eve_ui_multiline_update.
+	ml_dirty = 1;
+	ml_stat_lines++;
+}
+
+void eve_ui_multiline_scroll(int32_t lines)
+{
+	int32_t view = (int32_t)ml_view + lines;
+	int32_t limit = (ml_history_count > ML_VISIBLE) ? (ml_history_count - ML_VISIBLE) : 0;
+
+	if (view < 0)
+	{
+		view = 0;
+	}
+	if (view > limit)
+	{
+		view = limit;
+	}
 
-	multiline_toast(toast);
+	if ((uint32_t)view != ml_view)
+	{
+		ml_view = view;
+		ml_dirty = 1;
+	}
 }
 
-void eve_ui_multiline_add(char *message, uint32_t format)
+void eve_ui_multiline_page(int32_t pages)
 {
-	// Lines 1 - n are the data.
-	ml_line++;
-	if (ml_line >= ML_ROWS)
+	eve_ui_multiline_scroll(pages * ML_VISIBLE);
+}
+
+uint8_t eve_ui_multiline_update(void)
+{
+	if (!ml_dirty)
 	{
-		int i;
+		return 0;
+	}
 
-		for (i = 1; i < ML_ROWS; i++)
-		{
-			strcpy(ml_display[i], ml_display[i + 1]);
-			ml_display_fmt[i] = ml_display_fmt[i + 1];
-		}
-		ml_line--;
+	// Only one redraw per display frame. Lines added in the meantime are
+	// drawn together on the next frame.
+	if (HAL_MemRead32(REG_FRAMES) == ml_frame)
+	{
+		return 1;
 	}
-	strcpy(ml_display[ml_line], message);
-	ml_display_fmt[ml_line] = format;
 
 	eve_ui_multiline_display();
+
+	return 0;
 }
 
+void eve_ui_multiline_stats(uint32_t *lines, uint32_t *frames)
+{
+	*lines = ml_stat_lines;
+	*frames = ml_stat_frames;
+}
@@ -0,0 +1,510 @@
+/**
+  @file eve_ui_remote.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Least free space in RAM_CMD worth writing to.
+ @details Unless the rest of the data is smaller.
+ */
+#define REMOTE_SEGMENT_MIN 64
+
+/**
+ @brief Longest command held back between two writes.
+ @details A command is only sent to RAM_CMD once it is known to be
+ complete. Parameters which set the length of the data after them and
+ strings are held back until they have been received. A string command
+ split between two writes and longer than this is refused.
+ */
+#define REMOTE_PENDING_SIZE 512
+
+/**
+ @brief Encoding of the entries in remote_commands.
+ @details Indexed by the low byte of the command. The number of parameter
+ words and what follows them. REMOTE_CMD_DATA is followed by data of the
+ length in the last parameter. REMOTE_CMD_MEDIA reads its data from the
+ media FIFO when the last parameter has OPT_MEDIAFIFO set and is refused
+ otherwise, as are commands with data of unknown length such as
+ CMD_INFLATE and commands for factory test.
+ */
+//@{
+#define REMOTE_CMD_PARAMS 0x1f
+#define REMOTE_CMD_STRING 0x20
+#define REMOTE_CMD_DATA 0x40
+#define REMOTE_CMD_MEDIA 0x80
+#define REMOTE_CMD_REFUSE 0xff
+//@}
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Lengths of the co-processor commands from CMD_DLSTART.
+ */
+static const uint8_t remote_commands[] = {
+		0, // CMD_DLSTART
+		0, // CMD_SWAP
+		1, // CMD_INTERRUPT
+		REMOTE_CMD_REFUSE, // CMD_CRC
+		REMOTE_CMD_REFUSE, // CMD_HAMMERAUX
+		REMOTE_CMD_REFUSE, // CMD_MARCH
+		REMOTE_CMD_REFUSE, // CMD_IDCT
+		REMOTE_CMD_REFUSE, // CMD_EXECUTE
+		REMOTE_CMD_REFUSE, // CMD_GETPOINT
+		1, // CMD_BGCOLOR
+		1, // CMD_FGCOLOR
+		4, // CMD_GRADIENT
+		2 | REMOTE_CMD_STRING, // CMD_TEXT
+		3 | REMOTE_CMD_STRING, // CMD_BUTTON
+		3 | REMOTE_CMD_STRING, // CMD_KEYS
+		4, // CMD_PROGRESS
+		4, // CMD_SLIDER
+		4, // CMD_SCROLLBAR
+		3 | REMOTE_CMD_STRING, // CMD_TOGGLE
+		4, // CMD_GAUGE
+		4, // CMD_CLOCK
+		1, // CMD_CALIBRATE
+		2, // CMD_SPINNER
+		0, // CMD_STOP
+		3, // CMD_MEMCRC
+		2, // CMD_REGREAD
+		2 | REMOTE_CMD_DATA, // CMD_MEMWRITE
+		3, // CMD_MEMSET
+		2, // CMD_MEMZERO
+		3, // CMD_MEMCPY
+		2, // CMD_APPEND
+		1, // CMD_SNAPSHOT
+		REMOTE_CMD_REFUSE, // CMD_TOUCH_TRANSFORM
+		13, // CMD_BITMAP_TRANSFORM
+		REMOTE_CMD_REFUSE, // CMD_INFLATE
+		1, // CMD_GETPTR
+		2 | REMOTE_CMD_MEDIA, // CMD_LOADIMAGE
+		3, // CMD_GETPROPS
+		0, // CMD_LOADIDENTITY
+		2, // CMD_TRANSLATE
+		2, // CMD_SCALE
+		1, // CMD_ROTATE
+		0, // CMD_SETMATRIX
+		2, // CMD_SETFONT
+		3, // CMD_TRACK
+		3, // CMD_DIAL
+		3, // CMD_NUMBER
+		0, // CMD_SCREENSAVER
+		4, // CMD_SKETCH
+		0, // CMD_LOGO
+		0, // CMD_COLDSTART
+		6, // CMD_GETMATRIX
+		1, // CMD_GRADCOLOR
+		5, // CMD_CSKETCH
+		1, // CMD_SETROTATE
+		4, // CMD_SNAPSHOT2
+		1, // CMD_SETBASE
+		2, // CMD_MEDIAFIFO
+		1 | REMOTE_CMD_MEDIA, // CMD_PLAYVIDEO
+		3, // CMD_SETFONT2
+		1, // CMD_SETSCRATCH
+		REMOTE_CMD_REFUSE, // CMD_INT_RAMSHARED
+		REMOTE_CMD_REFUSE, // CMD_INT_SWLOADIMAGE
+		2, // CMD_ROMFONT
+		0, // CMD_VIDEOSTART
+		2, // CMD_VIDEOFRAME
+		0, // CMD_SYNC
+		3, // CMD_SETBITMAP
+};
+
+/**
+ @brief Remote display state.
+ */
+static struct
+{
+	uint8_t active; // Between eve_ui_remote_start and end
+	uint8_t fault; // The co-processor faulted during this frame
+	uint8_t refused; // A command in this frame was not sent
+	uint8_t tail[4]; // Start of a word split between two writes
+	uint8_t tail_length;
+	uint32_t address; // RAM_G for the client
+} remote;
+
+/**
+ @brief Command being parsed.
+ @details The words of each frame are followed to find where each command
+ ends. While held is set the current command has not yet been shown to be
+ complete and the part received in earlier writes is kept in pending.
+ */
+static struct
+{
+	uint8_t type; // Entry from remote_commands
+	uint8_t params; // Parameter words still to come
+	uint8_t string; // In a zero terminated string
+	uint8_t held;
+	uint32_t data; // Bytes of data still to come
+	uint16_t pending_length;
+	uint8_t pending[REMOTE_PENDING_SIZE];
+} parse;
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static void remote_stream(const uint8_t *data, uint32_t length)
+{
+	uint32_t space;
+	uint32_t min;
+
+	while ((length) && (!remote.fault))
+	{
+		// A fault stops the co-processor reading so there would never be
+		// room for the rest of the frame.
+		if (HAL_MemRead32(REG_CMD_READ) == 0xFFF)
+		{
+			remote.fault = 1;
+			break;
+		}
+
+		min = (length < REMOTE_SEGMENT_MIN) ? length : REMOTE_SEGMENT_MIN;
+		space = HAL_CheckCmdFreeSpace() & (~3);
+		if (space < min)
+		{
+			// Let the network task run while the co-processor works.
+			eve_ui_arch_yield();
+			continue;
+		}
+
+		// Sent from the caller's buffer straight to RAM_CMD.
+		if (space > length)
+		{
+			space = length;
+		}
+		HAL_CmdStreamWrite(data, space);
+		data += space;
+		length -= space;
+	}
+}
+
+static void remote_refuse(void)
+{
+	// Nothing more of the frame is sent.
+	remote.refused = 1;
+	parse.held = 0;
+	parse.pending_length = 0;
+}
+
+static void remote_release(void)
+{
+	// The held command is complete. The part from earlier writes is sent
+	// ahead of the rest.
+	remote_stream(parse.pending, parse.pending_length);
+	parse.pending_length = 0;
+	parse.held = 0;
+}
+
+static void remote_parse(const uint8_t *data, uint32_t length, uint32_t left)
+{
+	uint32_t start = 0; // First byte not yet sent or held
+	uint32_t pos = 0;
+	uint32_t word;
+	uint32_t count;
+	uint32_t rest;
+
+	while ((pos < length) && (!remote.refused))
+	{
+		// Data after a command is passed over.
+		if (parse.data)
+		{
+			count = length - pos;
+			if (count > parse.data)
+			{
+				count = parse.data;
+			}
+			pos += count;
+			parse.data -= count;
+			continue;
+		}
+
+		word = data[pos] | (data[pos + 1] << 8)
+				| ((uint32_t)data[pos + 2] << 16) | ((uint32_t)data[pos + 3] << 24);
+		pos += 4;
+		// Bytes of the frame after this word.
+		rest = (length - pos) + left;
+
+		if (parse.params)
+		{
+			parse.params--;
+			if ((parse.params == 0) && (parse.type & REMOTE_CMD_DATA))
+			{
+				if (word > rest)
+				{
+					remote_refuse();
+					break;
+				}
+				parse.data = (word + 3) & (~3);
+			}
+			if ((parse.params == 0) && (parse.type & REMOTE_CMD_MEDIA)
+					&& (!(word & OPT_MEDIAFIFO)))
+			{
+				remote_refuse();
+				break;
+			}
+			if ((parse.params == 0) && (parse.type & REMOTE_CMD_STRING))
+			{
+				parse.string = 1;
+			}
+			else if ((parse.params == 0) && (parse.held))
+			{
+				remote_release();
+			}
+		}
+		else if (parse.string)
+		{
+			if (((word & 0xff) == 0) || ((word & 0xff00) == 0)
+					|| ((word & 0xff0000) == 0) || ((word & 0xff000000) == 0))
+			{
+				parse.string = 0;
+				remote_release();
+			}
+		}
+		else if ((word >> 24) != 0xff)
+		{
+			// Display list commands are one word.
+		}
+		// Co-processor commands are 0xffffff00 upwards.
+		else if (((word & 0xffffff00) != CMD_DLSTART)
+				|| ((word & 0xff) >= sizeof(remote_commands))
+				|| (remote_commands[word & 0xff] == REMOTE_CMD_REFUSE))
+		{
+			// Send the commands before this one.
+			remote_stream(&data[start], pos - 4 - start);
+			remote_refuse();
+			break;
+		}
+		else
+		{
+			parse.type = remote_commands[word & 0xff];
+			parse.params = parse.type & REMOTE_CMD_PARAMS;
+			if ((parse.params * 4) > rest)
+			{
+				remote_stream(&data[start], pos - 4 - start);
+				remote_refuse();
+				break;
+			}
+			if (parse.type & (REMOTE_CMD_STRING | REMOTE_CMD_DATA | REMOTE_CMD_MEDIA))
+			{
+				// Held until the parameters show where it ends.
+				remote_stream(&data[start], pos - 4 - start);
+				start = pos - 4;
+				parse.held = 1;
+			}
+		}
+	}
+
+	if (remote.refused)
+	{
+		return;
+	}
+
+	if (parse.held)
+	{
+		// An incomplete command at the end of the frame never reaches
+		// RAM_CMD.
+		if ((left == 0) || (parse.pending_length + length - start > REMOTE_PENDING_SIZE))
+		{
+			remote_refuse();
+			return;
+		}
+		memcpy(&parse.pending[parse.pending_length], &data[start], length - start);
+		parse.pending_length += length - start;
+	}
+	else
+	{
+		remote_stream(&data[start], length - start);
+	}
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int8_t eve_ui_remote_start(uint32_t *address, uint32_t *size)
+{
+	if (!remote.active)
+	{
+		// A streamed image is replaced by the remote display.
+		eve_ui_image_release();
+
+		memset(&remote, 0, sizeof(remote));
+		memset(&parse, 0, sizeof(parse));
+		remote.address = eve_ui_ramg_alloc(EVE_RAM_G_REMOTE_SIZE);
+		if (remote.address == EVE_RAMG_NONE)
+		{
+			return EVE_REMOTE_ERROR_MEMORY;
+		}
+		remote.active = 1;
+	}
+
+	*address = remote.address;
+	*size = EVE_RAM_G_REMOTE_SIZE;
+
+	return EVE_REMOTE_OK;
+}
+
+int8_t eve_ui_remote_write(const uint8_t *data, uint16_t length, uint32_t left)
+{
+	uint16_t aligned;
+	uint16_t count;
+
+	if (!remote.active)
+	{
+		return EVE_REMOTE_ERROR_STATE;
+	}
+	if (remote.refused)
+	{
+		return EVE_REMOTE_ERROR_FRAME;
+	}
+
+	// RAM_CMD is written in whole words. A word split between two writes
+	// is completed from the start of the next one.
+	if (remote.tail_length)
+	{
+		count = 4 - remote.tail_length;
+		if (count > length)
+		{
+			count = length;
+		}
+		memcpy(&remote.tail[remote.tail_length], data, count);
+		remote.tail_length += count;
+		data += count;
+		length -= count;
+		if (remote.tail_length < 4)
+		{
+			return EVE_REMOTE_OK;
+		}
+		remote_parse(remote.tail, 4, length + left);
+		remote.tail_length = 0;
+	}
+
+	aligned = length & (~3);
+	remote_parse(data, aligned, (length - aligned) + left);
+
+	remote.tail_length = length - aligned;
+	memcpy(remote.tail, data + aligned, remote.tail_length);
+
+	return (remote.refused) ? EVE_REMOTE_ERROR_FRAME : EVE_REMOTE_OK;
+}
+
+int8_t eve_ui_remote_frame(uint8_t complete)
+{
+	uint32_t fence;
+	uint8_t status;
+	int8_t err = EVE_REMOTE_OK;
+
+	if (!remote.active)
+	{
+		return EVE_REMOTE_ERROR_STATE;
+	}
+
+	if (remote.fault)
+	{
+		err = EVE_REMOTE_ERROR_FAULT;
+	}
+	else if (remote.refused)
+	{
+		// The commands before the refused one were sent whole so the
+		// co-processor is left between commands.
+		err = EVE_REMOTE_ERROR_FRAME;
+	}
+	else if ((!complete) || (remote.tail_length))
+	{
+		// The co-processor is part way through a command.
+		err = EVE_REMOTE_ERROR_FRAME;
+	}
+	else
+	{
+		fence = HAL_GetCmdFence();
+		status = EVE_LIB_AwaitFenceFrames(fence, EVE_COPRO_WAIT_FRAMES);
+
+		if (status == 0xFF)
+		{
+			err = EVE_REMOTE_ERROR_FAULT;
+		}
+		else if (status == 0)
+		{
+			// The co-processor is still busy, such as waiting for data
+			// in the media FIFO.
+			err = EVE_REMOTE_ERROR_FRAME;
+		}
+	}
+
+	if ((err != EVE_REMOTE_OK) && (!remote.refused))
+	{
+		// The next frame starts with the co-processor idle.
+		eve_ui_copro_reset();
+	}
+
+	remote.fault = 0;
+	remote.refused = 0;
+	remote.tail_length = 0;
+	memset(&parse, 0, sizeof(parse));
+
+	return err;
+}
+
+void eve_ui_remote_end(void)
+{
+	if (!remote.active)
+	{
+		return;
+	}
+
+	// Co-processor state such as fonts and bitmap handles may have been
+	// changed by the client.
+	eve_ui_copro_reset();
+	eve_ui_ramg_free(remote.address);
+	eve_ui_load_images();
+
+	remote.active = 0;
+}
@@ -0,0 +1,243 @@
+/**
+  @file eve_ui_snapshot.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief Longest packet in the compressed screenshot.
+ @details A control byte followed by 128 literal pixels.
+ */
+#define SNAPSHOT_PACKET_MAX (1 + (128 * 2))
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Screenshot state.
+ @details The screen is captured a band of lines at a time into a RAM_G
+ area so that only a small part of RAM_G is needed.
+ */
+static struct
+{
+	uint8_t active; // Between eve_ui_snapshot_start and end
+	uint32_t address; // RAM_G for the band
+	uint16_t band_lines; // Lines which fit in the band
+	uint16_t band_start; // First line in the band
+	uint16_t band_end; // Line after the band
+	uint16_t line; // Line being compressed
+	uint16_t column; // Next pixel in the line
+} snapshot;
+
+/**
+ @brief Pixels of the line being compressed.
+ */
+static uint16_t snapshot_pixels[EVE_DISP_WIDTH];
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static int8_t snapshot_band(void)
+{
+	uint32_t fence;
+	uint8_t status;
+	uint16_t lines;
+
+	lines = EVE_DISP_HEIGHT - snapshot.line;
+	if (lines > snapshot.band_lines)
+	{
+		lines = snapshot.band_lines;
+	}
+
+	// Renders the display list on the screen into the band.
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_SNAPSHOT2(RGB565, snapshot.address, 0, snapshot.line, EVE_DISP_WIDTH, lines);
+	fence = EVE_LIB_EndCoProList();
+
+	status = EVE_LIB_AwaitFenceFrames(fence, EVE_COPRO_WAIT_FRAMES);
+
+	if (status != 1)
+	{
+		eve_ui_copro_reset();
+		return EVE_SNAPSHOT_ERROR_FAULT;
+	}
+
+	snapshot.band_start = snapshot.line;
+	snapshot.band_end = snapshot.line + lines;
+
+	return EVE_SNAPSHOT_OK;
+}
+
+static uint16_t snapshot_packet(uint8_t *buffer)
+{
+	uint16_t *pixels = &snapshot_pixels[snapshot.column];
+	uint16_t count = EVE_DISP_WIDTH - snapshot.column;
+	uint16_t run;
+
+	// Control bytes 0 to 127 are followed by 1 to 128 different pixels.
+	// Control bytes 128 to 255 are followed by one pixel repeated 2 to
+	// 129 times. Pixels are little-endian RGB565.
+	run = 1;
+	while ((run < count) && (run < 129) && (pixels[run] == pixels[0]))
+	{
+		run++;
+	}
+
+	if (run >= 2)
+	{
+		buffer[0] = 128 + (run - 2);
+		memcpy(&buffer[1], pixels, 2);
+		snapshot.column += run;
+		return 3;
+	}
+
+	// Stop the literal pixels where a run starts.
+	run = 1;
+	while ((run < count) && (run < 128) && ((run + 1 >= count) || (pixels[run + 1] != pixels[run])))
+	{
+		run++;
+	}
+
+	buffer[0] = run - 1;
+	memcpy(&buffer[1], pixels, run * 2);
+	snapshot.column += run;
+	return 1 + (run * 2);
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int8_t eve_ui_snapshot_start(uint16_t *width, uint16_t *height)
+{
+	if (!snapshot.active)
+	{
+		memset(&snapshot, 0, sizeof(snapshot));
+		snapshot.address = eve_ui_ramg_alloc(EVE_RAM_G_SNAPSHOT_SIZE);
+		if (snapshot.address == EVE_RAMG_NONE)
+		{
+			return EVE_SNAPSHOT_ERROR_MEMORY;
+		}
+		snapshot.active = 1;
+	}
+
+	snapshot.band_lines = EVE_RAM_G_SNAPSHOT_SIZE / (EVE_DISP_WIDTH * 2);
+	snapshot.band_start = 0;
+	snapshot.band_end = 0;
+	snapshot.line = 0;
+	snapshot.column = 0;
+
+	*width = EVE_DISP_WIDTH;
+	*height = EVE_DISP_HEIGHT;
+
+	return EVE_SNAPSHOT_OK;
+}
+
+int8_t eve_ui_snapshot_read(uint8_t *buffer, uint16_t size, uint16_t *length)
+{
+	uint16_t used = 0;
+	int8_t err;
+
+	*length = 0;
+
+	if (!snapshot.active)
+	{
+		return EVE_SNAPSHOT_ERROR_STATE;
+	}
+	if (size < SNAPSHOT_PACKET_MAX)
+	{
+		return EVE_SNAPSHOT_ERROR_SIZE;
+	}
+
+	while ((snapshot.line < EVE_DISP_HEIGHT) && (size - used >= SNAPSHOT_PACKET_MAX))
+	{
+		if (snapshot.column == 0)
+		{
+			if (snapshot.line >= snapshot.band_end)
+			{
+				err = snapshot_band();
+				if (err != EVE_SNAPSHOT_OK)
+				{
+					return err;
+				}
+			}
+
+			// One burst read for each line.
+			HAL_MemReadBlock(snapshot.address
+					+ ((uint32_t)(snapshot.line - snapshot.band_start) * EVE_DISP_WIDTH * 2),
+					(uint8_t *)snapshot_pixels, EVE_DISP_WIDTH * 2);
+		}
+
+		// Packets do not cross the end of a line.
+		while ((snapshot.column < EVE_DISP_WIDTH) && (size - used >= SNAPSHOT_PACKET_MAX))
+		{
+			used += snapshot_packet(&buffer[used]);
+		}
+
+		if (snapshot.column == EVE_DISP_WIDTH)
+		{
+			snapshot.column = 0;
+			snapshot.line++;
+		}
+	}
+
+	*length = used;
+
+	return EVE_SNAPSHOT_OK;
+}
+
+void eve_ui_snapshot_end(void)
+{
+	if (!snapshot.active)
+	{
+		return;
+	}
+
+	eve_ui_ramg_free(snapshot.address);
+
+	snapshot.active = 0;
+}
@@ -0,0 +1,509 @@
+/**
+  @file eve_ui_video.c
+ */
+/*
+ * ============================================================================
+ * History
+ * =======
+ *
+ * (C) Copyright Bridgetek Pte Ltd
+ * ============================================================================
+ *
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ * http://www.ftdichip.com/FTSourceCodeLicenceTerms.htm ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ * ============================================================================
+ */
+
+/* INCLUDES ************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "EVE_config.h"
+#include "EVE.h"
+#include "HAL.h"
+
+#include "eve_ui.h"
+
+/* CONSTANTS ***********************************************************************/
+
+/**
+ @brief AVI parser states.
+ @details The chunks of the AVI file are followed as the data is written
+ to the media FIFO. The main header is checked before CMD_PLAYVIDEO is
+ sent and the end of each frame is noted to count decoded frames.
+ */
+//@{
+#define VIDEO_CHUNK 0 // Chunk ID and size
+#define VIDEO_FORM 1 // Form type of a RIFF or LIST chunk
+#define VIDEO_AVIH 2 // Main AVI header
+#define VIDEO_SKIP 3 // Chunk data
+#define VIDEO_END 4 // After the RIFF chunk
+//@}
+
+/**
+ @brief AVI header fields.
+ @details The main AVI header holds the frame period at offset 0, the
+ total frames at 16 and the width and height at 32 and 36.
+ */
+//@{
+#define VIDEO_CHUNK_LENGTH 8
+#define VIDEO_AVIH_LENGTH 40
+//@}
+
+/**
+ @brief Data held in the media FIFO before playback starts.
+ @details Playback continues from this data while the network is slow.
+ */
+#define VIDEO_PREBUFFER ((EVE_RAM_G_VIDEOFIFO_SIZE * 3) / 4)
+
+/**
+ @brief Frames in the media FIFO which have not been decoded.
+ @details If there are more frames than this the oldest is counted as
+ decoded early.
+ */
+#define VIDEO_FRAME_QUEUE 64
+
+/* LOCAL VARIABLES *****************************************************************/
+
+/**
+ @brief Video being streamed.
+ */
+static struct
+{
+	uint8_t active; // Between eve_ui_video_start and end or abort
+	uint8_t playing; // CMD_PLAYVIDEO has been sent
+	uint8_t ending; // All data has been written
+	uint8_t starved; // The media FIFO was empty when last checked
+	uint8_t header; // The main AVI header has been checked
+	uint8_t parse; // AVI parser state
+	uint8_t count; // Bytes of the current field
+	uint8_t field[VIDEO_AVIH_LENGTH];
+	uint32_t offset; // Bytes parsed from the start of the file
+	uint32_t skip; // Chunk bytes left to skip
+	uint32_t end; // End of the RIFF chunk
+	uint32_t read; // Last REG_MEDIAFIFO_READ
+	uint32_t clock; // Last REG_CLOCK
+	uint32_t clock_khz; // REG_CLOCK ticks a millisecond
+	uint32_t consumed; // Bytes read by the co-processor
+	uint32_t frame_end[VIDEO_FRAME_QUEUE];
+	uint8_t frame_head;
+	uint8_t frame_tail;
+	uint32_t fifo; // Media FIFO in RAM_G
+	uint32_t fence; // End of the co-processor list with CMD_PLAYVIDEO
+	struct eve_ui_video_stats stats;
+} video;
+
+/* LOCAL FUNCTIONS / INLINES *******************************************************/
+
+static uint32_t video_le32(const uint8_t *p)
+{
+	return ((uint32_t)p[3] << 24) | (p[2] << 16) | (p[1] << 8) | p[0];
+}
+
+static void video_frame(uint32_t end)
+{
+	uint8_t next = (video.frame_head + 1) % VIDEO_FRAME_QUEUE;
+
+	if (next == video.frame_tail)
+	{
+		video.frame_tail = (video.frame_tail + 1) % VIDEO_FRAME_QUEUE;
+		video.stats.frames++;
+	}
+	video.frame_end[video.frame_head] = end;
+	video.frame_head = next;
+}
+
+static int8_t video_parse(const uint8_t *data, uint32_t length)
+{
+	uint32_t size;
+
+	while (length)
+	{
+		if (video.parse == VIDEO_END)
+		{
+			// Data after the RIFF chunk is passed on but not parsed.
+			video.offset += length;
+			break;
+		}
+
+		if (video.parse == VIDEO_SKIP)
+		{
+			size = (video.skip > length) ? length : video.skip;
+			video.skip -= size;
+			video.offset += size;
+			data += size;
+			length -= size;
+			if (video.skip == 0)
+			{
+				video.parse = (video.offset >= video.end) ? VIDEO_END : VIDEO_CHUNK;
+			}
+			continue;
+		}
+
+		video.field[video.count++] = *data++;
+		length--;
+		video.offset++;
+
+		switch (video.parse)
+		{
+		case VIDEO_CHUNK:
+			if (video.count < VIDEO_CHUNK_LENGTH)
+			{
+				break;
+			}
+			video.count = 0;
+			size = video_le32(&video.field[4]);
+
+			if (video.offset == VIDEO_CHUNK_LENGTH)
+			{
+				if (memcmp(video.field, "RIFF", 4) != 0)
+				{
+					return EVE_VIDEO_ERROR_FORMAT;
+				}
+				video.end = VIDEO_CHUNK_LENGTH + size;
+				video.parse = VIDEO_FORM;
+				break;
+			}
+			if (memcmp(video.field, "LIST", 4) == 0)
+			{
+				// The chunks in a list are parsed in turn.
+				video.parse = VIDEO_FORM;
+				break;
+			}
+
+			// Chunks are padded to an even length.
+			video.skip = size + (size & 1);
+			if (memcmp(video.field, "avih", 4) == 0)
+			{
+				video.parse = VIDEO_AVIH;
+				break;
+			}
+			if ((video.field[2] == 'd') && ((video.field[3] == 'c') || (video.field[3] == 'b')))
+			{
+				// Compressed or uncompressed video frame.
+				if (!video.header)
+				{
+					return EVE_VIDEO_ERROR_FORMAT;
+				}
+				video_frame(video.offset + video.skip);
+			}
+			video.parse = (video.skip) ? VIDEO_SKIP : VIDEO_CHUNK;
+			break;
+
+		case VIDEO_FORM:
+			if (video.count < 4)
+			{
+				break;
+			}
+			video.count = 0;
+			if ((video.offset == VIDEO_CHUNK_LENGTH + 4) && (memcmp(video.field, "AVI ", 4) != 0))
+			{
+				return EVE_VIDEO_ERROR_FORMAT;
+			}
+			video.parse = VIDEO_CHUNK;
+			break;
+
+		case VIDEO_AVIH:
+			video.skip--;
+			if (video.count < VIDEO_AVIH_LENGTH)
+			{
+				if (video.skip == 0)
+				{
+					return EVE_VIDEO_ERROR_FORMAT;
+				}
+				break;
+			}
+			video.count = 0;
+			video.stats.frame_us = video_le32(&video.field[0]);
+			video.stats.total_frames = video_le32(&video.field[16]);
+			size = video_le32(&video.field[32]);
+			if ((size == 0) || (size > EVE_DISP_WIDTH))
+			{
+				return EVE_VIDEO_ERROR_SIZE;
+			}
+			size = video_le32(&video.field[36]);
+			if ((size == 0) || (size > EVE_DISP_HEIGHT))
+			{
+				return EVE_VIDEO_ERROR_SIZE;
+			}
+			video.header = 1;
+			video.parse = (video.skip) ? VIDEO_SKIP : VIDEO_CHUNK;
+			break;
+		}
+	}
+
+	return EVE_VIDEO_OK;
+}
+
+static uint32_t video_progress(void)
+{
+	uint32_t read = HAL_MemRead32(REG_MEDIAFIFO_READ);
+	uint32_t clock = HAL_MemRead32(REG_CLOCK);
+	uint32_t moved;
+	uint32_t level;
+
+	// REG_CLOCK wraps in about a minute so time is added up as it passes.
+	moved = clock - video.clock;
+	video.stats.play_ms += moved / video.clock_khz;
+	video.clock = clock - (moved % video.clock_khz);
+
+	moved = (read + EVE_RAM_G_VIDEOFIFO_SIZE - video.read) % EVE_RAM_G_VIDEOFIFO_SIZE;
+	video.read = read;
+	video.consumed += moved;
+
+	while ((video.frame_tail != video.frame_head)
+			&& (video.frame_end[video.frame_tail] <= video.consumed))
+	{
+		video.frame_tail = (video.frame_tail + 1) % VIDEO_FRAME_QUEUE;
+		video.stats.frames++;
+	}
+
+	if (!video.ending)
+	{
+		// Only the writer fills the media FIFO so if it has run empty since
+		// the last write it is still empty now. Up to 3 bytes are held back
+		// until a whole word has been written.
+		level = video.stats.bytes - video.consumed;
+		if (level < video.stats.min_level)
+		{
+			video.stats.min_level = level;
+		}
+		if (level < 4)
+		{
+			if (!video.starved)
+			{
+				video.stats.underruns++;
+			}
+			video.starved = 1;
+		}
+		else
+		{
+			video.starved = 0;
+		}
+	}
+
+	return moved;
+}
+
+static void video_play(void)
+{
+	video.stats.min_level = video.stats.bytes;
+	video.clock_khz = HAL_MemRead32(REG_FREQUENCY) / 1000;
+	video.clock = HAL_MemRead32(REG_CLOCK);
+
+	// The co-processor makes its own display lists for each frame until the
+	// end of the video.
+	EVE_LIB_BeginCoProList();
+	EVE_CMD_DLSTART();
+	EVE_CLEAR_COLOR_RGB(0, 0, 0);
+	EVE_CLEAR(1,1,1);
+	EVE_DISPLAY();
+	EVE_CMD_SWAP();
+	EVE_CMD_PLAYVIDEO(OPT_MEDIAFIFO | OPT_NOTEAR | OPT_FULLSCREEN);
+	video.fence = EVE_LIB_EndCoProList();
+
+	video.playing = 1;
+}
+
+static void video_finish(void)
+{
+	eve_ui_ramg_free(video.fifo);
+	video.active = 0;
+
+	// CMD_PLAYVIDEO decodes frames into RAM_G from address zero over the
+	// fonts and images.
+	if (video.playing)
+	{
+		eve_ui_load_images();
+	}
+}
+
+/* FUNCTIONS ***********************************************************************/
+
+int8_t eve_ui_video_start(void)
+{
+	if (video.active)
+	{
+		eve_ui_video_abort();
+	}
+
+	// A streamed image is replaced by the video.
+	eve_ui_image_release();
+
+	memset(&video, 0, sizeof(video));
+	video.fifo = eve_ui_ramg_alloc(EVE_RAM_G_VIDEOFIFO_SIZE);
+	if (video.fifo == EVE_RAMG_NONE)
+	{
+		return EVE_VIDEO_ERROR_MEMORY;
+	}
+	video.active = 1;
+
+	EVE_LIB_MediaFifoStart(video.fifo, EVE_RAM_G_VIDEOFIFO_SIZE);
+
+	return EVE_VIDEO_OK;
+}
+
+int8_t eve_ui_video_write(const uint8_t *data, uint16_t length)
+{
+	uint32_t written;
+	int8_t err;
+
+	if (!video.active)
+	{
+		return EVE_VIDEO_ERROR_DECODE;
+	}
+
+	if (video.playing)
+	{
+		video_progress();
+	}
+
+	// While playing this waits for the co-processor to make room. The
+	// sender is held back until then.
+	while (length)
+	{
+		written = EVE_LIB_MediaFifoWrite(data, length);
+		if (written)
+		{
+			err = video_parse(data, written);
+			if (err != EVE_VIDEO_OK)
+			{
+				eve_ui_video_abort();
+				return err;
+			}
+			video.stats.bytes += written;
+			data += written;
+			length -= written;
+		}
+
+		if (!video.playing)
+		{
+			if ((video.stats.bytes >= VIDEO_PREBUFFER) || (length))
+			{
+				if (!video.header)
+				{
+					eve_ui_video_abort();
+					return EVE_VIDEO_ERROR_FORMAT;
+				}
+				video_play();
+			}
+		}
+		else if (written == 0)
+		{
+			video_progress();
+			if (EVE_LIB_CheckFence(video.fence))
+			{
+				// The video is complete or the co-processor has faulted.
+				// The rest of the data is not needed.
+				break;
+			}
+		}
+	}
+
+	return EVE_VIDEO_OK;
+}
+
+int8_t eve_ui_video_end(void)
+{
+	uint32_t idle;
+	uint8_t status;
+
+	if (!video.active)
+	{
+		return EVE_VIDEO_ERROR_DECODE;
+	}
+
+	if (!video.playing)
+	{
+		// A short video is played from the data received.
+		if (!video.header)
+		{
+			eve_ui_video_abort();
+			return EVE_VIDEO_ERROR_FORMAT;
+		}
+		video_play();
+	}
+
+	video.ending = 1;
+	EVE_LIB_MediaFifoFlush();
+
+	// Wait while the co-processor plays the data in the media FIFO. Only
+	// display frames where it reads nothing count towards the limit.
+	idle = 0;
+	do
+	{
+		status = EVE_LIB_AwaitFenceFrames(video.fence, 1);
+		idle = video_progress() ? 0 : idle + 1;
+	} while ((status == 0) && (idle < EVE_COPRO_WAIT_FRAMES));
+
+	if (status != 1)
+	{
+		eve_ui_video_abort();
+		return EVE_VIDEO_ERROR_DECODE;
+	}
+
+	// All frames have been decoded.
+	while (video.frame_tail != video.frame_head)
+	{
+		video.frame_tail = (video.frame_tail + 1) % VIDEO_FRAME_QUEUE;
+		video.stats.frames++;
+	}
+
+	video_finish();
+
+	return EVE_VIDEO_OK;
+}
+
+void eve_ui_video_abort(void)
+{
+	if (!video.active)
+	{
+		return;
+	}
+
+	if (video.playing)
+	{
+		video.ending = 1;
+		video_progress();
+		if (HAL_CheckCmdFence(video.fence) != 1)
+		{
+			// The co-processor is waiting for data which will not arrive or
+			// has faulted.
+			eve_ui_copro_reset();
+		}
+	}
+
+	video_finish();
+}
+
+void eve_ui_video_stats(struct eve_ui_video_stats *stats)
+{
+	*stats = video.stats;
+}